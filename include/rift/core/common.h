@@ -124,10 +124,10 @@ typedef struct {
 } rift_memory_block_t;
 
 // RIFT Source Location Tracking
+// Line/column are resolved from character_offset on demand
+// (rift_tokenizer_get_location) rather than stored per node.
 typedef struct {
     const char* filename;
-    size_t line_number;
-    size_t column_number;
     size_t character_offset;
 } rift_source_location_t;
 
@@ -0,0 +1,60 @@
+/*
+ * rift/include/rift/core/stage-0/line_index.h
+ * RIFT Stage 0: Lazy Line Index Header
+ * OBINexus Computing Framework - AEGIS Methodology
+ * Technical Lead: Nnamdi Michael Okpala
+ */
+
+#ifndef RIFT_CORE_STAGE_0_LINE_INDEX_H
+#define RIFT_CORE_STAGE_0_LINE_INDEX_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Newline Offset Table - built on first location query
+typedef struct rift_line_index {
+    const char* input;                // Source text (not owned)
+    size_t length;                    // Source length in bytes
+    size_t* newlines;                 // Byte offsets of every '\n'
+    size_t newline_count;             // Entries in newlines
+    bool built;                       // Table populated
+} rift_line_index_t;
+
+/**
+ * rift_line_index_init - Attach a line index to source text
+ * @index: Index to initialize
+ * @input: Source text
+ * @length: Source length in bytes
+ *
+ * No scanning happens here; the newline table is built by the first
+ * call to rift_line_index_lookup.
+ */
+void rift_line_index_init(rift_line_index_t* index, const char* input, size_t length);
+
+/**
+ * rift_line_index_lookup - Resolve a byte offset to line and column
+ * @index: Initialized line index
+ * @offset: Byte offset into the source (clamped to the source length)
+ * @line: Receives the 1-based line number
+ * @column: Receives the 1-based byte column
+ *
+ * Returns: RIFT_SUCCESS on success, negative error code on failure
+ */
+int rift_line_index_lookup(rift_line_index_t* index, size_t offset,
+                           size_t* line, size_t* column);
+
+/**
+ * rift_line_index_free - Release the newline table
+ * @index: Line index to release
+ */
+void rift_line_index_free(rift_line_index_t* index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_CORE_STAGE_0_LINE_INDEX_H */
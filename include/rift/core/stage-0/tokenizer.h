@@ -9,8 +9,12 @@
 #define RIFT_CORE_STAGE_0_TOKENIZER_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
 
+#include "rift/core/common.h"
+#include "rift/core/stage-0/line_index.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -24,15 +28,29 @@ extern "C" {
 #define RIFT_MAX_TOKENS 4096
 #define RIFT_MEMORY_ALIGNMENT 4096
 
-// RIFT Error Codes
-#define RIFT_SUCCESS 0
-#define RIFT_ERROR_INVALID_ARGUMENT -1
-#define RIFT_ERROR_MEMORY_ALLOCATION -2
-#define RIFT_ERROR_INVALID_STATE -3
-#define RIFT_ERROR_TOKEN_BUFFER_OVERFLOW -4
-#define RIFT_ERROR_TOKENIZATION_FAILED -5
-#define RIFT_ERROR_GOVERNANCE_VIOLATION -6
-#define RIFT_ERROR_END_OF_INPUT -7
+// Error codes are rift_error_code_t from common.h
+
+// Token Flags
+#define RIFT_TOKEN_FLAG_HAS_ESCAPES   0x01   // String literal contains backslash escapes
+#define RIFT_TOKEN_FLAG_UNTERMINATED  0x02   // String literal ran to end of input
+#define RIFT_TOKEN_FLAG_BAD_NUMBER    0x04   // Numeric literal did not convert
+
+#define RIFT_NO_CONSTANT ((size_t)-1)
+
+// Converted Numeric Literal
+typedef enum {
+    RIFT_CONSTANT_INVALID = 0,        // Lexeme did not convert (RIFT_TOKEN_FLAG_BAD_NUMBER)
+    RIFT_CONSTANT_INTEGER,            // Fits uint64_t
+    RIFT_CONSTANT_FLOAT               // Fraction, exponent or decimal overflow
+} rift_constant_kind_t;
+
+typedef struct rift_constant {
+    rift_constant_kind_t kind;
+    union {
+        uint64_t integer;
+        double real;
+    } as;
+} rift_constant_t;
 
 // Forward Declarations
 typedef struct rift_tokenizer_state rift_tokenizer_state_t;
@@ -57,20 +75,33 @@ typedef enum {
 // RIFT Token Structure - AEGIS Compliant Three-Field Design
 typedef struct rift_token {
     rift_token_type_t type;           // Token classification
-    char value[RIFT_MAX_TOKEN_LENGTH]; // Token lexical content
+    char value[RIFT_MAX_TOKEN_LENGTH]; // Token lexical content (empty for strings)
     size_t matched_state;             // AST minimization preservation field
-    size_t line_number;               // Source location tracking
-    size_t column_number;             // Column position tracking
+    size_t offset;                    // Byte offset; see rift_tokenizer_get_location
+    size_t length;                    // Lexeme length in bytes
+    unsigned flags;                   // RIFT_TOKEN_FLAG_* bits
+    const char* decoded;              // Unescaped string value (lazy, arena)
+    size_t decoded_length;            // Length of decoded
+    size_t constant_index;            // Into state->constants, or RIFT_NO_CONSTANT
     size_t complexity_cost;           // Computational complexity metric
 } rift_token_t;
 
+// String Arena - storage for lazily unescaped literals
+typedef struct rift_string_block rift_string_block_t;
+typedef struct {
+    rift_string_block_t* blocks;      // Newest block first
+} rift_string_arena_t;
+
 // Tokenizer State Management Structure
 typedef struct rift_tokenizer_state {
     const char* input;                // Source text input
     size_t position;                  // Current position in input
     size_t length;                    // Total input length
-    size_t line;                      // Current line number
-    size_t column;                    // Current column number
+    rift_line_index_t line_index;     // Lazy newline table for diagnostics
+    rift_string_arena_t strings;      // Decoded string literals
+    rift_constant_t* constants;       // Numeric literal values, in token order
+    size_t constant_count;
+    size_t constant_capacity;
     rift_token_t* tokens;             // Token array buffer
     size_t token_count;               // Number of tokens generated
     size_t token_capacity;            // Maximum token capacity
@@ -131,6 +162,51 @@ const rift_token_t* rift_tokenizer_get_tokens(const rift_tokenizer_state_t* stat
  */
 size_t rift_tokenizer_get_token_count(const rift_tokenizer_state_t* state);
 
+/**
+ * rift_tokenizer_get_location - Resolve a token offset to line and column
+ * @state: Tokenizer state
+ * @offset: Byte offset, e.g. rift_token_t.offset
+ * @line: Receives the 1-based line number
+ * @column: Receives the 1-based byte column
+ *
+ * The newline table is built on the first call and reused afterwards,
+ * so tokenization itself never tracks lines.
+ *
+ * Returns: RIFT_SUCCESS on success, negative error code on failure
+ */
+int rift_tokenizer_get_location(rift_tokenizer_state_t* state, size_t offset,
+                                size_t* line, size_t* column);
+
+/**
+ * rift_tokenizer_string_value - Contents of a string literal token
+ * @state: Tokenizer state that produced the token
+ * @index: Token index
+ * @length: Receives the value length in bytes
+ *
+ * String tokens keep only their source span. Literals without escapes
+ * are returned in place (a pointer into the input, not NUL-terminated);
+ * literals with escapes are unescaped into the tokenizer's arena on the
+ * first call and the copy is reused afterwards.
+ *
+ * Returns: Pointer to the value, or NULL for non-string tokens or errors
+ */
+const char* rift_tokenizer_string_value(rift_tokenizer_state_t* state, size_t index,
+                                        size_t* length);
+
+/**
+ * rift_tokenizer_number_value - Converted value of a numeric literal token
+ * @state: Tokenizer state that produced the token
+ * @index: Token index
+ *
+ * Numeric literals (decimal, 0x hex, 0b binary, '_' separators) are
+ * converted once while tokenizing; this only follows the token's
+ * constant_index into the table.
+ *
+ * Returns: Pointer to the value, or NULL for non-numeric tokens
+ */
+const rift_constant_t* rift_tokenizer_number_value(const rift_tokenizer_state_t* state,
+                                                   size_t index);
+
 /*
  * Specialized Tokenization Functions
  */
@@ -150,7 +226,8 @@ int tokenize_identifier(rift_tokenizer_state_t* state, rift_token_t* token);
  * @token: Token structure to populate
  * 
  * Handles both integer and floating-point literals with proper
- * type classification and complexity cost calculation.
+ * type classification and complexity cost calculation. The value is
+ * converted here and stored in the state's constant table.
  * 
  * Returns: RIFT_SUCCESS on success, error code on failure
  */
@@ -0,0 +1,323 @@
+/*
+ * rift/include/rift/core/stage-1/ast.h
+ * RIFT Stage 1: Flat AST Representation
+ * OBINexus Computing Framework - AEGIS Methodology
+ * Technical Lead: Nnamdi Michael Okpala
+ */
+
+#ifndef RIFT_CORE_STAGE_1_AST_H
+#define RIFT_CORE_STAGE_1_AST_H
+
+#include "rift/core/common.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// AST Node Types
+typedef enum {
+    AST_NODE_PROGRAM,
+    AST_NODE_STATEMENT,
+    AST_NODE_EXPRESSION,
+    AST_NODE_DECLARATION,
+    AST_NODE_ASSIGNMENT,
+    AST_NODE_BINARY_OP,
+    AST_NODE_UNARY_OP,
+    AST_NODE_LITERAL,
+    AST_NODE_IDENTIFIER,
+    AST_NODE_FUNCTION_CALL,
+    AST_NODE_BLOCK,
+    AST_NODE_IF_STATEMENT,
+    AST_NODE_WHILE_LOOP,
+    AST_NODE_FOR_LOOP,
+    AST_NODE_RETURN_STATEMENT
+} rift_ast_node_type_t;
+
+// Interned AST value; RIFT_AST_NO_SYMBOL for nodes without one
+typedef uint32_t rift_ast_symbol_t;
+#define RIFT_AST_NO_SYMBOL 0
+
+// Node handle: an index into the AST's arrays
+typedef uint32_t rift_ast_id_t;
+#define RIFT_AST_NONE UINT32_MAX
+#define RIFT_AST_ROOT 0               // Root id of a finalized AST
+
+// AST Arena - interned node values for one parse
+typedef struct rift_ast_block rift_ast_block_t;
+typedef struct {
+    const char* text;                 // NUL-terminated copy in the arena
+    uint64_t hash;                    // Of the text; equal across arenas
+    uint32_t length;
+} rift_ast_symbol_entry_t;
+
+typedef struct {
+    rift_ast_block_t* blocks;         // Newest block first
+    rift_ast_symbol_entry_t* symbols; // Indexed by symbol - 1
+    size_t symbol_count;
+    size_t symbol_capacity;
+    rift_ast_symbol_t* slots;         // Open-addressed intern table
+    size_t slot_capacity;
+} rift_ast_arena_t;
+
+// Flat AST - one array per field, indexed by rift_ast_id_t
+//
+// Nodes are appended as the parser creates them and linked through
+// first_child/next_sibling, so a node can have any number of children.
+// rift_ast_finalize renumbers the reachable tree into preorder: the
+// root is 0, a node's first child is id + 1, its subtree is
+// [id, subtree_end[id]) and a whole-tree pass is a plain loop.
+//
+// hashes[id] is a structural (Merkle) hash of the node's kind, value
+// and children's hashes in order. Offsets are not part of it. It is
+// folded in as each child is attached, so it is exact as long as
+// children are complete when added; the parsers build bottom-up.
+typedef struct rift_ast {
+    uint8_t* kinds;                   // rift_ast_node_type_t, one byte per node
+    rift_ast_symbol_t* values;        // Lexeme or decoded literal
+    uint32_t* offsets;                // Source byte offset; line/column on demand
+    rift_ast_id_t* first_child;
+    rift_ast_id_t* last_child;        // O(1) append while building
+    rift_ast_id_t* next_sibling;
+    uint32_t* child_counts;
+    uint32_t* subtree_end;            // Valid while preorder is set
+    uint64_t* hashes;                 // Structural hash of each subtree
+    size_t count;
+    size_t capacity;
+    bool preorder;
+    rift_ast_arena_t arena;
+} rift_ast_t;
+
+// Shared AST - hash-consed nodes, one per distinct subtree
+//
+// rift_ast_dag_intern adds a finalized tree bottom-up. A subtree that
+// is already present, from the same tree or any earlier one, is reused
+// instead of copied, so repeated expressions and declarations are
+// stored once and the result is a DAG. Nodes never change once added
+// and children always have smaller ids than their parents: a per-node
+// analysis is one forward pass filling an array of count results, and
+// runs once per distinct subtree however often it repeats.
+//
+// offsets[id] is the earliest occurrence in the tree that added the
+// node; positions of the repeats that share it are not kept.
+typedef struct {
+    uint8_t* kinds;
+    rift_ast_symbol_t* values;
+    uint32_t* offsets;
+    uint32_t* child_counts;
+    uint32_t* first_edge;             // Children: edges[first_edge, +child_counts)
+    uint64_t* hashes;                 // Same values as the tree's hashes
+    rift_ast_id_t* edges;
+    size_t count;
+    size_t capacity;
+    size_t edge_count;
+    size_t edge_capacity;
+    rift_ast_id_t* slots;             // Open-addressed intern table of id + 1
+    size_t slot_capacity;
+    rift_ast_arena_t arena;
+} rift_ast_dag_t;
+
+/*
+ * AST Arena Functions
+ */
+
+/**
+ * rift_ast_arena_init - Prepare an empty arena
+ * @arena: Arena to initialize
+ */
+void rift_ast_arena_init(rift_ast_arena_t* arena);
+
+/**
+ * rift_ast_arena_release - Free every value at once
+ * @arena: Arena to release; left empty and reusable
+ */
+void rift_ast_arena_release(rift_ast_arena_t* arena);
+
+/**
+ * rift_ast_intern - Intern a value in the arena
+ * @arena: Owning arena
+ * @text: Value bytes (need not be NUL-terminated)
+ * @length: Value length in bytes
+ *
+ * Equal values share one id, so repeated identifiers are stored once.
+ *
+ * Returns: Symbol id, or RIFT_AST_NO_SYMBOL on allocation failure
+ */
+rift_ast_symbol_t rift_ast_intern(rift_ast_arena_t* arena, const char* text, size_t length);
+
+/**
+ * rift_ast_symbol_text - Text of an interned value
+ * @arena: Owning arena
+ * @symbol: Symbol id
+ * @length: Receives the length in bytes (optional)
+ *
+ * Returns: NUL-terminated text, or "" for RIFT_AST_NO_SYMBOL
+ */
+const char* rift_ast_symbol_text(const rift_ast_arena_t* arena, rift_ast_symbol_t symbol,
+                                 size_t* length);
+
+/*
+ * Flat AST Functions
+ */
+
+/**
+ * rift_ast_init - Prepare an empty AST
+ * @ast: AST to initialize
+ */
+void rift_ast_init(rift_ast_t* ast);
+
+/**
+ * rift_ast_release - Free all nodes and values
+ * @ast: AST to release; left empty and reusable
+ */
+void rift_ast_release(rift_ast_t* ast);
+
+/**
+ * rift_ast_add_node - Append a detached node
+ * @ast: Owning AST
+ * @type: Node type
+ * @value: Node value (optional)
+ * @length: Value length in bytes
+ * @offset: Source byte offset
+ *
+ * Returns: New node id, or RIFT_AST_NONE on allocation failure
+ */
+rift_ast_id_t rift_ast_add_node(rift_ast_t* ast, rift_ast_node_type_t type,
+                                const char* value, size_t length, size_t offset);
+
+/**
+ * rift_ast_add_child - Append child as the last child of parent
+ * @ast: Owning AST
+ * @parent: Parent node
+ * @child: Detached node, complete: its hash is folded into parent's now
+ *
+ * Returns: RIFT_SUCCESS on success, error code on failure
+ */
+int rift_ast_add_child(rift_ast_t* ast, rift_ast_id_t parent, rift_ast_id_t child);
+
+/**
+ * rift_ast_finalize - Renumber the tree under root into preorder
+ * @ast: AST to reorder
+ * @root: Root node; becomes node 0
+ *
+ * Nodes not reachable from root are dropped. Runs without recursion,
+ * so tree depth is bounded only by memory.
+ *
+ * Returns: RIFT_SUCCESS on success, error code on failure
+ */
+int rift_ast_finalize(rift_ast_t* ast, rift_ast_id_t root);
+
+/**
+ * rift_ast_append_children - Move another tree's top level under root
+ * @dst: Finalized AST receiving the subtrees
+ * @src: Finalized AST; its root's children are copied, in order
+ *
+ * The copies land after every existing node and become the last
+ * children of dst's root, so dst stays in preorder. Values are
+ * re-interned into dst's arena; src is left unchanged.
+ *
+ * Returns: RIFT_SUCCESS on success, error code on failure
+ */
+int rift_ast_append_children(rift_ast_t* dst, const rift_ast_t* src);
+
+/**
+ * rift_ast_value - Text of a node's value
+ * @ast: Owning AST
+ * @node: Node id
+ * @length: Receives the length in bytes (optional)
+ *
+ * Returns: NUL-terminated value, or "" if the node has none
+ */
+const char* rift_ast_value(const rift_ast_t* ast, rift_ast_id_t node, size_t* length);
+
+/**
+ * rift_ast_hash - Structural hash of a subtree
+ * @ast: Owning AST
+ * @node: Node id
+ *
+ * Returns: Hash, equal for isomorphic subtrees in any two ASTs
+ */
+static inline uint64_t rift_ast_hash(const rift_ast_t* ast, rift_ast_id_t node) {
+    return node < ast->count ? ast->hashes[node] : 0;
+}
+
+/**
+ * rift_ast_find_difference - Compare two finalized trees
+ * @a: First AST
+ * @b: Second AST
+ * @node_a: Receives the differing node in a (optional)
+ * @node_b: Receives the matching position in b (optional)
+ *
+ * Equal root hashes settle it in O(1). Otherwise the walk follows the
+ * first child pair whose hashes differ down to the shallowest node
+ * whose own kind, value or child count differs, so only one path of
+ * the trees is visited.
+ *
+ * Returns: RIFT_SUCCESS if the trees are isomorphic,
+ *          RIFT_ERROR_VALIDATION_FAILED if they differ
+ */
+int rift_ast_find_difference(const rift_ast_t* a, const rift_ast_t* b,
+                             rift_ast_id_t* node_a, rift_ast_id_t* node_b);
+
+/**
+ * rift_ast_complexity - Node count of a finalized subtree
+ * @ast: Finalized AST
+ * @node: Node id
+ *
+ * Returns: Nodes in the subtree rooted at node, or 0 if not finalized
+ */
+static inline uint32_t rift_ast_complexity(const rift_ast_t* ast, rift_ast_id_t node) {
+    return ast->preorder && node < ast->count ? ast->subtree_end[node] - node : 0;
+}
+
+/*
+ * Shared AST Functions
+ */
+
+/**
+ * rift_ast_dag_init - Prepare an empty shared AST
+ * @dag: DAG to initialize
+ */
+void rift_ast_dag_init(rift_ast_dag_t* dag);
+
+/**
+ * rift_ast_dag_release - Free all shared nodes and values
+ * @dag: DAG to release; left empty and reusable
+ */
+void rift_ast_dag_release(rift_ast_dag_t* dag);
+
+/**
+ * rift_ast_dag_intern - Add a tree, sharing every repeated subtree
+ * @dag: Shared AST; may already hold other trees
+ * @tree: Finalized AST; left unchanged
+ * @root: Receives the DAG node for the tree's root
+ *
+ * Runs in one pass over the tree, deepest nodes first, with a hash
+ * probe per node. Values are re-interned into dag's arena, so the
+ * tree can be released afterwards.
+ *
+ * Returns: RIFT_SUCCESS on success, error code on failure
+ */
+int rift_ast_dag_intern(rift_ast_dag_t* dag, const rift_ast_t* tree, rift_ast_id_t* root);
+
+/**
+ * rift_ast_dag_children - Children of a shared node
+ * @dag: Shared AST
+ * @node: Node id
+ * @count: Receives the number of children
+ *
+ * Returns: The node's children in order, or NULL for a leaf
+ */
+static inline const rift_ast_id_t* rift_ast_dag_children(const rift_ast_dag_t* dag,
+                                                         rift_ast_id_t node, uint32_t* count) {
+    *count = dag->child_counts[node];
+    return *count > 0 ? dag->edges + dag->first_edge[node] : NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_CORE_STAGE_1_AST_H */
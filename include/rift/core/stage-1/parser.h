@@ -10,6 +10,7 @@
 
 #include "rift/core/common.h"
 #include "rift/core/stage-0/tokenizer.h"
+#include "rift/core/stage-1/ast.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -22,43 +23,62 @@ extern "C" {
 #define RIFT_PARSER_VERSION_MINOR 0
 #define RIFT_PARSER_VERSION_PATCH 0
 
-// AST Node Types
+// Parallel Parsing Limits
+#define RIFT_MAX_PARSER_THREADS 64
+#define RIFT_PARALLEL_MIN_TOKENS 4096
+
+// Expression Operators - generated from operators.def
+typedef enum {
+#define RIFT_OPERATOR(name, text, c0, c1, c2, binary, assoc, prefix) RIFT_OP_##name,
+#include "rift/core/stage-1/operators.def"
+#undef RIFT_OPERATOR
+    RIFT_OP_COUNT
+} rift_operator_t;
+
 typedef enum {
-    AST_NODE_PROGRAM,
-    AST_NODE_STATEMENT,
-    AST_NODE_EXPRESSION,
-    AST_NODE_DECLARATION,
-    AST_NODE_ASSIGNMENT,
-    AST_NODE_BINARY_OP,
-    AST_NODE_UNARY_OP,
-    AST_NODE_LITERAL,
-    AST_NODE_IDENTIFIER,
-    AST_NODE_FUNCTION_CALL,
-    AST_NODE_BLOCK,
-    AST_NODE_IF_STATEMENT,
-    AST_NODE_WHILE_LOOP,
-    AST_NODE_FOR_LOOP,
-    AST_NODE_RETURN_STATEMENT
-} rift_ast_node_type_t;
-
-// AST Node Structure
-typedef struct rift_ast_node {
-    rift_ast_node_type_t type;
-    char value[256];
-    size_t matched_state;
-    rift_source_location_t location;
-    struct rift_ast_node** children;
-    size_t child_count;
-    size_t child_capacity;
-    size_t complexity_score;
-} rift_ast_node_t;
+    RIFT_ASSOC_LEFT,
+    RIFT_ASSOC_RIGHT
+} rift_associativity_t;
+
+typedef struct {
+    const char* text;
+    uint8_t binary_precedence;        // 0: not an infix operator
+    uint8_t associativity;            // rift_associativity_t
+    uint8_t prefix_precedence;        // 0: not a prefix operator
+} rift_operator_info_t;
+
+extern const rift_operator_info_t rift_operator_table[RIFT_OP_COUNT];
+
+// Pending operator on the expression stack; RIFT_OP_COUNT marks '('
+typedef struct {
+    uint32_t offset;
+    uint8_t op;
+    bool prefix;
+} rift_pending_operator_t;
+
+// Expression Stacks - explicit, so nesting depth never touches the C stack
+typedef struct {
+    rift_ast_id_t* operands;
+    size_t operand_count;
+    size_t operand_capacity;
+    rift_pending_operator_t* operators;
+    size_t operator_count;
+    size_t operator_capacity;
+} rift_expression_stack_t;
 
 // Parser State Management
 typedef struct {
     const rift_token_t* tokens;
+    uint8_t* token_types;               // rift_token_type_t per token, owned
     size_t token_count;
     size_t current_position;
-    rift_ast_node_t* root;
+    rift_ast_t ast;                     // Preorder tree once processing succeeds
+    rift_expression_stack_t expression; // Reused by every expression
+    size_t thread_count;                // > 1 enables parallel top-level parsing
+    bool bottom_up;                     // Table-driven LALR(1) instead of descent
+    rift_ast_dag_t* dag;                // Optional: shared-subtree output
+    rift_ast_id_t dag_root;             // Program node in dag after processing
+    rift_tokenizer_state_t* tokenizer;  // Optional: resolves string literal values
     bool aegis_validation_enabled;
     rift_error_context_t error_context;
 } rift_parser_state_t;
@@ -73,11 +93,60 @@ typedef struct {
  * @token_count: Number of tokens
  * @state: Parser state to initialize
  * 
+ * Token types are copied into a byte array here, so the tokens must
+ * be complete. Release the state with rift_parser_cleanup.
+ * 
  * Returns: RIFT_SUCCESS on success, error code on failure
  */
 int rift_parser_init(const rift_token_t* tokens, size_t token_count,
                      rift_parser_state_t* state);
 
+/**
+ * rift_parser_set_tokenizer - Attach the tokenizer that produced the tokens
+ * @state: Initialized parser state
+ * @tokenizer: Tokenizer state (may be NULL)
+ *
+ * String tokens carry only a source span; with a tokenizer attached the
+ * parser decodes literal values as it builds expression nodes.
+ */
+void rift_parser_set_tokenizer(rift_parser_state_t* state,
+                               rift_tokenizer_state_t* tokenizer);
+
+/**
+ * rift_parser_set_threads - Parse top-level statements in parallel
+ * @state: Initialized parser state
+ * @thread_count: Worker threads including the caller; 0 or 1 is sequential
+ *
+ * Inputs below RIFT_PARALLEL_MIN_TOKENS are always parsed sequentially.
+ * The resulting AST is identical to a sequential parse.
+ */
+void rift_parser_set_threads(rift_parser_state_t* state, size_t thread_count);
+
+/**
+ * rift_parser_set_bottom_up - Select the table-driven LALR(1) parser
+ * @state: Initialized parser state
+ * @enabled: true for shift-reduce parsing, false for recursive descent
+ *
+ * The bottom-up parser runs over tables generated from stage-1.grammar
+ * and builds the same tree as the default parser. Its grammar is
+ * stricter: statements must be separated by ';', and tokens the
+ * grammar does not know are errors instead of being skipped. It
+ * always runs on the calling thread.
+ */
+void rift_parser_set_bottom_up(rift_parser_state_t* state, bool enabled);
+
+/**
+ * rift_parser_set_shared_output - Hash-cons parse results into a DAG
+ * @state: Initialized parser state
+ * @dag: Caller-owned shared AST, or NULL to keep the plain tree
+ *
+ * After a successful parse the tree is interned into dag, its root is
+ * stored in dag_root and the tree itself is released, so
+ * rift_parser_get_ast returns NULL. One dag can collect many parses;
+ * subtrees repeated within or across them are stored once.
+ */
+void rift_parser_set_shared_output(rift_parser_state_t* state, rift_ast_dag_t* dag);
+
 /**
  * rift_parser_process - Main parsing function
  * @state: Initialized parser state
@@ -93,48 +162,82 @@ int rift_parser_process(rift_parser_state_t* state);
 void rift_parser_cleanup(rift_parser_state_t* state);
 
 /**
- * rift_parser_get_ast - Get parsed AST root
- * @state: Parser state
- * 
- * Returns: Pointer to AST root node
+ * rift_parser_validate_consistency - Cross-check against the other parser
+ * @state: Parser state after a successful rift_parser_process
+ * @difference: Set to the first differing node of state's tree, or
+ *              RIFT_AST_NONE when the trees match (may be NULL)
+ *
+ * Parses the same tokens again with the other strategy (bottom-up if
+ * the state uses descent, and vice versa) and compares the trees by
+ * their Merkle hashes: matching trees cost one comparison, and a
+ * mismatch is located in time proportional to its depth.
+ *
+ * Only the language both parsers accept is compared. That is the one
+ * in stage-1.grammar: statements separated by ';', built from the
+ * grammar's terminals. The descent parser also accepts statements
+ * that simply follow each other and skips tokens it cannot start a
+ * statement with; for such input the grammar has no tree, so nothing
+ * is compared and state->error_context records why.
+ *
+ * Returns: RIFT_SUCCESS if the trees match or the input is outside the
+ *          grammar, RIFT_ERROR_VALIDATION_FAILED if they differ or the
+ *          descent parser rejects grammar input, or another error from
+ *          the second parse
  */
-const rift_ast_node_t* rift_parser_get_ast(const rift_parser_state_t* state);
+int rift_parser_validate_consistency(rift_parser_state_t* state, rift_ast_id_t* difference);
 
-/*
- * AST Node Management Functions
+/**
+ * rift_parser_get_ast - Get parsed AST
+ * @state: Parser state
+ * 
+ * The tree is in preorder with the program node at id 0.
+ * 
+ * Returns: Pointer to the AST, or NULL if nothing has been parsed
  */
+const rift_ast_t* rift_parser_get_ast(const rift_parser_state_t* state);
 
 /**
- * rift_ast_node_create - Create new AST node
- * @type: Node type
- * @value: Node value (optional)
- * 
- * Returns: Pointer to new AST node, or NULL on failure
+ * rift_operator_lookup - Classify an operator token
+ * @text: Operator token value
+ *
+ * Returns: Operator, or RIFT_OP_COUNT if the text is not an operator
  */
-rift_ast_node_t* rift_ast_node_create(rift_ast_node_type_t type, const char* value);
+rift_operator_t rift_operator_lookup(const char* text);
 
 /**
- * rift_ast_node_add_child - Add child node
- * @parent: Parent node
- * @child: Child node to add
- * 
- * Returns: RIFT_SUCCESS on success, error code on failure
+ * rift_parser_process_parallel - Parse with the configured thread count
+ * @state: Initialized parser state
+ *
+ * Splits the tokens at top-level ';' (bracket depth 0), parses each
+ * segment into its own AST on a work-stealing pool and appends the
+ * segments' statements to the program node in source order. Called
+ * by rift_parser_process; leaves a finalized AST in state->ast.
+ *
+ * Returns: RIFT_SUCCESS, or the error of the first failing segment
  */
-int rift_ast_node_add_child(rift_ast_node_t* parent, rift_ast_node_t* child);
+int rift_parser_process_parallel(rift_parser_state_t* state);
 
 /**
- * rift_ast_node_destroy - Destroy AST node and children
- * @node: Node to destroy
+ * rift_parser_process_bottom_up - Parse with the generated LALR(1) tables
+ * @state: Initialized parser state
+ *
+ * Classifies every token into a grammar terminal first, then runs a
+ * shift-reduce loop over that array with explicit state and value
+ * stacks. Called by rift_parser_process; leaves a finalized AST in
+ * state->ast.
+ *
+ * Returns: RIFT_SUCCESS, RIFT_ERROR_UNEXPECTED_TOKEN on a syntax error,
+ *          or RIFT_ERROR_MEMORY_ALLOCATION
  */
-void rift_ast_node_destroy(rift_ast_node_t* node);
+int rift_parser_process_bottom_up(rift_parser_state_t* state);
 
 /*
  * Parsing Strategy Functions
  */
 int rift_parse_program(rift_parser_state_t* state);
-int rift_parse_statement(rift_parser_state_t* state, rift_ast_node_t** result);
-int rift_parse_expression(rift_parser_state_t* state, rift_ast_node_t** result);
-int rift_parse_declaration(rift_parser_state_t* state, rift_ast_node_t** result);
+int rift_parse_statement(rift_parser_state_t* state, rift_ast_id_t* result);
+int rift_parse_expression(rift_parser_state_t* state, rift_ast_id_t* result);
+int rift_parse_declaration(rift_parser_state_t* state, rift_ast_id_t* result);
 
 #ifdef __cplusplus
 }
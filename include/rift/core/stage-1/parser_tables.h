@@ -0,0 +1,114 @@
+/*
+ * =================================================================
+ * GENERATED FILE - DO NOT EDIT
+ * Produced by rift_lalrgen from src/core/stage-1/stage-1.grammar
+ * LALR(1) tables: 91 states, 50 rules, 43 terminals, 6 nonterminals
+ * =================================================================
+ */
+
+#ifndef RIFT_CORE_STAGE_1_PARSER_TABLES_H
+#define RIFT_CORE_STAGE_1_PARSER_TABLES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Terminals; RIFT_LALR_T_END marks the end of input
+typedef enum {
+    RIFT_LALR_T_END,
+    RIFT_LALR_T_IDENTIFIER,
+    RIFT_LALR_T_INTEGER,
+    RIFT_LALR_T_FLOAT,
+    RIFT_LALR_T_STRING,
+    RIFT_LALR_T_LET,
+    RIFT_LALR_T_CONST,
+    RIFT_LALR_T_LPAREN,
+    RIFT_LALR_T_RPAREN,
+    RIFT_LALR_T_SEMICOLON,
+    RIFT_LALR_T_ASSIGN,
+    RIFT_LALR_T_ADD_ASSIGN,
+    RIFT_LALR_T_SUB_ASSIGN,
+    RIFT_LALR_T_MUL_ASSIGN,
+    RIFT_LALR_T_DIV_ASSIGN,
+    RIFT_LALR_T_MOD_ASSIGN,
+    RIFT_LALR_T_AND_ASSIGN,
+    RIFT_LALR_T_OR_ASSIGN,
+    RIFT_LALR_T_XOR_ASSIGN,
+    RIFT_LALR_T_SHL_ASSIGN,
+    RIFT_LALR_T_SHR_ASSIGN,
+    RIFT_LALR_T_LOGICAL_OR,
+    RIFT_LALR_T_LOGICAL_AND,
+    RIFT_LALR_T_BIT_OR,
+    RIFT_LALR_T_BIT_XOR,
+    RIFT_LALR_T_BIT_AND,
+    RIFT_LALR_T_EQ,
+    RIFT_LALR_T_NE,
+    RIFT_LALR_T_LT,
+    RIFT_LALR_T_LE,
+    RIFT_LALR_T_GT,
+    RIFT_LALR_T_GE,
+    RIFT_LALR_T_SHL,
+    RIFT_LALR_T_SHR,
+    RIFT_LALR_T_ADD,
+    RIFT_LALR_T_SUB,
+    RIFT_LALR_T_MUL,
+    RIFT_LALR_T_DIV,
+    RIFT_LALR_T_MOD,
+    RIFT_LALR_T_NOT,
+    RIFT_LALR_T_BIT_NOT,
+    RIFT_LALR_T_UNARY,
+    RIFT_LALR_T_POW,
+    RIFT_LALR_TERMINAL_COUNT
+} rift_lalr_terminal_t;
+
+// Reduction actions named in the grammar
+typedef enum {
+    RIFT_LALR_ACTION_NONE,
+    RIFT_LALR_ACTION_APPEND,
+    RIFT_LALR_ACTION_PASS,
+    RIFT_LALR_ACTION_DECLARE,
+    RIFT_LALR_ACTION_ASSIGN,
+    RIFT_LALR_ACTION_BINARY,
+    RIFT_LALR_ACTION_UNARY,
+    RIFT_LALR_ACTION_LEAF,
+    RIFT_LALR_ACTION_ACCEPT,
+} rift_lalr_action_t;
+
+typedef struct {
+    uint16_t lhs;                     // Nonterminal
+    uint8_t length;                   // Symbols popped
+    uint8_t action;                   // rift_lalr_action_t
+    uint8_t argument;                 // 1-based symbol position, 0 if none
+} rift_lalr_rule_t;
+
+#define RIFT_LALR_STATE_COUNT 91
+#define RIFT_LALR_RULE_COUNT 50
+#define RIFT_LALR_NONTERMINAL_COUNT 6
+#define RIFT_LALR_ACTION_TABLE_SIZE 1237
+#define RIFT_LALR_GOTO_TABLE_SIZE 91
+
+// i = action_base[state] + terminal; the entry is valid if
+// action_check[i] == state, else -default_reduction[state] applies.
+// > 0: shift to that state; < 0: reduce by rule -value - 1; 0: error
+extern const uint16_t rift_lalr_action_base[RIFT_LALR_STATE_COUNT];
+extern const uint16_t rift_lalr_action_check[RIFT_LALR_ACTION_TABLE_SIZE];
+extern const int16_t rift_lalr_action_value[RIFT_LALR_ACTION_TABLE_SIZE];
+extern const uint16_t rift_lalr_default_reduction[RIFT_LALR_STATE_COUNT];
+
+// i = goto_base[nonterminal] + state; valid if goto_check[i] ==
+// nonterminal, else goto_default[nonterminal]
+extern const uint16_t rift_lalr_goto_base[RIFT_LALR_NONTERMINAL_COUNT];
+extern const uint16_t rift_lalr_goto_check[RIFT_LALR_GOTO_TABLE_SIZE];
+extern const uint16_t rift_lalr_goto_value[RIFT_LALR_GOTO_TABLE_SIZE];
+extern const uint16_t rift_lalr_goto_default[RIFT_LALR_NONTERMINAL_COUNT];
+
+extern const rift_lalr_rule_t rift_lalr_rules[RIFT_LALR_RULE_COUNT];
+extern const char* const rift_lalr_terminal_names[RIFT_LALR_TERMINAL_COUNT];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_CORE_STAGE_1_PARSER_TABLES_H */
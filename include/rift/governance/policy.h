@@ -29,7 +29,8 @@ extern "C" {
 
 // Forward Declarations
 typedef struct rift_token rift_token_t;
-typedef struct rift_ast_node rift_ast_node_t;
+typedef struct rift_ast rift_ast_t;
+typedef uint32_t rift_ast_id_t;
 
 // Governance Policy Types
 typedef enum {
@@ -153,23 +154,25 @@ int rift_governance_validate_token_sequence(const rift_token_t* tokens,
 
 /**
  * rift_governance_validate_ast_node - Validate AST node
- * @node: AST node to validate
+ * @ast: AST containing the node
+ * @node: Node id to validate
  * 
  * Validates individual AST nodes against structural governance policies.
  * 
  * Returns: RIFT_SUCCESS if node is compliant, error code if violation detected
  */
-int rift_governance_validate_ast_node(const rift_ast_node_t* node);
+int rift_governance_validate_ast_node(const rift_ast_t* ast, rift_ast_id_t node);
 
 /**
  * rift_governance_validate_ast_tree - Validate complete AST
- * @root: Root node of AST to validate
+ * @ast: Finalized AST to validate
  * 
  * Performs comprehensive governance validation of entire AST structure.
+ * The tree is in preorder, so this is a linear scan over node ids.
  * 
  * Returns: RIFT_SUCCESS if AST is compliant, error code if violations detected
  */
-int rift_governance_validate_ast_tree(const rift_ast_node_t* root);
+int rift_governance_validate_ast_tree(const rift_ast_t* ast);
 
 /*
  * Memory Safety Governance
@@ -0,0 +1,46 @@
+# =================================================================
+# rift_lexgen.cmake - RIFT-0 Scanner Generation
+# RIFT: RIFT Is a Flexible Translator
+# Component: Build-time rule set -> direct-coded C scanner
+# OBINexus Computing Framework - Build Infrastructure
+# =================================================================
+
+include_guard(GLOBAL)
+
+set(RIFT_LEXGEN_SOURCE "${CMAKE_CURRENT_LIST_DIR}/../tools/rift_lexgen.c")
+set(RIFT_GENERATED_DIR "${CMAKE_BINARY_DIR}/generated/rift-0")
+
+# Host tool; never cross-compiled with the stage flags
+if(NOT TARGET rift_lexgen)
+    add_executable(rift_lexgen ${RIFT_LEXGEN_SOURCE})
+    set_target_properties(rift_lexgen PROPERTIES
+        C_STANDARD 11
+        RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/tools"
+    )
+endif()
+
+# =================================================================
+# Function: rift_generate_scanner
+# Purpose: Compile a rule file into a scanner source at build time
+# Parameters:
+#   RULES: Path to the .rules file
+#   PREFIX: Symbol prefix (emits <PREFIX>_scan)
+#   HEADER: Header included by the generated source
+#   OUTPUT_VAR: Receives the generated .c path
+#   ...: Extra rift_lexgen flags (--instrument, --dfa-profile FILE)
+# =================================================================
+function(rift_generate_scanner RULES PREFIX HEADER OUTPUT_VAR)
+    file(MAKE_DIRECTORY "${RIFT_GENERATED_DIR}")
+    set(GENERATED_SOURCE "${RIFT_GENERATED_DIR}/${PREFIX}_scanner.c")
+
+    add_custom_command(
+        OUTPUT "${GENERATED_SOURCE}"
+        COMMAND rift_lexgen "${RULES}" "${GENERATED_SOURCE}"
+                --prefix "${PREFIX}" --include "${HEADER}" ${ARGN}
+        DEPENDS rift_lexgen "${RULES}"
+        COMMENT "Generating ${PREFIX} scanner from ${RULES}"
+        VERBATIM
+    )
+
+    set(${OUTPUT_VAR} "${GENERATED_SOURCE}" PARENT_SCOPE)
+endfunction()
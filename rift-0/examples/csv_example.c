@@ -3,6 +3,7 @@
 #include <string.h>
 #include "tokenizer.h"
 #include "tokenizer_rules.h"
+#include "token_output.h"
 
 /**
  * RIFT-0 Lexeme Calculation Demonstration
@@ -37,50 +38,50 @@ static const char* test_expressions[] = {
 /**
  * Generate CSV header for token analysis
  */
-static void write_csv_header(FILE* output) {
-    fprintf(output, "Expression,Token_Index,Token_Type,Token_Value,Memory_Pointer,Character_Value,Token_Length\n");
+static void write_csv_header(OutputBuffer* output) {
+    rift_output_str(output, "Expression,Token_Index,Token_Type,Token_Value,Memory_Pointer,Character_Value,Token_Length\n");
 }
 
 /**
  * Export token to CSV format for systematic analysis
  */
-static void write_token_csv(FILE* output, const char* expression, 
+static void write_token_csv(OutputBuffer* output, const char* expression, 
                            size_t token_index, const TokenTriplet* token,
                            const char* source_text) {
-    // Extract token text from source
-    char token_text[256] = {0};
     size_t token_length = (token->value > 0) ? token->value : 1;
+    size_t source_length = strlen(source_text);
+    const char* type_name = get_token_type_name(token->type);
     
-    if (token->mem_ptr < strlen(source_text)) {
-        size_t copy_length = (token_length < sizeof(token_text) - 1) ? 
-                            token_length : sizeof(token_text) - 1;
-        strncpy(token_text, source_text + token->mem_ptr, copy_length);
-        token_text[copy_length] = '\0';
-        
-        // Escape quotes in CSV
-        for (size_t i = 0; i < strlen(token_text); i++) {
-            if (token_text[i] == '"') {
-                token_text[i] = '\'';
-            }
-        }
+    rift_output_csv_field(output, expression, strlen(expression));
+    rift_output_char(output, ',');
+    rift_output_u64(output, token_index);
+    rift_output_char(output, ',');
+    rift_output_csv_field(output, type_name, strlen(type_name));
+    rift_output_char(output, ',');
+    
+    // Extract token text from source; quotes are doubled, not replaced
+    if (token->mem_ptr < source_length) {
+        size_t copy_length = source_length - token->mem_ptr;
+        if (copy_length > token_length) copy_length = token_length;
+        if (copy_length > 255) copy_length = 255;
+        rift_output_csv_field(output, source_text + token->mem_ptr, copy_length);
     } else {
-        strcpy(token_text, "EOF");
+        rift_output_csv_field(output, "EOF", 3);
     }
     
-    fprintf(output, "\"%s\",%zu,\"%s\",\"%s\",%u,%u,%zu\n",
-            expression,
-            token_index,
-            get_token_type_name(token->type),
-            token_text,
-            token->mem_ptr,
-            token->value,
-            token_length);
+    rift_output_char(output, ',');
+    rift_output_u64(output, token->mem_ptr);
+    rift_output_char(output, ',');
+    rift_output_u64(output, token->value);
+    rift_output_char(output, ',');
+    rift_output_u64(output, token_length);
+    rift_output_char(output, '\n');
 }
 
 /**
  * Process single expression with comprehensive diagnostics
  */
-static int process_expression(const char* expression, FILE* csv_output) {
+static int process_expression(const char* expression, OutputBuffer* csv_output) {
     printf("\n=== Processing Expression: \"%s\" ===\n", expression);
     
     // Allocate token buffer (generous size for demonstration)
@@ -209,11 +210,14 @@ int main(void) {
     
     // Phase 2: Open CSV output for systematic analysis
     printf("\nPhase 2: CSV Export Preparation\n");
-    FILE* csv_output = fopen("lexem_analysis_results.csv", "w");
-    if (!csv_output) {
+    FILE* csv_file = fopen("lexem_analysis_results.csv", "w");
+    OutputBuffer csv_buffer;
+    OutputBuffer* csv_output = NULL;
+    if (!csv_file || !rift_output_init(&csv_buffer, fileno(csv_file), RIFT_OUTPUT_BUFFER_SIZE)) {
         fprintf(stderr, "WARNING: Could not create CSV output file\n");
         printf("Continuing without CSV export...\n");
     } else {
+        csv_output = &csv_buffer;
         write_csv_header(csv_output);
         printf("✓ CSV output file created: lexem_analysis_results.csv\n");
     }
@@ -232,7 +236,13 @@ int main(void) {
     // Phase 5: Systematic cleanup
     printf("\nPhase 5: Resource Cleanup\n");
     if (csv_output) {
-        fclose(csv_output);
+        if (!rift_output_flush(csv_output)) {
+            fprintf(stderr, "WARNING: CSV output incomplete\n");
+        }
+        rift_output_destroy(csv_output);
+    }
+    if (csv_file) {
+        fclose(csv_file);
         printf("✓ CSV output file finalized\n");
     }
     
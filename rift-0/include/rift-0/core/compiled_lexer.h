@@ -0,0 +1,198 @@
+/*
+ * =================================================================
+ * compiled_lexer.h - RIFT-0 Shared Compiled Lexer Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Immutable rule tables and per-thread scanner cursors
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.ISOLATE(CompiledRules, ScanState)
+ * R.FLAGS(immutable, ref_counted, lock_free)
+ *
+ * A CompiledLexer is never mutated after rift_lexer_compile returns,
+ * so any number of threads may scan with one instance concurrently
+ * without locking. All mutable scan state lives in a LexerCursor,
+ * which is owned by exactly one thread.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_COMPILED_LEXER_H
+#define RIFT_0_CORE_COMPILED_LEXER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/tokenizer_types.h"
+
+/* =================================================================
+ * CONSTANTS
+ * =================================================================
+ */
+
+#define RIFT_LEXER_MAX_RULES            256
+#define RIFT_LEXER_DEFAULT_CAPACITY     1024
+#define RIFT_LEXER_ERROR_MAX            256
+
+/* =================================================================
+ * TYPES
+ * =================================================================
+ */
+
+/* Opaque, immutable, reference-counted rule set */
+typedef struct CompiledLexer CompiledLexer;
+
+/* Byte extent of a token in its source buffer */
+typedef struct TokenSpan {
+    uint32_t offset;
+    uint32_t length;
+} TokenSpan;
+
+/* Rule description consumed by rift_lexer_compile */
+typedef struct {
+    const char* name;               /* Diagnostic name */
+    const char* pattern;            /* Literal pattern (rift_regex_compile) */
+    TokenType type;                 /* Token type emitted on match */
+    TokenFlags flags;               /* TOKEN_FLAG_IGNORECASE honoured */
+} LexerRuleSpec;
+
+/* Longest-match scan function (generated scanners share this shape) */
+typedef size_t (*RiftScanFn)(const unsigned char* cursor,
+                             const unsigned char* limit,
+                             TokenType* out_type);
+
+/**
+ * Static literal DFA
+ * Read-only transition tables, e.g. emitted at compile time by the C++
+ * rift::lexer front-end (rift-0/core/lexer.hpp). State 0 is the dead
+ * state and state 1 the start state; accept holds the TokenType a state
+ * accepts, or TOKEN_UNKNOWN. The engine borrows the tables, never copies.
+ */
+#define RIFT_DFA_DEAD_STATE     0
+#define RIFT_DFA_START_STATE    1
+
+typedef struct {
+    uint32_t state_count;
+    const uint16_t* transitions;    /* state_count * 256 next states */
+    const uint8_t* accept;          /* state_count TokenType values */
+} RiftDfaTable;
+
+/* Per-thread scan state; never shared between threads */
+typedef struct {
+    const CompiledLexer* lexer;     /* Retained shared rule set */
+
+    const char* input;              /* Borrowed input view */
+    size_t input_length;
+    size_t position;                /* Next unscanned byte */
+
+    TokenTriplet* tokens;           /* Cursor-owned output */
+    TokenSpan* spans;               /* Parallel byte extents */
+    size_t token_count;
+    size_t token_capacity;
+
+    bool has_error;
+    char error_message[RIFT_LEXER_ERROR_MAX];
+} LexerCursor;
+
+/* =================================================================
+ * COMPILED LEXER API
+ * =================================================================
+ */
+
+/**
+ * Compile rule specs layered over the generated default scanner
+ * R.COMPILE(LexerRuleSpec[]) -> CompiledLexer (ref_count = 1)
+ *
+ * A rule spec match wins over the default rules when it is at least
+ * as long, which lets keyword literals override identifiers.
+ */
+const CompiledLexer* rift_lexer_compile(const LexerRuleSpec* rules, size_t rule_count);
+
+/**
+ * Layer a static literal DFA over the generated default scanner
+ * R.COMPILE(RiftDfaTable) -> CompiledLexer borrowing the tables
+ *
+ * Same precedence as rule specs: a table match wins when at least as
+ * long as the default match. The tables must outlive the lexer.
+ */
+const CompiledLexer* rift_lexer_from_table(const RiftDfaTable* table);
+
+/**
+ * Shared default lexer (generated scanner only); never freed
+ */
+const CompiledLexer* rift_lexer_default(void);
+
+/**
+ * Default lexer over the instrumented scanner; never freed
+ * R.PROFILE() -> CompiledLexer feeding rift_default_profiled_counters
+ *
+ * Same tokens as rift_lexer_default, slower; see dfa_profile.h.
+ */
+const CompiledLexer* rift_lexer_profiling(void);
+
+const CompiledLexer* rift_lexer_retain(const CompiledLexer* lexer);
+void rift_lexer_release(const CompiledLexer* lexer);
+
+/**
+ * Match one token at cursor without touching any shared state
+ * R.MATCH(CompiledLexer, cursor, limit) -> (length, TokenType)
+ *
+ * Returns 0 when nothing matches.
+ */
+size_t rift_lexer_match(const CompiledLexer* lexer,
+                        const unsigned char* cursor,
+                        const unsigned char* limit,
+                        TokenType* out_type);
+
+/**
+ * Match with the default rules and a static table, no CompiledLexer
+ * R.MATCH(RiftDfaTable, cursor, limit) -> (length, TokenType)
+ *
+ * Performs no allocation; this is what rift::lexer scans with.
+ */
+size_t rift_lexer_match_static(const RiftDfaTable* table,
+                               const unsigned char* cursor,
+                               const unsigned char* limit,
+                               TokenType* out_type);
+
+/* Longest match in a static table alone; 0 when nothing matches */
+size_t rift_dfa_table_scan(const RiftDfaTable* table,
+                           const unsigned char* cursor,
+                           const unsigned char* limit,
+                           TokenType* out_type);
+
+size_t rift_lexer_rule_count(const CompiledLexer* lexer);
+size_t rift_lexer_dfa_state_count(const CompiledLexer* lexer);
+
+/* =================================================================
+ * SCANNER CURSOR API
+ * =================================================================
+ */
+
+/*
+ * The cursor is the raw layer: it yields whitespace and comment tokens,
+ * does not validate UTF-8 and converts no literals. rift_tokenizer_process
+ * and rift_tokenizer_process_batch add those steps on top.
+ */
+
+bool rift_cursor_init(LexerCursor* cursor, const CompiledLexer* lexer,
+                      size_t initial_capacity);
+void rift_cursor_destroy(LexerCursor* cursor);
+
+/* Borrow input (not copied) and rewind; token buffers are kept */
+void rift_cursor_set_input(LexerCursor* cursor, const char* input, size_t length);
+
+/**
+ * Scan a single token; returns false at end of input
+ */
+bool rift_cursor_next(LexerCursor* cursor, TokenTriplet* out_token, TokenSpan* out_span);
+
+/**
+ * Scan all remaining input into the cursor's token buffer, EOF-terminated
+ */
+bool rift_cursor_scan(LexerCursor* cursor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_COMPILED_LEXER_H */
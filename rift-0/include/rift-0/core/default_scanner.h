@@ -0,0 +1,51 @@
+/*
+ * =================================================================
+ * default_scanner.h - RIFT-0 Generated Default Scanner Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Direct-coded scanner generated from rules/default.rules
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.GENERATE(default.rules) -> rift_lexgen -> default_scanner.c
+ *
+ * The implementation is produced at build time by tools/rift_lexgen.c
+ * (see cmake/rift_lexgen.cmake and the Makefile `generate` target).
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_DEFAULT_SCANNER_H
+#define RIFT_0_CORE_DEFAULT_SCANNER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/tokenizer_types.h"
+
+/**
+ * Match the longest default-rule token starting at cursor
+ * R.SCAN(cursor, limit) -> (length, TokenType)
+ *
+ * Returns the match length in bytes, or 0 when no rule matches at
+ * cursor. out_type receives the winning rule's token type.
+ */
+size_t rift_default_scan(const unsigned char* cursor, const unsigned char* limit,
+                         TokenType* out_type);
+
+/* Number of states in the minimized default DFA */
+extern const size_t rift_default_dfa_state_count;
+
+/**
+ * Instrumented twin of rift_default_scan over the same DFA
+ * R.PROFILE(cursor, limit) -> (length, TokenType) + visit counts
+ *
+ * Returns exactly what rift_default_scan returns, and adds each state
+ * entry and transition to rift_default_profiled_counters (dfa_profile.h).
+ */
+size_t rift_default_profiled_scan(const unsigned char* cursor, const unsigned char* limit,
+                                  TokenType* out_type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_DEFAULT_SCANNER_H */
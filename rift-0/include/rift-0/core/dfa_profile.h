@@ -0,0 +1,79 @@
+/*
+ * =================================================================
+ * dfa_profile.h - RIFT-0 DFA State Visit Profiling Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Profile-guided state layout for the generated scanner
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.PROFILE(corpus) -> state/transition visit counts -> profile file
+ * R.FLAGS(instrumented_twin, mergeable, build_time_layout)
+ *
+ * The build generates an instrumented twin of the default scanner
+ * (rift_default_profiled_scan) that counts every state entry and every
+ * taken transition. Scanning a corpus with rift_lexer_profiling() and
+ * saving the counts gives a profile that rift_lexgen --dfa-profile
+ * reads on the next build to place hot states next to each other and
+ * to specialize hot self-loops. States are identified by their number
+ * in the minimized DFA, which is stable for a given rule file; the
+ * fingerprint rejects profiles taken from a different DFA.
+ *
+ * Profile file format (text; lines in any order, counts are summed):
+ *
+ *     fingerprint <16 hex digits>
+ *     states <count>
+ *     state <id> <visits>
+ *     edge <from> <to> <count>
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_DFA_PROFILE_H
+#define RIFT_0_CORE_DFA_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Counters owned by an instrumented generated scanner */
+typedef struct {
+    uint64_t fingerprint;           /* Hash of the minimized DFA */
+    uint32_t state_count;
+    uint32_t edge_count;            /* Distinct (from, to) transitions */
+    const uint16_t* edge_from;
+    const uint16_t* edge_to;
+    uint64_t* state_visits;         /* state_count entries */
+    uint64_t* edge_visits;          /* edge_count entries */
+} RiftDfaProfileCounters;
+
+/* Counters of the instrumented default scanner */
+extern const RiftDfaProfileCounters rift_default_profiled_counters;
+
+/**
+ * Zero a scanner's counters
+ * R.RESET(RiftDfaProfileCounters) -> all visits 0
+ *
+ * The counters are plain globals: profile from one thread at a time.
+ */
+void rift_dfa_profile_reset(const RiftDfaProfileCounters* counters);
+
+/**
+ * Write counters to a profile file, merging any profile already there
+ * R.SAVE(counters, path) -> bool
+ *
+ * An existing profile for the same fingerprint is added to, so a corpus
+ * can be profiled one file per run. A profile for a different DFA is
+ * replaced. Returns false on I/O errors or a malformed existing file.
+ */
+bool rift_dfa_profile_save(const RiftDfaProfileCounters* counters, const char* path);
+
+/* Sum of state visits; 0 when nothing was scanned */
+uint64_t rift_dfa_profile_total(const RiftDfaProfileCounters* counters);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_DFA_PROFILE_H */
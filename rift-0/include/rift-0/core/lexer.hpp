@@ -0,0 +1,277 @@
+/*
+ * =================================================================
+ * lexer.hpp - RIFT-0 Compile-Time C++ Lexer Front-End
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: constexpr literal DFA over the rift-0 C engine
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.COMPILE(rule<Pattern, Type, Flags>...) -> static RiftDfaTable
+ * R.FLAGS(header_only, constexpr_tables, zero_allocation)
+ *
+ * Usage:
+ *   using sql = rift::lexer<rift::rule<"select", TOKEN_KEYWORD, TOKEN_FLAG_IGNORECASE>,
+ *                           rift::rule<"from", TOKEN_KEYWORD>>;
+ *   auto stream = sql::scan(source);
+ *   for (rift::token t; stream.next(t);) { ... t.text ... }
+ *
+ * The literal rules are determinized while the translation unit is
+ * compiled; the tables live in static storage and are layered over the
+ * generated default scanner with the same precedence as rift_lexer_compile
+ * (a literal wins when at least as long). Requires C++20.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_LEXER_HPP
+#define RIFT_0_CORE_LEXER_HPP
+
+#if __cplusplus < 202002L
+#error "rift-0/core/lexer.hpp requires C++20 (string literal template arguments)"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/utf8.h"
+
+namespace rift {
+
+/* =================================================================
+ * RULES
+ * =================================================================
+ */
+
+/* String literal usable as a template argument */
+template <std::size_t N>
+struct fixed_string {
+    char value[N] {};
+
+    constexpr fixed_string(const char (&text)[N]) {
+        for (std::size_t i = 0; i < N; ++i) {
+            value[i] = text[i];
+        }
+    }
+
+    constexpr std::string_view view() const { return {value, N - 1}; }
+};
+
+/* One literal rule; only TOKEN_FLAG_IGNORECASE affects matching */
+template <fixed_string Pattern, TokenType Type, unsigned Flags = TOKEN_FLAG_NONE>
+struct rule {
+    static_assert(Pattern.view().size() > 0, "rift::rule pattern must not be empty");
+    static_assert(Type != TOKEN_UNKNOWN && Type <= 0xFF, "rift::rule type must fit a DFA accept slot");
+
+    static constexpr std::string_view pattern = Pattern.view();
+    static constexpr TokenType type = Type;
+    static constexpr bool ignore_case = (Flags & TOKEN_FLAG_IGNORECASE) != 0;
+};
+
+/* Token as a view into the scanned input */
+struct token {
+    TokenType type = TOKEN_UNKNOWN;
+    std::string_view text;
+    std::size_t offset = 0;
+};
+
+/* =================================================================
+ * CONSTEXPR DFA CONSTRUCTION
+ * =================================================================
+ */
+
+namespace detail {
+
+/* Reached only if the state bound is wrong; not constexpr, so it fails the build */
+void dfa_state_bound_exceeded();
+
+constexpr unsigned char fold(unsigned char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<unsigned char>(c - 32) : c;
+}
+
+template <std::size_t R>
+struct rule_set {
+    std::array<std::string_view, R> patterns;
+    std::array<TokenType, R> types;
+    std::array<bool, R> ignore_case;
+
+    constexpr bool accepts(std::size_t r, std::size_t depth, unsigned char c) const {
+        const auto expected = static_cast<unsigned char>(patterns[r][depth]);
+        return expected == c || (ignore_case[r] && fold(expected) == fold(c));
+    }
+};
+
+template <std::size_t S>
+struct dfa_tables {
+    std::array<std::uint16_t, S * 256> transitions {};
+    std::array<std::uint8_t, S> accept {};
+    std::uint32_t used = 0;
+};
+
+/*
+ * Subset construction over per-rule literal chains. A DFA state is the
+ * set of rules whose first `depth` bytes match the input so far, which
+ * keeps exact and case-folded rules with a shared prefix apart. Each
+ * state's set is a subset of rules at one depth, so at most
+ * 2 + sum(pattern lengths) states exist.
+ */
+template <std::size_t S, std::size_t R>
+constexpr dfa_tables<S> build_dfa(const rule_set<R>& rules) {
+    using rule_bits = std::array<std::uint64_t, (R + 63) / 64>;
+    auto has = [](const rule_bits& bits, std::size_t r) {
+        return (bits[r / 64] >> (r % 64)) & 1u;
+    };
+
+    dfa_tables<S> out {};
+    std::array<rule_bits, S> sets {};
+    std::array<std::size_t, S> depth {};
+
+    for (std::size_t r = 0; r < R; ++r) {
+        sets[RIFT_DFA_START_STATE][r / 64] |= std::uint64_t {1} << (r % 64);
+    }
+    out.used = RIFT_DFA_START_STATE + 1;
+
+    for (std::uint32_t state = RIFT_DFA_START_STATE; state < out.used; ++state) {
+        const std::size_t k = depth[state];
+
+        /* Earliest rule ending here wins, as with rule specs */
+        for (std::size_t r = 0; r < R; ++r) {
+            if (has(sets[state], r) && rules.patterns[r].size() == k) {
+                out.accept[state] = static_cast<std::uint8_t>(rules.types[r]);
+                break;
+            }
+        }
+
+        /* Only bytes some member rule can take next */
+        for (std::size_t r = 0; r < R; ++r) {
+            if (!has(sets[state], r) || rules.patterns[r].size() <= k) {
+                continue;
+            }
+            const auto c = static_cast<unsigned char>(rules.patterns[r][k]);
+            const unsigned char upper = fold(c);
+            const auto lower = static_cast<unsigned char>(upper >= 'A' && upper <= 'Z' ? upper + 32 : upper);
+            const unsigned char variants[2] = {c, rules.ignore_case[r] ? (c == upper ? lower : upper) : c};
+            for (unsigned char v : variants) {
+                std::uint16_t& slot = out.transitions[std::size_t {state} * 256 + v];
+                if (slot != RIFT_DFA_DEAD_STATE) {
+                    continue;
+                }
+
+                rule_bits next {};
+                for (std::size_t q = 0; q < R; ++q) {
+                    if (has(sets[state], q) && rules.patterns[q].size() > k && rules.accepts(q, k, v)) {
+                        next[q / 64] |= std::uint64_t {1} << (q % 64);
+                    }
+                }
+
+                std::uint32_t target = RIFT_DFA_DEAD_STATE;
+                for (std::uint32_t s = RIFT_DFA_START_STATE + 1; s < out.used; ++s) {
+                    if (depth[s] == k + 1 && sets[s] == next) {
+                        target = s;
+                        break;
+                    }
+                }
+                if (target == RIFT_DFA_DEAD_STATE) {
+                    if (out.used >= S) {
+                        dfa_state_bound_exceeded();
+                    }
+                    target = out.used++;
+                    sets[target] = next;
+                    depth[target] = k + 1;
+                }
+                slot = static_cast<std::uint16_t>(target);
+            }
+        }
+    }
+    return out;
+}
+
+} // namespace detail
+
+/* =================================================================
+ * LEXER
+ * =================================================================
+ */
+
+template <typename... Rules>
+class lexer {
+    static_assert(sizeof...(Rules) > 0, "rift::lexer needs at least one rule");
+
+    static constexpr detail::rule_set<sizeof...(Rules)> rules_ {
+        {Rules::pattern...}, {Rules::type...}, {Rules::ignore_case...}};
+
+    static constexpr std::size_t state_bound_ = 2 + (Rules::pattern.size() + ...);
+    static_assert(state_bound_ <= 0xFFFF, "rift::lexer rules exceed 16-bit state ids");
+
+    /* First pass sizes the tables; the second emits them at exact size */
+    static constexpr std::size_t state_count_ = detail::build_dfa<state_bound_>(rules_).used;
+    static constexpr detail::dfa_tables<state_count_> tables_ = detail::build_dfa<state_count_>(rules_);
+
+    static constexpr RiftDfaTable table_ {
+        static_cast<std::uint32_t>(state_count_), tables_.transitions.data(), tables_.accept.data()};
+
+public:
+    /* Static tables for the C engine (rift_lexer_match_static, rift_lexer_from_table) */
+    static constexpr const RiftDfaTable& table() noexcept { return table_; }
+    static constexpr std::size_t state_count() noexcept { return state_count_; }
+
+    /* Longest literal-rule match at the start of text; usable in constant expressions */
+    static constexpr token match_literal(std::string_view text) noexcept {
+        std::uint32_t state = RIFT_DFA_START_STATE;
+        token best {};
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            state = tables_.transitions[std::size_t {state} * 256 + static_cast<unsigned char>(text[i])];
+            if (state == RIFT_DFA_DEAD_STATE) {
+                break;
+            }
+            if (tables_.accept[state] != TOKEN_UNKNOWN) {
+                best = token {static_cast<TokenType>(tables_.accept[state]), text.substr(0, i + 1), 0};
+            }
+        }
+        return best;
+    }
+
+    /* Significant-token stream over borrowed input; never allocates */
+    class stream {
+    public:
+        explicit stream(std::string_view input) noexcept : input_(input) {}
+
+        bool next(token& out) noexcept {
+            const auto* base = reinterpret_cast<const unsigned char*>(input_.data());
+            while (position_ < input_.size()) {
+                TokenType type = TOKEN_UNKNOWN;
+                std::size_t length = rift_lexer_match_static(
+                    &table_, base + position_, base + input_.size(), &type);
+                if (length == 0) {
+                    type = TOKEN_UNKNOWN;
+                    length = rift_utf8_sequence_length(base + position_, base + input_.size());
+                }
+
+                const std::size_t offset = position_;
+                position_ += length;
+                if (type == TOKEN_WHITESPACE || type == TOKEN_COMMENT) {
+                    continue;
+                }
+                out = token {type, input_.substr(offset, length), offset};
+                return true;
+            }
+            return false;
+        }
+
+        std::size_t position() const noexcept { return position_; }
+
+    private:
+        std::string_view input_;
+        std::size_t position_ = 0;
+    };
+
+    /* Input must be well-formed UTF-8 (see rift_utf8_validate) */
+    static stream scan(std::string_view input) noexcept { return stream(input); }
+
+    /* Shared CompiledLexer over the static tables, for TokenizerContext users */
+    static const CompiledLexer* compile() noexcept { return rift_lexer_from_table(&table_); }
+};
+
+} // namespace rift
+
+#endif /* RIFT_0_CORE_LEXER_HPP */
@@ -0,0 +1,93 @@
+/*
+ * =================================================================
+ * lexer_slot.h - RIFT-0 Hot-Swappable Lexer Generations
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Atomic publication and epoch reclamation of rule sets
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.PUBLISH(CompiledLexer) -> generation N+1, generation N retired
+ * R.FLAGS(atomic_swap, epoch_reclaim, wait_free_readers)
+ *
+ * A slot holds the current CompiledLexer generation of a long-running
+ * service. A new rule set is compiled off to the side and published
+ * with one atomic pointer swap; workers never pause. Each worker owns
+ * a reader record and brackets its use of the slot's lexer with
+ * enter/exit. A replaced generation is retired with the epoch it was
+ * replaced in and released once every reader active in that epoch has
+ * exited, so no scan ever sees a freed lexer.
+ *
+ *     int reader = rift_lexer_slot_register(slot);
+ *     const CompiledLexer* lexer = rift_lexer_slot_enter(slot, reader);
+ *     ... scan with lexer, or rift_tokenizer_set_lexer() to keep it ...
+ *     rift_lexer_slot_exit(slot, reader);
+ *
+ * Scans that outlive exit must hold their own reference (retain, or
+ * bind to a TokenizerContext, which retains).
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_LEXER_SLOT_H
+#define RIFT_0_CORE_LEXER_SLOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/compiled_lexer.h"
+
+#define RIFT_LEXER_SLOT_MAX_READERS     64
+#define RIFT_LEXER_SLOT_NO_READER       (-1)
+
+typedef struct RiftLexerSlot RiftLexerSlot;
+
+/**
+ * Create a slot holding its first generation
+ * R.CREATE(CompiledLexer) -> RiftLexerSlot (generation 1)
+ *
+ * The slot takes its own reference; NULL selects the default lexer.
+ */
+RiftLexerSlot* rift_lexer_slot_create(const CompiledLexer* initial);
+
+/* Releases every generation; no reader may be inside the slot */
+void rift_lexer_slot_destroy(RiftLexerSlot* slot);
+
+/**
+ * Claim a reader record for the calling thread
+ * R.REGISTER(RiftLexerSlot) -> reader id, or RIFT_LEXER_SLOT_NO_READER
+ */
+int rift_lexer_slot_register(RiftLexerSlot* slot);
+void rift_lexer_slot_unregister(RiftLexerSlot* slot, int reader);
+
+/**
+ * Pin the current generation until exit
+ * R.ENTER(RiftLexerSlot, reader) -> CompiledLexer
+ *
+ * Wait-free: two stores and two loads, no lock and no reference count.
+ */
+const CompiledLexer* rift_lexer_slot_enter(RiftLexerSlot* slot, int reader);
+void rift_lexer_slot_exit(RiftLexerSlot* slot, int reader);
+
+/**
+ * Publish a new generation
+ * R.PUBLISH(RiftLexerSlot, CompiledLexer) -> generation number
+ *
+ * Takes its own reference to lexer and never waits for readers: the
+ * replaced generation is retired and released by this or a later
+ * publish/reclaim once quiescent. Returns 0 on failure.
+ */
+uint64_t rift_lexer_slot_publish(RiftLexerSlot* slot, const CompiledLexer* lexer);
+
+/**
+ * Release retired generations no reader can still see
+ * R.RECLAIM(RiftLexerSlot) -> generations still awaiting quiescence
+ */
+size_t rift_lexer_slot_reclaim(RiftLexerSlot* slot);
+
+/* Number of the current generation (1 after create) */
+uint64_t rift_lexer_slot_generation(const RiftLexerSlot* slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_LEXER_SLOT_H */
@@ -0,0 +1,57 @@
+/*
+ * =================================================================
+ * number_parse.h - RIFT-0 Numeric Literal Conversion Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Lex-time integer and floating-point conversion
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.CONVERT(lexeme) -> RiftNumber (uint64 or correctly rounded double)
+ * R.FLAGS(eisel_lemire, clinger_fast_path, strtod_fallback)
+ *
+ * Accepts decimal integers and floats ("1_000", "6.02e23"), hex
+ * ("0xFF_FF") and binary ("0b1010"). '_' separators are skipped.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_NUMBER_PARSE_H
+#define RIFT_0_CORE_NUMBER_PARSE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    RIFT_NUMBER_INVALID = 0,
+    RIFT_NUMBER_INTEGER,            /* Fits uint64_t */
+    RIFT_NUMBER_FLOAT               /* Fraction, exponent or decimal overflow */
+} RiftNumberKind;
+
+typedef struct {
+    RiftNumberKind kind;
+    union {
+        uint64_t integer;
+        double real;
+    } as;
+} RiftNumber;
+
+/**
+ * Convert a numeric lexeme
+ * R.CONVERT(text, length) -> RiftNumber
+ *
+ * Decimal floats take the exact double fast path when possible, then
+ * Eisel-Lemire, and strtod only when Eisel-Lemire cannot decide the
+ * rounding. Decimal integers beyond uint64_t become floats; hex and
+ * binary overflow is rejected. A '_' separator must sit between two
+ * digits ("1_000", not "1_", "0x_1" or "1_.5").
+ */
+bool rift_number_parse(const char* text, size_t length, RiftNumber* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_NUMBER_PARSE_H */
@@ -0,0 +1,71 @@
+/*
+ * =================================================================
+ * raw_string.h - RIFT-0 Raw String Literal Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: R"delim(...)delim" and R-pattern literal scanning
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.SCAN(R"delim(body)delim"flags) -> Zero-copy body span
+ * R.FLAGS(simd_paren_search, delimiter_memcmp)
+ *
+ * A raw literal closes at the first ')' followed by its delimiter and
+ * quote; that backreference is outside what a DFA rule can express, so
+ * rift_lexer_match calls this scanner before the generated one.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_RAW_STRING_H
+#define RIFT_0_CORE_RAW_STRING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rift-0/core/tokenizer_types.h"
+
+#define RIFT_RAW_DELIMITER_MAX 16   /* Same limit as C++ raw strings */
+
+/**
+ * Raw String Layout
+ * All offsets are relative to the leading 'R'; nothing is copied.
+ */
+typedef struct {
+    char quote;                     /* '"' or '\'' */
+    size_t delimiter_offset;
+    size_t delimiter_length;
+    size_t body_offset;
+    size_t body_length;
+    size_t suffix_offset;           /* Pattern flag letters [gmitb]* */
+    size_t suffix_length;
+    size_t length;                  /* Whole literal */
+} RiftRawString;
+
+/**
+ * Scan a raw literal starting at data[0] == 'R'
+ * R.SCAN(data, length) -> Literal length, 0 if absent or unterminated
+ *
+ * The body is searched 16 bytes at a time for ')' and each candidate
+ * is confirmed with one memcmp against the delimiter, so the cost is a
+ * single pass over the body regardless of delimiter length.
+ */
+size_t rift_raw_string_scan(const char* data, size_t length, RiftRawString* out);
+
+/**
+ * Recover the layout of an already scanned literal
+ * R.SPLIT(literal, length) -> Layout without touching the body
+ *
+ * Only the delimiter, quote and suffix are read, from both ends.
+ */
+bool rift_raw_string_split(const char* literal, size_t length, RiftRawString* out);
+
+/* Map suffix letters (g, m, i, t, b) to TokenFlags */
+TokenFlags rift_raw_string_flags(const char* suffix, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_RAW_STRING_H */
@@ -0,0 +1,92 @@
+/*
+ * =================================================================
+ * token_batch.h - RIFT-0 Batch Tokenization Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Many small inputs -> one shared token arena
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.BATCH(inputs[], lengths[]) -> TokenBatch { arena, offsets }
+ * R.FLAGS(interleaved, arena_backed, shardable)
+ *
+ * Tokens for input i occupy [offsets[i], offsets[i + 1]) of the
+ * shared arena; spans and mem_ptr are relative to that input. No
+ * per-input EOF token is emitted: the offsets index delimits inputs.
+ *
+ * Each slice is what rift_tokenizer_process produces for that input
+ * without its EOF: inputs must be well-formed UTF-8, whitespace and
+ * comments are dropped, and numeric literals are converted into the
+ * batch's constant table. LexerCursor, by contrast, is the raw layer
+ * and yields trivia tokens unvalidated.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_TOKEN_BATCH_H
+#define RIFT_0_CORE_TOKEN_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/tokenizer.h"
+
+/* Inputs scanned in lockstep by one thread */
+#define RIFT_BATCH_INTERLEAVE   4
+
+/* Shared output arena, reusable across calls */
+typedef struct {
+    TokenTriplet* tokens;
+    TokenSpan* spans;
+    size_t token_count;
+    size_t token_capacity;
+
+    size_t* offsets;                /* input_count + 1 entries */
+    size_t input_count;
+    size_t offsets_capacity;
+
+    /* Numeric literal values; token indexes are relative to the input */
+    TokenConstant* constants;
+    size_t constant_count;
+    size_t constant_capacity;
+    size_t* constant_offsets;       /* input_count + 1 entries */
+} TokenBatch;
+
+void rift_token_batch_init(TokenBatch* batch);
+void rift_token_batch_free(TokenBatch* batch);
+
+/* Tokens of one input */
+const TokenTriplet* rift_token_batch_tokens(const TokenBatch* batch, size_t input,
+                                            size_t* count);
+const TokenSpan* rift_token_batch_spans(const TokenBatch* batch, size_t input,
+                                        size_t* count);
+const TokenConstant* rift_token_batch_constants(const TokenBatch* batch, size_t input,
+                                                size_t* count);
+
+/**
+ * Tokenize n inputs into out (previous contents are replaced)
+ * R.PROCESS_BATCH(CompiledLexer, inputs[]) -> Interleaved single-thread scan
+ *
+ * Fails before scanning if any input is not well-formed UTF-8.
+ */
+bool rift_tokenizer_process_batch(const CompiledLexer* lexer,
+                                  const char* const inputs[],
+                                  const size_t lengths[],
+                                  size_t n,
+                                  TokenBatch* out);
+
+/**
+ * As rift_tokenizer_process_batch, sharding contiguous input ranges
+ * across up to thread_count workers; results are concatenated in order
+ */
+bool rift_tokenizer_process_batch_parallel(const CompiledLexer* lexer,
+                                           const char* const inputs[],
+                                           const size_t lengths[],
+                                           size_t n,
+                                           TokenBatch* out,
+                                           size_t thread_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_TOKEN_BATCH_H */
@@ -0,0 +1,94 @@
+/*
+ * =================================================================
+ * token_output.h - RIFT-0 Buffered Token Output Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Text dumps (tokens/JSON/CSV/XML) without stdio formatting
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.OUTPUT(TokenTriplet[]) -> Buffered text, writev flushes
+ * R.FLAGS(reusable_buffers, parallel_ranges, ordered_concat)
+ *
+ * Records are formatted by hand into large reusable buffers. The
+ * parallel path formats consecutive token ranges on worker threads
+ * and writes the chunks in order with a single writev per round.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_TOKEN_OUTPUT_H
+#define RIFT_0_CORE_TOKEN_OUTPUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+
+#define RIFT_OUTPUT_BUFFER_SIZE     (256 * 1024)
+#define RIFT_OUTPUT_CHUNK_TOKENS    (64 * 1024)     /* Per worker, per round */
+
+typedef enum {
+    RIFT_OUTPUT_TOKENS,
+    RIFT_OUTPUT_JSON,
+    RIFT_OUTPUT_CSV,
+    RIFT_OUTPUT_XML
+} RiftOutputFormat;
+
+/* =================================================================
+ * OUTPUT BUFFER
+ * =================================================================
+ */
+
+typedef struct {
+    int fd;                         /* -1: memory only, grows instead of flushing */
+    char* data;
+    size_t length;
+    size_t capacity;
+    bool failed;
+} OutputBuffer;
+
+bool rift_output_init(OutputBuffer* out, int fd, size_t capacity);
+void rift_output_destroy(OutputBuffer* out);
+
+/* Write pending bytes to fd (no-op for memory buffers) */
+bool rift_output_flush(OutputBuffer* out);
+
+/* Make room for at least n more bytes */
+bool rift_output_reserve(OutputBuffer* out, size_t n);
+
+void rift_output_bytes(OutputBuffer* out, const char* data, size_t length);
+void rift_output_str(OutputBuffer* out, const char* str);
+void rift_output_char(OutputBuffer* out, char c);
+void rift_output_u64(OutputBuffer* out, uint64_t value);
+void rift_output_hex8(OutputBuffer* out, uint8_t value);     /* "0x%02X" */
+
+/* Escaped string bodies (no surrounding quotes) */
+void rift_output_json_escaped(OutputBuffer* out, const char* data, size_t length);
+void rift_output_xml_escaped(OutputBuffer* out, const char* data, size_t length);
+
+/* RFC 4180 field: quoted, embedded quotes doubled */
+void rift_output_csv_field(OutputBuffer* out, const char* data, size_t length);
+
+/* Pipe-joined flag names, "NONE" when clear */
+void rift_output_flags(OutputBuffer* out, uint8_t flags);
+
+/* =================================================================
+ * TOKEN DUMPS
+ * =================================================================
+ */
+
+/**
+ * Dump tokens to fd in the given format
+ * R.OUTPUT(TokenTriplet[], format) -> Ordered text on fd
+ *
+ * thread_count > 1 formats RIFT_OUTPUT_CHUNK_TOKENS ranges in parallel.
+ */
+bool rift_output_write_tokens(int fd, RiftOutputFormat format,
+                              const TokenTriplet* tokens, size_t count,
+                              const char* version, size_t thread_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_TOKEN_OUTPUT_H */
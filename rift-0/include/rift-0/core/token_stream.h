@@ -0,0 +1,156 @@
+/*
+ * =================================================================
+ * token_stream.h - RIFT-0 Binary Token Stream Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Framed token stream for stage handoff (OUTPUT_FORMAT_BINARY)
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.STREAM(TokenTriplet[], TokenSpan[]) -> Framed binary blocks
+ * R.FLAGS(streaming_write, random_access, mmap_readable)
+ *
+ * Layout (all integers little-endian):
+ *
+ *   header   "RTK0" u16 version, u16 header_size, u32 flags, u32 reserved,
+ *            u64 source_hash, u64 token_count (UINT64_MAX if unseekable)
+ *   block*   u32 token_count, u32 kinds_bytes, u32 offsets_bytes,
+ *            u32 lengths_bytes, u32 memptr_bytes, then the sections:
+ *              kinds    RLE runs of (u8 type, u8 value, varint run)
+ *              offsets  zigzag varint delta from the previous token end
+ *              lengths  varint
+ *              memptr   varint per token; absent when mem_ptr == offset
+ *   index    u64 file offset of every block (RIFT_TOKEN_STREAM_FLAG_INDEX)
+ *   trailer  u64 index_offset, u64 token_count, u32 block_count, "RTKE"
+ *
+ * Every block but the last holds RIFT_TOKEN_STREAM_BLOCK_TOKENS tokens
+ * and restarts its delta base, so a block decodes independently.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_TOKEN_STREAM_H
+#define RIFT_0_CORE_TOKEN_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include <stdio.h>
+
+/* =================================================================
+ * FORMAT CONSTANTS
+ * =================================================================
+ */
+
+#define RIFT_TOKEN_STREAM_VERSION       1
+#define RIFT_TOKEN_STREAM_HEADER_SIZE   32
+#define RIFT_TOKEN_STREAM_BLOCK_HEADER  20
+#define RIFT_TOKEN_STREAM_TRAILER_SIZE  24
+#define RIFT_TOKEN_STREAM_BLOCK_TOKENS  1024
+#define RIFT_TOKEN_STREAM_UNKNOWN_COUNT UINT64_MAX
+
+#define RIFT_TOKEN_STREAM_FLAG_INDEX    0x00000001u
+
+typedef struct {
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t flags;
+    uint64_t source_hash;
+    uint64_t token_count;
+} TokenStreamHeader;
+
+/* FNV-1a 64-bit hash of the tokenized source */
+uint64_t rift_token_stream_hash(const void* data, size_t length);
+
+/* =================================================================
+ * STREAMING WRITER
+ * =================================================================
+ */
+
+typedef struct TokenStreamWriter TokenStreamWriter;
+
+/**
+ * Begin a stream on out; the header is written immediately
+ * R.CREATE(TokenStreamWriter) -> Header emitted, block buffer ready
+ */
+TokenStreamWriter* rift_token_stream_writer_create(FILE* out, uint64_t source_hash,
+                                                   uint32_t flags);
+
+/* Append tokens; full blocks are encoded and written as they fill */
+bool rift_token_stream_write(TokenStreamWriter* writer,
+                             const TokenTriplet* tokens,
+                             const TokenSpan* spans,
+                             size_t count);
+
+/**
+ * Flush the final block, write index and trailer, patch the header
+ * token count when the output is seekable
+ */
+bool rift_token_stream_writer_finish(TokenStreamWriter* writer);
+void rift_token_stream_writer_destroy(TokenStreamWriter* writer);
+
+/* Write a processed context as one stream */
+bool rift_tokenizer_write_stream(const TokenizerContext* ctx, FILE* out, uint32_t flags);
+
+/* =================================================================
+ * READER (IN-MEMORY OR MMAP)
+ * =================================================================
+ */
+
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    bool mapped;                    /* Unmap on close */
+
+    TokenStreamHeader header;
+    uint64_t token_count;           /* From the trailer */
+    uint32_t block_count;
+    const uint8_t* index;           /* NULL without RIFT_TOKEN_STREAM_FLAG_INDEX */
+    const uint8_t* blocks_end;
+} TokenStreamView;
+
+/* Validate framing over caller-owned bytes (no copy) */
+bool rift_token_stream_open(TokenStreamView* view, const void* data, size_t size);
+
+/* Map a stream file read-only */
+bool rift_token_stream_map(TokenStreamView* view, const char* path);
+void rift_token_stream_close(TokenStreamView* view);
+
+/* Lazy cursor: decodes one token at a time straight from the view */
+typedef struct {
+    const TokenStreamView* view;
+    const uint8_t* block;           /* Current block header */
+    const uint8_t* kinds;
+    const uint8_t* kinds_end;
+    const uint8_t* offsets;
+    const uint8_t* offsets_end;
+    const uint8_t* lengths;
+    const uint8_t* lengths_end;
+    const uint8_t* memptrs;         /* NULL when mem_ptr mirrors offset */
+    const uint8_t* memptrs_end;
+    uint32_t block_remaining;
+    uint64_t run_remaining;
+    uint8_t run_type;
+    uint8_t run_value;
+    uint64_t prev_end;
+    uint64_t position;              /* Index of the next token */
+    bool corrupt;
+} TokenStreamCursor;
+
+void rift_token_stream_cursor_init(TokenStreamCursor* cursor, const TokenStreamView* view);
+
+/* Next token; false at end of stream or on corruption (cursor->corrupt) */
+bool rift_token_stream_next(TokenStreamCursor* cursor, TokenTriplet* out_token,
+                            TokenSpan* out_span);
+
+/**
+ * Position the cursor at token_index
+ * R.SEEK(TokenStreamCursor) -> Index lookup, or block-header walk without one
+ */
+bool rift_token_stream_seek(TokenStreamCursor* cursor, uint64_t token_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_TOKEN_STREAM_H */
@@ -26,103 +26,49 @@ extern "C" {
  * =================================================================
  */
 
+/* TokenTriplet, TokenType and TokenFlags come from the canonical types
+ * header so generated scanners and the core share one definition */
+#include "rift-0/core/tokenizer_types.h"
+
 /* Hierarchical dependency - follows Sinphasé ordering */
 #include "rift-0/core/tokenizer_rules.h"
 
-/* =================================================================
- * TOKENIZER CONTEXT STRUCTURE - BOUNDED COMPLEXITY
- * =================================================================
- */
-/* Bitfield Token Format (32-bit packed structure) */
-typedef struct {
-    uint32_t type    : 8;   /* Token type identifier (0-255) */
-    uint32_t mem_ptr : 16;  /* Memory pointer/offset (0-65535) */
-    uint32_t value   : 8;   /* Token value/flags (0-255) */
-} TokenTriplet;
-
-/* Token Type Enumeration */
-typedef enum {
-    TOKEN_UNKNOWN = 0,
-    TOKEN_IDENTIFIER,
-    TOKEN_KEYWORD,
-    TOKEN_LITERAL_NUMBER,
-    TOKEN_LITERAL_STRING,
-    TOKEN_OPERATOR,
-    TOKEN_PUNCTUATION,
-    TOKEN_WHITESPACE,
-    TOKEN_COMMENT,
-    TOKEN_EOF,
-    TOKEN_ERROR,
-    /* DFA-specific tokens */
-    TOKEN_REGEX_START,
-    TOKEN_REGEX_END,
-    TOKEN_COMPOSE_AND,
-    TOKEN_COMPOSE_OR,
-    TOKEN_COMPOSE_XOR,
-    TOKEN_COMPOSE_NAND,
-    TOKEN_DFA_STATE,
-    TOKEN_MAX = 255
-} TokenType;
-
-/* Token Flags (stored in value field) */
-typedef enum {
-    TOKEN_FLAG_NONE       = 0x00,
-    TOKEN_FLAG_GLOBAL     = 0x01,  /* g flag */
-    TOKEN_FLAG_MULTILINE  = 0x02,  /* m flag */
-    TOKEN_FLAG_IGNORECASE = 0x04,  /* i flag */
-    TOKEN_FLAG_TOPDOWN    = 0x08,  /* t flag */
-    TOKEN_FLAG_BOTTOMUP   = 0x10,  /* b flag */
-    TOKEN_FLAG_COMPOSED   = 0x20,  /* Composed regex */
-    TOKEN_FLAG_VALIDATED = 0x40,  /* DFA validated */
-    TOKEN_FLAG_ERROR      = 0x80   /* Error state */
-} TokenFlags;
+/* Lex-time numeric conversion */
+#include "rift-0/core/number_parse.h"
 
-/* =================================================================
- * DFA AUTOMATON STRUCTURES
- * =================================================================
- */
-typedef struct {
-    /* Input management */
-    const char* input;               /* Source text */
-    size_t input_length;            /* Input length */
-    size_t position;                 /* Current position */
-    size_t line;                     /* Current line number */
-    size_t column;                   /* Current column */
-    
-    /* Token management */
-    TokenTriplet* tokens;            /* Token array */
-    size_t token_count;              /* Number of tokens */
-    size_t token_capacity;           /* Token buffer capacity */
-    
-    /* Pattern cache */
-    struct {
-        char* name;
-        RegexComposition* pattern;
-    }* pattern_cache;
-    size_t pattern_cache_size;
-    
-    /* Error handling */
-    char error_message[256];         /* Last error description */
-    size_t error_position;           /* Error location in input */
-    bool has_error;                  /* Error flag */
-    
-    /* Thread safety */
-    void* mutex_handle;              /* Platform-specific mutex */
-    bool thread_safe_mode;           /* Thread safety enabled */
-} TokenizerContext;
+/* Defined in compiled_lexer.h */
+struct CompiledLexer;
+struct TokenSpan;
+
+/* Defined in union_dfa.h */
+struct RiftUnionDfa;
+
+/* Defined below with TokenizerContext */
+struct TriviaEntry;
+struct TokenConstant;
 
 /* =================================================================
  * PERFORMANCE STATISTICS - GOVERNANCE MONITORING
  * =================================================================
  */
 
-typedef struct {
+typedef struct TokenizerStats {
     uint64_t total_tokens;
     uint64_t total_characters;
     uint64_t processing_time_ns;
     uint64_t dfa_transitions;
     uint64_t cache_hits;
     uint64_t cache_misses;
+
+    /* Per-context accounting (tokenizer.c) */
+    size_t tokens_processed;
+    size_t tokens_generated;
+    size_t memory_allocated;
+    size_t memory_peak;
+    size_t dfa_states_created;
+    size_t regex_patterns;
+    double processing_time;
+    uint32_t error_count;
 } TokenizerStats;
 
 /* =================================================================
@@ -135,6 +81,10 @@ TokenizerContext* rift_tokenizer_create(size_t initial_capacity);
 void rift_tokenizer_destroy(TokenizerContext* ctx);
 bool rift_tokenizer_reset(TokenizerContext* ctx);
 
+/* Buffer retention (reset keeps buffers; trim releases them) */
+bool rift_tokenizer_trim(TokenizerContext* ctx, size_t token_capacity);
+size_t rift_tokenizer_retained_bytes(const TokenizerContext* ctx);
+
 /* Input processing */
 bool rift_tokenizer_set_input(TokenizerContext* ctx, const char* input, size_t length);
 bool rift_tokenizer_set_input_file(TokenizerContext* ctx, const char* filename);
@@ -144,6 +94,31 @@ bool rift_tokenizer_process(TokenizerContext* ctx);
 TokenTriplet* rift_tokenizer_get_tokens(TokenizerContext* ctx, size_t* count);
 TokenTriplet rift_tokenizer_next_token(TokenizerContext* ctx);
 
+/* Shared rule sets (compiled_lexer.h); the context keeps a reference */
+bool rift_tokenizer_set_lexer(TokenizerContext* ctx, const struct CompiledLexer* lexer);
+const struct TokenSpan* rift_tokenizer_get_spans(const TokenizerContext* ctx, size_t* count);
+
+/* Trivia side table; whitespace and comments never enter the token stream */
+void rift_tokenizer_set_trivia(TokenizerContext* ctx, bool keep_trivia);
+const struct TriviaEntry* rift_tokenizer_get_trivia(const TokenizerContext* ctx, size_t* count);
+const struct TriviaEntry* rift_tokenizer_trivia_after(const TokenizerContext* ctx,
+                                                      size_t token_index, size_t* count);
+const struct TriviaEntry* rift_tokenizer_leading_trivia(const TokenizerContext* ctx, size_t* count);
+
+/* Numeric literal values, converted once during processing */
+const struct TokenConstant* rift_tokenizer_get_constant(const TokenizerContext* ctx,
+                                                        size_t token_index);
+const struct TokenConstant* rift_tokenizer_get_constants(const TokenizerContext* ctx,
+                                                         size_t* count);
+
+/* Body of a R"delim(...)delim" token as a pointer into the input */
+const char* rift_tokenizer_raw_body(const TokenizerContext* ctx, size_t token_index,
+                                    size_t* length, TokenFlags* flags);
+
+/* Offset -> 1-based line/column; the newline table is built lazily */
+bool rift_tokenizer_get_location(TokenizerContext* ctx, size_t offset,
+                                 size_t* line, size_t* column);
+
 /* Pattern management */
 bool rift_tokenizer_cache_pattern(TokenizerContext* ctx, const char* name,
                                   const char* pattern, TokenFlags flags);
@@ -184,7 +159,7 @@ typedef struct DFAState {
 } DFAState;
 
 /* Regex Composition Structure */
-typedef struct {
+typedef struct RegexComposition {
     char* pattern;                  /* Raw regex pattern */
     TokenFlags flags;               /* Compilation flags */
     DFAState* start_state;          /* DFA start state */
@@ -198,32 +173,89 @@ typedef struct {
  * =================================================================
  */
 
-/* Tokenizer Context Structure */
-typedef struct {
-    const char* input_buffer;       /* Source input buffer */
-    size_t buffer_length;           /* Buffer size in bytes */
-    size_t current_position;        /* Current parsing position */
-    size_t line_number;             /* Current line (1-based) */
-    size_t column_number;           /* Current column (1-based) */
-    
+/**
+ * Trivia Entry
+ * Whitespace or comment recorded beside the token stream. anchor is the
+ * number of significant tokens before it, so trivia trailing token i has
+ * anchor i + 1 and trivia before the first token has anchor 0.
+ */
+typedef struct TriviaEntry {
+    uint32_t anchor;
+    uint32_t offset;                /* Byte offset in the input */
+    uint32_t length;                /* Byte length */
+    uint8_t type;                   /* TOKEN_WHITESPACE or TOKEN_COMMENT */
+} TriviaEntry;
+
+/**
+ * Token Constant
+ * Converted value of one TOKEN_LITERAL_NUMBER token. Entries are appended
+ * in token order, so lookup by token index is a binary search. A literal
+ * that does not convert (e.g. hex overflow) has kind RIFT_NUMBER_INVALID.
+ */
+typedef struct TokenConstant {
+    uint32_t token;                 /* Index into the token array */
+    RiftNumber number;
+} TokenConstant;
+
+/**
+ * Tokenizer Context Structure
+ * Per-thread scan state only: the compiled rule set is an immutable,
+ * shared CompiledLexer, so rift_tokenizer_process never needs a lock.
+ */
+typedef struct TokenizerContext {
+    /* Shared compiled rule set (retained) */
+    const struct CompiledLexer* lexer;
+
+    /* Input management */
+    char* input_buffer;             /* Owned copy of the source */
+    size_t input_capacity;          /* Retained buffer size (high-water) */
+    size_t input_length;            /* Input length in bytes */
+    size_t input_position;          /* Streaming read position */
+
     /* Token output management */
-    TokenTriplet* token_buffer;     /* Output token array */
-    size_t token_capacity;          /* Maximum tokens */
+    TokenTriplet* tokens;           /* Output token array */
+    struct TokenSpan* spans;        /* Byte extent per token */
     size_t token_count;             /* Current token count */
-    
-    /* DFA processing state */
-    DFAState* dfa_root;             /* Root DFA state machine */
-    RegexComposition* compositions; /* Active regex compositions */
-    size_t composition_count;       /* Number of compositions */
-    
+    size_t token_capacity;          /* Allocated tokens */
+
+    /* Trivia side table, filled only when keep_trivia is set */
+    TriviaEntry* trivia;
+    size_t trivia_count;
+    size_t trivia_capacity;
+    bool keep_trivia;
+
+    /* Numeric literal values, one per TOKEN_LITERAL_NUMBER */
+    TokenConstant* constants;
+    size_t constant_count;
+    size_t constant_capacity;
+
+    /* Newline offsets, built on the first location query */
+    uint32_t* newlines;
+    size_t newline_count;
+    size_t newline_capacity;
+    bool newlines_valid;
+
+    /* Named pattern storage (rift_tokenizer_cache_pattern) */
+    RegexComposition** compositions;
+    char** composition_names;       /* Parallel to compositions */
+    size_t composition_count;
+    size_t composition_capacity;
+    DFAState* dfa_root;
+    struct RiftUnionDfa* pattern_dfa;   /* Cached patterns, grown per addition */
+
     /* Error handling */
-    char error_message[256];        /* Last error description */
-    size_t error_position;          /* Error location in input */
+    char* error_message;            /* Last error description */
     bool has_error;                 /* Error flag */
-    
-    /* Thread safety */
-    void* mutex_handle;             /* Platform-specific mutex */
-    bool thread_safe_mode;          /* Thread safety enabled */
+
+    /* Thread safety (rift_tokenizer_enable_thread_safety) */
+    void* mutex;
+    bool thread_safe;
+
+    /* Governance */
+    bool aegis_compliant;
+    uint32_t governance_score;
+
+    TokenizerStats stats;
 } TokenizerContext;
 
 /* =================================================================
@@ -261,7 +293,7 @@ RegexComposition* rift_regex_compose_xor(RegexComposition* a, RegexComposition*
 RegexComposition* rift_regex_compose_nand(RegexComposition* a, RegexComposition* b);
 
 /* Pattern Matching with DFA */
-bool rift_regex_match(RegexComposition* regex, const char* input, size_t length);
+bool rift_regex_match(const RegexComposition* regex, const char* input, size_t length);
 bool rift_regex_find(RegexComposition* regex, const char* input, size_t length, 
                      size_t* match_start, size_t* match_length);
 
@@ -273,7 +305,7 @@ bool rift_regex_find(RegexComposition* regex, const char* input, size_t length,
 /* DFA Construction */
 DFAState* rift_dfa_create_state(uint32_t state_id, bool is_final);
 void rift_dfa_destroy_states(DFAState* root);
-bool rift_dfa_add_transition(DFAState* from, DFAState* to, char transition_char);
+void rift_dfa_add_transition(DFAState* from, DFAState* to, char transition_char);
 
 /* DFA Processing */
 DFAState* rift_dfa_process_input(DFAState* start, const char* input, size_t length);
@@ -286,6 +318,8 @@ TokenType rift_dfa_get_token_type(DFAState* state);
  */
 
 /* Token Utilities */
+TokenTriplet rift_token_create(uint8_t type, uint16_t mem_ptr, uint8_t value);
+const char* rift_token_type_to_string(TokenType type);
 const char* rift_token_type_name(TokenType type);
 const char* rift_token_flags_string(TokenFlags flags);
 bool rift_token_is_valid(const TokenTriplet* token);
@@ -325,15 +359,6 @@ bool rift_tokenizer_cache_pattern(TokenizerContext* ctx, const char* name,
 RegexComposition* rift_tokenizer_get_cached_pattern(TokenizerContext* ctx, const char* name);
 
 /* Performance Monitoring */
-typedef struct {
-    uint64_t total_tokens;
-    uint64_t total_characters;
-    uint64_t processing_time_ns;
-    uint64_t dfa_transitions;
-    uint64_t cache_hits;
-    uint64_t cache_misses;
-} TokenizerStats;
-
 TokenizerStats rift_tokenizer_get_stats(const TokenizerContext* ctx);
 void rift_tokenizer_reset_stats(TokenizerContext* ctx);
 
@@ -353,6 +378,11 @@ void rift_tokenizer_reset_stats(TokenizerContext* ctx);
 #define RIFT_MAX_COMPOSITIONS           64
 #define RIFT_MAX_ERROR_MESSAGE          256
 
+/* Context-level limits used by tokenizer.c / tokenizer_rules.c */
+#define RIFT_TOKENIZER_DEFAULT_CAPACITY RIFT_DEFAULT_TOKEN_CAPACITY
+#define RIFT_TOKENIZER_MAX_PATTERNS     RIFT_MAX_COMPOSITIONS
+#define RIFT_TOKENIZER_MAX_TOKENS       4096  /* Bounded mem_ptr range */
+
 /* Regex Composition Syntax Markers */
 #define RIFT_REGEX_RAW_QUOTE            "R\""
 #define RIFT_REGEX_RAW_SINGLE           "R'"
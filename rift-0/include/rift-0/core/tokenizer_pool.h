@@ -0,0 +1,100 @@
+/*
+ * =================================================================
+ * tokenizer_pool.h - RIFT-0 Tokenizer Context Pool Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Checkout/return reuse of TokenizerContext instances
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.POOL(TokenizerContext) -> Allocation-free request path
+ * R.FLAGS(thread_safe, lifo_reuse, idle_trim)
+ *
+ * Returned contexts are reset, not destroyed, so their token, span
+ * and input buffers stay at their high-water mark. Contexts that sit
+ * idle longer than idle_trim_seconds have those buffers trimmed.
+ * With a lexer_slot, each checkout binds the slot's current generation,
+ * so rule updates reach workers on their next request.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_TOKENIZER_POOL_H
+#define RIFT_0_CORE_TOKENIZER_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/lexer_slot.h"
+
+/* =================================================================
+ * POOL CONFIGURATION & STATISTICS
+ * =================================================================
+ */
+
+#define RIFT_POOL_DEFAULT_MAX_IDLE      16
+#define RIFT_POOL_DEFAULT_IDLE_SECONDS  30.0
+
+/* idle_trim_seconds sentinels; 0 selects the default like other fields */
+#define RIFT_POOL_TRIM_IMMEDIATE        (-1.0)  /* Trim on every trim pass */
+#define RIFT_POOL_TRIM_NEVER            (-2.0)  /* Keep buffers at high water */
+
+typedef struct {
+    size_t max_idle;                /* Idle contexts kept; extras are destroyed */
+    size_t initial_capacity;        /* Token capacity for new contexts */
+    size_t trim_capacity;           /* Token capacity after an idle trim */
+    double idle_trim_seconds;       /* Idle time before trimming, or RIFT_POOL_TRIM_* */
+    const CompiledLexer* lexer;     /* Bound to every context (NULL = default) */
+    RiftLexerSlot* lexer_slot;      /* Hot-swapped generations; overrides lexer */
+} TokenizerPoolConfig;
+
+typedef struct {
+    uint64_t checkouts;             /* Total checkout calls */
+    uint64_t hits;                  /* Served from the idle list */
+    uint64_t misses;                /* Required a new context */
+    uint64_t returns;               /* Contexts handed back */
+    uint64_t discards;              /* Returned past max_idle, destroyed */
+    uint64_t trims;                 /* Idle contexts trimmed */
+    uint64_t rebinds;               /* Contexts moved to a newer generation */
+    size_t idle_contexts;           /* Currently pooled */
+    size_t active_contexts;         /* Currently checked out */
+    size_t retained_bytes;          /* Buffer bytes held by idle contexts */
+} TokenizerPoolStats;
+
+typedef struct TokenizerPool TokenizerPool;
+
+/* =================================================================
+ * POOL API
+ * =================================================================
+ */
+
+/* NULL config, or 0 in any field, selects defaults */
+TokenizerPool* rift_tokenizer_pool_create(const TokenizerPoolConfig* config);
+void rift_tokenizer_pool_destroy(TokenizerPool* pool);
+
+/**
+ * Check out a reset context (reused when available)
+ * R.CHECKOUT(TokenizerPool) -> TokenizerContext bound to the current lexer
+ */
+TokenizerContext* rift_tokenizer_pool_checkout(TokenizerPool* pool);
+
+/**
+ * Return a context; it is reset and kept for reuse
+ * R.RETURN(TokenizerPool, TokenizerContext) -> Idle list
+ */
+void rift_tokenizer_pool_return(TokenizerPool* pool, TokenizerContext* ctx);
+
+/**
+ * Apply the idle-time policy now; returns contexts trimmed
+ */
+size_t rift_tokenizer_pool_trim(TokenizerPool* pool);
+
+TokenizerPoolStats rift_tokenizer_pool_get_stats(const TokenizerPool* pool);
+double rift_tokenizer_pool_hit_rate(const TokenizerPoolStats* stats);
+void rift_tokenizer_pool_print_stats(const TokenizerPool* pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_TOKENIZER_POOL_H */
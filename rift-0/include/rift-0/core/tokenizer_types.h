@@ -76,6 +76,8 @@ typedef enum {
     /* DFA state tokens */
     TOKEN_DFA_STATE,         /* DFA state transition */
     
+    TOKEN_DELIMITER,         /* Grouping delimiter */
+    
     TOKEN_MAX = 255          /* Maximum token type value */
 } TokenType;
 
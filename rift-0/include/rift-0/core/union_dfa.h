@@ -0,0 +1,81 @@
+/*
+ * =================================================================
+ * union_dfa.h - RIFT-0 Incremental Union DFA Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Runtime literal patterns combined into one minimal DFA
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.UNION(pattern_1 ... pattern_n) -> minimal acyclic RiftDfaTable
+ * R.FLAGS(incremental, local_minimize, batched_compaction)
+ *
+ * Adding a pattern clones only the states on the new pattern's path
+ * (both cases for 'i' patterns), then re-minimizes those clones bottom
+ * up against a register of existing states, so an addition costs
+ * O(pattern length) state work rather than O(total rules). States that
+ * become unreachable are released at once; their slots are reused, and
+ * the table is compacted in one batch once enough holes accumulate.
+ * Priority matches rule specs: on equal length the earlier pattern wins.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_UNION_DFA_H
+#define RIFT_0_CORE_UNION_DFA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rift-0/core/compiled_lexer.h"
+
+#define RIFT_UNION_DFA_MAX_STATES       0xFFFF  /* uint16_t transitions */
+#define RIFT_UNION_DFA_COMPACT_MIN      64      /* Never compact below this */
+#define RIFT_UNION_DFA_COMPACT_RATIO    4       /* Compact at 1/4 holes */
+
+typedef struct RiftUnionDfa RiftUnionDfa;
+
+typedef struct {
+    size_t pattern_count;
+    uint32_t live_states;           /* Reachable states, dead and start included */
+    uint32_t table_states;          /* Table rows, holes included */
+    uint64_t states_cloned;         /* Path clones made by additions */
+    uint64_t states_merged;         /* Clones folded into equivalent states */
+    uint64_t states_released;       /* States that became unreachable */
+    uint64_t compactions;           /* Batched full renumberings */
+} RiftUnionDfaStats;
+
+RiftUnionDfa* rift_union_dfa_create(void);
+void rift_union_dfa_destroy(RiftUnionDfa* dfa);
+
+/**
+ * Add a literal pattern incrementally
+ * R.ADD(RiftUnionDfa, literal, TokenType, flags) -> bool
+ *
+ * TOKEN_FLAG_IGNORECASE matches ASCII letters in either case. Fails
+ * without changing the DFA on empty input, a type outside 1..255, or
+ * when the state limit would be exceeded.
+ */
+bool rift_union_dfa_add(RiftUnionDfa* dfa, const char* literal, size_t length,
+                        TokenType type, TokenFlags flags);
+
+/**
+ * Renumber live states breadth-first into a dense table
+ * R.COMPACT(RiftUnionDfa) -> bool
+ *
+ * Runs automatically when holes reach 1/RIFT_UNION_DFA_COMPACT_RATIO of
+ * the table; call it directly to batch compaction after bulk additions.
+ */
+bool rift_union_dfa_compact(RiftUnionDfa* dfa);
+
+/**
+ * Current tables for rift_dfa_table_scan / rift_lexer_match_static
+ * R.TABLE(RiftUnionDfa) -> RiftDfaTable (valid until the next add)
+ */
+const RiftDfaTable* rift_union_dfa_table(const RiftUnionDfa* dfa);
+
+RiftUnionDfaStats rift_union_dfa_get_stats(const RiftUnionDfa* dfa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_UNION_DFA_H */
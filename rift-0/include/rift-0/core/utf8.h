@@ -0,0 +1,64 @@
+/*
+ * =================================================================
+ * utf8.h - RIFT-0 UTF-8 Validation Interface
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Input validation ahead of the generated scanner
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.VALIDATE(bytes) -> Well-formed UTF-8 or first bad offset
+ * R.FLAGS(ascii_fast_path, simd_lookup, scalar_fallback)
+ *
+ * The scanner's identifier rules are lowered to UTF-8 byte
+ * transitions, so it relies on input being well formed; this check
+ * runs once per input instead of once per code point.
+ * =================================================================
+ */
+
+#ifndef RIFT_0_CORE_UTF8_H
+#define RIFT_0_CORE_UTF8_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Validate a buffer as UTF-8
+ * R.VALIDATE(data, length) -> true when well formed
+ *
+ * All-ASCII 64-byte blocks are skipped with one vector test. Mixed
+ * blocks use the SSSE3 lookup validator when compiled in, otherwise
+ * a scalar decoder. On failure error_offset (optional) receives the
+ * offset of the first ill-formed sequence.
+ */
+bool rift_utf8_validate(const char* data, size_t length, size_t* error_offset);
+
+/**
+ * Length of the code point starting at p
+ * R.SKIP(p, limit) -> bytes in one encoded code point
+ *
+ * Used where no rule matches, so an unmatched character becomes one
+ * unknown token rather than one per byte. A stray continuation byte or
+ * truncated sequence counts as 1, so unvalidated input is safe.
+ */
+static inline size_t rift_utf8_sequence_length(const unsigned char* p, const unsigned char* limit) {
+    unsigned char lead = *p;
+    size_t length = lead < 0xC2 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 1;
+    if (length > (size_t)(limit - p)) {
+        return 1;
+    }
+    for (size_t i = 1; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return 1;
+        }
+    }
+    return length;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RIFT_0_CORE_UTF8_H */
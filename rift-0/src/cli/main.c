@@ -11,15 +11,21 @@
  * =================================================================
  */
 
+#define _POSIX_C_SOURCE 200809L /* fileno, sysconf */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <getopt.h>
 #include <errno.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 #include "rift-0/core/tokenizer.h"
-#include "rift-0/cli/cli_interface.h"
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/dfa_profile.h"
+#include "rift-0/core/token_stream.h"
+#include "rift-0/core/token_output.h"
 
 /* =================================================================
  * CLI CONFIGURATION & CONSTANTS
@@ -59,6 +65,7 @@ typedef struct {
     TokenFlags regex_flags;
     bool interactive_mode;
     size_t buffer_size;
+    const char* dfa_profile;
 } CLIOptions;
 
 /* =================================================================
@@ -76,7 +83,6 @@ static int validate_dfa_pattern(const char* pattern, TokenFlags flags);
 static void output_tokens(const TokenizerContext* ctx, const CLIOptions* options);
 static void output_statistics(const TokenizerContext* ctx);
 static TokenFlags parse_regex_flags(const char* flag_string);
-static const char* get_file_extension(OutputFormat format);
 
 /* =================================================================
  * MAIN ENTRY POINT
@@ -96,7 +102,8 @@ int main(int argc, char* argv[]) {
         .regex_pattern = NULL,
         .regex_flags = TOKEN_FLAG_NONE,
         .interactive_mode = false,
-        .buffer_size = RIFT_DEFAULT_TOKEN_CAPACITY
+        .buffer_size = RIFT_DEFAULT_TOKEN_CAPACITY,
+        .dfa_profile = NULL
     };
     
     /* Parse command line arguments */
@@ -147,13 +154,14 @@ static int parse_arguments(int argc, char* argv[], CLIOptions* options) {
         {"flags",       required_argument, 0, 'F'},
         {"interactive", no_argument,       0, 'i'},
         {"buffer-size", required_argument, 0, 'b'},
+        {"dfa-profile", required_argument, 0, 'P'},
         {0, 0, 0, 0}
     };
     
     int option_index = 0;
     int c;
     
-    while ((c = getopt_long(argc, argv, "hVvdo:f:cstp:F:ib:", long_options, &option_index)) != -1) {
+    while ((c = getopt_long(argc, argv, "hVvdo:f:cstp:F:ib:P:", long_options, &option_index)) != -1) {
         switch (c) {
             case 'h':
                 print_help(argv[0]);
@@ -225,6 +233,10 @@ static int parse_arguments(int argc, char* argv[], CLIOptions* options) {
                 }
                 break;
                 
+            case 'P':
+                options->dfa_profile = optarg;
+                break;
+                
             case '?':
                 return EXIT_FAILURE;
                 
@@ -293,6 +305,16 @@ static int process_file(const CLIOptions* options) {
         }
     }
     
+    /* Scan with the instrumented scanner when recording a profile */
+    if (options->dfa_profile) {
+        rift_dfa_profile_reset(&rift_default_profiled_counters);
+        if (!rift_tokenizer_set_lexer(ctx, rift_lexer_profiling())) {
+            fprintf(stderr, "Error: Failed to select the profiling lexer\n");
+            rift_tokenizer_destroy(ctx);
+            return EXIT_FAILURE;
+        }
+    }
+    
     /* Process tokens */
     if (options->verbose) {
         printf("Starting tokenization process...\n");
@@ -311,6 +333,19 @@ static int process_file(const CLIOptions* options) {
         printf("Tokenization completed. Generated %zu tokens.\n", token_count);
     }
     
+    /* Merge this run's visit counts into the profile */
+    if (options->dfa_profile) {
+        if (!rift_dfa_profile_save(&rift_default_profiled_counters, options->dfa_profile)) {
+            fprintf(stderr, "Error: Failed to write DFA profile: %s\n", options->dfa_profile);
+            rift_tokenizer_destroy(ctx);
+            return EXIT_FAILURE;
+        }
+        if (options->verbose) {
+            printf("DFA profile updated: %s (%llu state visits)\n", options->dfa_profile,
+                   (unsigned long long)rift_dfa_profile_total(&rift_default_profiled_counters));
+        }
+    }
+    
     /* Output results */
     output_tokens(ctx, options);
     
@@ -423,12 +458,13 @@ static int interactive_mode(const CLIOptions* options) {
  */
 
 static void output_tokens(const TokenizerContext* ctx, const CLIOptions* options) {
-    size_t token_count;
-    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &token_count);
+    const TokenTriplet* tokens = ctx->tokens;
+    size_t token_count = ctx->token_count;
     
     FILE* output = stdout;
     if (options->output_file) {
-        output = fopen(options->output_file, "w");
+        output = fopen(options->output_file,
+                       options->output_format == OUTPUT_FORMAT_BINARY ? "wb" : "w");
         if (!output) {
             fprintf(stderr, "Error: Cannot open output file '%s': %s\n",
                     options->output_file, strerror(errno));
@@ -436,64 +472,47 @@ static void output_tokens(const TokenizerContext* ctx, const CLIOptions* options
         }
     }
     
+    /* Text formats bypass stdio formatting; ranges are formatted in
+     * parallel when threading is enabled */
+    size_t threads = 1;
+    if (options->enable_threading) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 1 ? (size_t)online : 1;
+    }
+    
+    bool written = true;
+    fflush(output);
     switch (options->output_format) {
         case OUTPUT_FORMAT_TOKENS:
-            fprintf(output, "# RIFT-0 Token Output\n");
-            fprintf(output, "# Format: Index Type MemPtr Value Flags\n");
-            for (size_t i = 0; i < token_count; i++) {
-                fprintf(output, "%zu %s %u 0x%02X %s\n",
-                        i, rift_token_type_name(tokens[i].type),
-                        tokens[i].mem_ptr, tokens[i].value,
-                        rift_token_flags_string(tokens[i].value));
-            }
+            written = rift_output_write_tokens(fileno(output), RIFT_OUTPUT_TOKENS,
+                                               tokens, token_count, CLI_VERSION, threads);
             break;
             
         case OUTPUT_FORMAT_JSON:
-            fprintf(output, "{\n");
-            fprintf(output, "  \"version\": \"%s\",\n", CLI_VERSION);
-            fprintf(output, "  \"tokenizer\": \"rift-0\",\n");
-            fprintf(output, "  \"token_count\": %zu,\n", token_count);
-            fprintf(output, "  \"tokens\": [\n");
-            for (size_t i = 0; i < token_count; i++) {
-                fprintf(output, "    {\n");
-                fprintf(output, "      \"index\": %zu,\n", i);
-                fprintf(output, "      \"type\": \"%s\",\n", rift_token_type_name(tokens[i].type));
-                fprintf(output, "      \"mem_ptr\": %u,\n", tokens[i].mem_ptr);
-                fprintf(output, "      \"value\": %u,\n", tokens[i].value);
-                fprintf(output, "      \"flags\": \"%s\"\n", rift_token_flags_string(tokens[i].value));
-                fprintf(output, "    }%s\n", (i < token_count - 1) ? "," : "");
-            }
-            fprintf(output, "  ]\n");
-            fprintf(output, "}\n");
+            written = rift_output_write_tokens(fileno(output), RIFT_OUTPUT_JSON,
+                                               tokens, token_count, CLI_VERSION, threads);
             break;
             
         case OUTPUT_FORMAT_CSV:
-            fprintf(output, "Index,Type,MemPtr,Value,Flags\n");
-            for (size_t i = 0; i < token_count; i++) {
-                fprintf(output, "%zu,%s,%u,%u,\"%s\"\n",
-                        i, rift_token_type_name(tokens[i].type),
-                        tokens[i].mem_ptr, tokens[i].value,
-                        rift_token_flags_string(tokens[i].value));
-            }
+            written = rift_output_write_tokens(fileno(output), RIFT_OUTPUT_CSV,
+                                               tokens, token_count, CLI_VERSION, threads);
             break;
             
         case OUTPUT_FORMAT_BINARY:
-            fwrite(tokens, sizeof(TokenTriplet), token_count, output);
+            /* Framed stream with a block index for stage-1 random access */
+            written = rift_tokenizer_write_stream(ctx, output, RIFT_TOKEN_STREAM_FLAG_INDEX);
             break;
             
         case OUTPUT_FORMAT_XML:
-            fprintf(output, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-            fprintf(output, "<rift_tokens version=\"%s\" count=\"%zu\">\n", CLI_VERSION, token_count);
-            for (size_t i = 0; i < token_count; i++) {
-                fprintf(output, "  <token index=\"%zu\" type=\"%s\" mem_ptr=\"%u\" value=\"%u\" flags=\"%s\"/>\n",
-                        i, rift_token_type_name(tokens[i].type),
-                        tokens[i].mem_ptr, tokens[i].value,
-                        rift_token_flags_string(tokens[i].value));
-            }
-            fprintf(output, "</rift_tokens>\n");
+            written = rift_output_write_tokens(fileno(output), RIFT_OUTPUT_XML,
+                                               tokens, token_count, CLI_VERSION, threads);
             break;
     }
     
+    if (!written) {
+        fprintf(stderr, "Error: Failed to write token output\n");
+    }
+    
     if (options->output_file) {
         fclose(output);
     }
@@ -611,6 +630,8 @@ static void print_help(const char* program_name) {
     printf("  -F, --flags FLAGS       Regex flags (gmitb)\n");
     printf("  -i, --interactive       Enter interactive mode\n");
     printf("  -b, --buffer-size SIZE  Token buffer size (default: %d)\n", RIFT_DEFAULT_TOKEN_CAPACITY);
+    printf("  -P, --dfa-profile FILE  Record DFA state visits into FILE (merged across runs;\n");
+    printf("                          rebuild with make DFA_PROFILE=FILE to apply)\n");
     printf("\n");
     
     printf("REGEX FLAGS:\n");
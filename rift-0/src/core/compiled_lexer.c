@@ -0,0 +1,560 @@
+/*
+ * =================================================================
+ * compiled_lexer.c - RIFT-0 Shared Compiled Lexer Implementation
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Immutable rule tables and per-thread scanner cursors
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(CompiledLexer, LexerCursor)
+ * R.FLAGS(immutable, ref_counted, lock_free)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/default_scanner.h"
+#include "rift-0/core/raw_string.h"
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/utf8.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* =================================================================
+ * INTERNAL STRUCTURES
+ * =================================================================
+ */
+
+typedef struct CompiledRule CompiledRule;
+
+/* Literal matcher; one instantiation per match-relevant flag set */
+typedef size_t (*RuleMatchFn)(const CompiledRule* rule,
+                              const unsigned char* cursor,
+                              const unsigned char* limit);
+
+struct CompiledRule {
+    RegexComposition* regex;        /* Compiled literal chain */
+    unsigned char* literal;         /* Chain flattened; pre-folded for 'i' */
+    size_t literal_length;
+    RuleMatchFn match;              /* Chosen once from the flags */
+    unsigned char first[2];         /* Accepted first bytes (both cases for 'i') */
+    TokenType type;
+};
+
+struct CompiledLexer {
+    atomic_uint ref_count;
+    bool is_static;                 /* Default lexer is never freed */
+    RiftScanFn scan;                /* Generated default scanner */
+    CompiledRule* rules;            /* Layered rule specs */
+    size_t rule_count;
+    const RiftDfaTable* table;      /* Borrowed static literal DFA */
+};
+
+static CompiledLexer rift_default_lexer = {
+    .ref_count = 1,
+    .is_static = true,
+    .scan = rift_default_scan,
+    .rules = NULL,
+    .rule_count = 0,
+    .table = NULL
+};
+
+static CompiledLexer rift_profiling_lexer = {
+    .ref_count = 1,
+    .is_static = true,
+    .scan = rift_default_profiled_scan,
+    .rules = NULL,
+    .rule_count = 0,
+    .table = NULL
+};
+
+/* =================================================================
+ * FLAG-SPECIALIZED MATCHERS
+ * =================================================================
+ */
+
+/* ASCII case fold without a branch or locale lookup */
+#define RIFT_FOLD_NONE(c)   (c)
+#define RIFT_FOLD_ASCII(c)  ((unsigned char)((c) | (((unsigned)(c) - 'A' < 26u) << 5)))
+
+/*
+ * Each instantiation has its fold baked in, so the per-byte loop holds
+ * no flag test; the flag is read once, in rift_lexer_compile.
+ */
+#define RIFT_DEFINE_RULE_MATCHER(NAME, FOLD)                                \
+    static size_t NAME(const CompiledRule* rule,                            \
+                       const unsigned char* cursor,                         \
+                       const unsigned char* limit) {                        \
+        size_t length = rule->literal_length;                               \
+        if ((size_t)(limit - cursor) < length) {                            \
+            return 0;                                                       \
+        }                                                                   \
+        for (size_t i = 0; i < length; i++) {                               \
+            if (FOLD(cursor[i]) != rule->literal[i]) {                      \
+                return 0;                                                   \
+            }                                                               \
+        }                                                                   \
+        return length;                                                      \
+    }
+
+RIFT_DEFINE_RULE_MATCHER(match_rule_exact, RIFT_FOLD_NONE)
+RIFT_DEFINE_RULE_MATCHER(match_rule_folded, RIFT_FOLD_ASCII)
+
+/*
+ * Indexed by the flag bits that change what a literal matches. Only
+ * 'i' does; g/m/t/b steer composition and evaluation order, so every
+ * combination of them shares the instantiation for its 'i' bit.
+ */
+static const RuleMatchFn rift_rule_matchers[2] = {
+    match_rule_exact,               /* TOKEN_FLAG_NONE */
+    match_rule_folded               /* TOKEN_FLAG_IGNORECASE */
+};
+
+static RuleMatchFn select_rule_matcher(TokenFlags flags) {
+    return rift_rule_matchers[(flags & TOKEN_FLAG_IGNORECASE) != 0];
+}
+
+/* Flatten the literal DFA chain; false if it never reaches a final state */
+static bool flatten_rule(CompiledRule* rule, bool ignore_case) {
+    size_t length = 0;
+    const DFAState* state = rule->regex->start_state;
+    while (state && !state->is_final) {
+        state = state->next_state;
+        length++;
+    }
+    if (!state || length == 0) {
+        return false;
+    }
+
+    rule->literal = malloc(length);
+    if (!rule->literal) {
+        return false;
+    }
+
+    state = rule->regex->start_state;
+    for (size_t i = 0; i < length; i++, state = state->next_state) {
+        unsigned char c = (unsigned char)state->transition_char;
+        rule->literal[i] = ignore_case ? RIFT_FOLD_ASCII(c) : c;
+    }
+    rule->literal_length = length;
+
+    /* Screen candidates inline before the indirect call */
+    unsigned char lead = rule->literal[0];
+    rule->first[0] = lead;
+    rule->first[1] = (ignore_case && lead >= 'a' && lead <= 'z') ? (unsigned char)(lead - 32) : lead;
+    return true;
+}
+
+/* =================================================================
+ * COMPILED LEXER LIFECYCLE
+ * =================================================================
+ */
+
+/**
+ * Compile rule specs into a shared lexer
+ * R.COMPILE(LexerRuleSpec[]) -> Immutable CompiledLexer
+ */
+const CompiledLexer* rift_lexer_compile(const LexerRuleSpec* rules, size_t rule_count) {
+    if ((!rules && rule_count > 0) || rule_count > RIFT_LEXER_MAX_RULES) {
+        return NULL;
+    }
+
+    CompiledLexer* lexer = calloc(1, sizeof(CompiledLexer));
+    if (!lexer) {
+        return NULL;
+    }
+
+    atomic_init(&lexer->ref_count, 1);
+    lexer->is_static = false;
+    lexer->scan = rift_default_scan;
+
+    if (rule_count > 0) {
+        lexer->rules = calloc(rule_count, sizeof(CompiledRule));
+        if (!lexer->rules) {
+            free(lexer);
+            return NULL;
+        }
+    }
+
+    for (size_t i = 0; i < rule_count; i++) {
+        if (!rules[i].pattern || rules[i].pattern[0] == '\0') {
+            rift_lexer_release(lexer);
+            return NULL;
+        }
+
+        RegexComposition* regex = rift_regex_compile(rules[i].pattern, rules[i].flags);
+        if (!regex) {
+            rift_lexer_release(lexer);
+            return NULL;
+        }
+
+        CompiledRule* rule = &lexer->rules[i];
+        rule->regex = regex;
+        rule->type = rules[i].type;
+        rule->match = select_rule_matcher(rules[i].flags);
+        lexer->rule_count++;
+
+        if (!flatten_rule(rule, (rules[i].flags & TOKEN_FLAG_IGNORECASE) != 0)) {
+            rift_lexer_release(lexer);
+            return NULL;
+        }
+    }
+
+    return lexer;
+}
+
+/**
+ * Layer a static literal DFA over the default scanner
+ * R.COMPILE(RiftDfaTable) -> CompiledLexer borrowing the tables
+ */
+const CompiledLexer* rift_lexer_from_table(const RiftDfaTable* table) {
+    if (!table || !table->transitions || !table->accept ||
+        table->state_count <= RIFT_DFA_START_STATE) {
+        return NULL;
+    }
+
+    CompiledLexer* lexer = calloc(1, sizeof(CompiledLexer));
+    if (!lexer) {
+        return NULL;
+    }
+
+    atomic_init(&lexer->ref_count, 1);
+    lexer->is_static = false;
+    lexer->scan = rift_default_scan;
+    lexer->table = table;
+    return lexer;
+}
+
+/**
+ * Get the shared default lexer
+ * R.DEFAULT() -> Static generated-scanner lexer
+ */
+const CompiledLexer* rift_lexer_default(void) {
+    return &rift_default_lexer;
+}
+
+/**
+ * Get the shared instrumented lexer
+ * R.PROFILE() -> Static instrumented-scanner lexer
+ */
+const CompiledLexer* rift_lexer_profiling(void) {
+    return &rift_profiling_lexer;
+}
+
+/**
+ * Acquire an additional reference
+ */
+const CompiledLexer* rift_lexer_retain(const CompiledLexer* lexer) {
+    if (!lexer) return NULL;
+
+    CompiledLexer* mutable_lexer = (CompiledLexer*)lexer;
+    atomic_fetch_add_explicit(&mutable_lexer->ref_count, 1, memory_order_relaxed);
+    return lexer;
+}
+
+/**
+ * Drop a reference; the last release frees the rule tables
+ */
+void rift_lexer_release(const CompiledLexer* lexer) {
+    if (!lexer) return;
+
+    CompiledLexer* mutable_lexer = (CompiledLexer*)lexer;
+    if (mutable_lexer->is_static) return;
+
+    if (atomic_fetch_sub_explicit(&mutable_lexer->ref_count, 1, memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    for (size_t i = 0; i < mutable_lexer->rule_count; i++) {
+        rift_regex_destroy(mutable_lexer->rules[i].regex);
+        free(mutable_lexer->rules[i].literal);
+    }
+    free(mutable_lexer->rules);
+    free(mutable_lexer);
+}
+
+size_t rift_lexer_rule_count(const CompiledLexer* lexer) {
+    return lexer ? lexer->rule_count : 0;
+}
+
+size_t rift_lexer_dfa_state_count(const CompiledLexer* lexer) {
+    if (!lexer) return 0;
+
+    size_t states = rift_default_dfa_state_count;
+    if (lexer->table) {
+        states += lexer->table->state_count;
+    }
+    for (size_t i = 0; i < lexer->rule_count; i++) {
+        states += lexer->rules[i].regex->pattern_length + 1;
+    }
+    return states;
+}
+
+/* =================================================================
+ * MATCHING (READ-ONLY)
+ * =================================================================
+ */
+
+/**
+ * Longest match in a static table
+ * R.SCAN(RiftDfaTable, cursor) -> (length, TokenType)
+ */
+size_t rift_dfa_table_scan(const RiftDfaTable* table,
+                           const unsigned char* cursor,
+                           const unsigned char* limit,
+                           TokenType* out_type) {
+    if (!table || !cursor) {
+        return 0;
+    }
+
+    const uint16_t* transitions = table->transitions;
+    uint32_t state = RIFT_DFA_START_STATE;
+    size_t length = 0;
+    TokenType type = TOKEN_UNKNOWN;
+
+    for (const unsigned char* p = cursor; p < limit; p++) {
+        state = transitions[(size_t)state * 256 + *p];
+        if (state == RIFT_DFA_DEAD_STATE) {
+            break;
+        }
+        if (table->accept[state] != TOKEN_UNKNOWN) {
+            length = (size_t)(p - cursor) + 1;
+            type = (TokenType)table->accept[state];
+        }
+    }
+
+    if (out_type) {
+        *out_type = type;
+    }
+    return length;
+}
+
+/* Raw literal, then default scanner, then rule specs and table */
+static size_t match_layered(RiftScanFn scan,
+                            const CompiledRule* rules, size_t rule_count,
+                            const RiftDfaTable* table,
+                            const unsigned char* cursor,
+                            const unsigned char* limit,
+                            TokenType* out_type) {
+    /* Raw literals close on their own delimiter; no DFA rule can say that */
+    if (cursor[0] == 'R' && limit - cursor > 1 && (cursor[1] == '"' || cursor[1] == '\'')) {
+        size_t raw_length = rift_raw_string_scan((const char*)cursor, (size_t)(limit - cursor), NULL);
+        if (raw_length > 0) {
+            if (out_type) {
+                *out_type = TOKEN_LITERAL_STRING;
+            }
+            return raw_length;
+        }
+    }
+
+    TokenType type = TOKEN_UNKNOWN;
+    size_t length = scan(cursor, limit, &type);
+
+    for (size_t i = 0; i < rule_count; i++) {
+        const CompiledRule* rule = &rules[i];
+        if (cursor[0] != rule->first[0] && cursor[0] != rule->first[1]) {
+            continue;
+        }
+        size_t rule_length = rule->match(rule, cursor, limit);
+        if (rule_length > 0 && rule_length >= length) {
+            length = rule_length;
+            type = rule->type;
+        }
+    }
+
+    if (table) {
+        TokenType table_type = TOKEN_UNKNOWN;
+        size_t table_length = rift_dfa_table_scan(table, cursor, limit, &table_type);
+        if (table_length > 0 && table_length >= length) {
+            length = table_length;
+            type = table_type;
+        }
+    }
+
+    if (out_type) {
+        *out_type = type;
+    }
+    return length;
+}
+
+/**
+ * Match one token at cursor
+ * R.MATCH(CompiledLexer, cursor) -> Longest match, rule specs on ties
+ */
+size_t rift_lexer_match(const CompiledLexer* lexer,
+                        const unsigned char* cursor,
+                        const unsigned char* limit,
+                        TokenType* out_type) {
+    if (!lexer || !cursor || cursor >= limit) {
+        return 0;
+    }
+
+    return match_layered(lexer->scan, lexer->rules, lexer->rule_count, lexer->table,
+                         cursor, limit, out_type);
+}
+
+/**
+ * Match with the default rules and a static table, no CompiledLexer
+ * R.MATCH(RiftDfaTable, cursor, limit) -> (length, TokenType)
+ */
+size_t rift_lexer_match_static(const RiftDfaTable* table,
+                               const unsigned char* cursor,
+                               const unsigned char* limit,
+                               TokenType* out_type) {
+    if (!cursor || cursor >= limit) {
+        return 0;
+    }
+
+    return match_layered(rift_default_scan, NULL, 0, table, cursor, limit, out_type);
+}
+
+/* =================================================================
+ * SCANNER CURSOR
+ * =================================================================
+ */
+
+static bool cursor_reserve(LexerCursor* cursor, size_t needed) {
+    if (needed <= cursor->token_capacity) {
+        return true;
+    }
+
+    size_t new_capacity = cursor->token_capacity ? cursor->token_capacity : RIFT_LEXER_DEFAULT_CAPACITY;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+
+    TokenTriplet* tokens = realloc(cursor->tokens, new_capacity * sizeof(TokenTriplet));
+    if (!tokens) {
+        return false;
+    }
+    cursor->tokens = tokens;
+
+    TokenSpan* spans = realloc(cursor->spans, new_capacity * sizeof(TokenSpan));
+    if (!spans) {
+        return false;
+    }
+    cursor->spans = spans;
+
+    cursor->token_capacity = new_capacity;
+    return true;
+}
+
+static void cursor_fail(LexerCursor* cursor, const char* message) {
+    cursor->has_error = true;
+    snprintf(cursor->error_message, sizeof(cursor->error_message), "%s", message);
+}
+
+/**
+ * Initialize a scanner cursor over a shared lexer
+ * R.CREATE(LexerCursor) -> Thread-local scan state
+ */
+bool rift_cursor_init(LexerCursor* cursor, const CompiledLexer* lexer,
+                      size_t initial_capacity) {
+    if (!cursor || !lexer) {
+        return false;
+    }
+
+    memset(cursor, 0, sizeof(*cursor));
+    if (!cursor_reserve(cursor, initial_capacity ? initial_capacity : RIFT_LEXER_DEFAULT_CAPACITY)) {
+        free(cursor->tokens);
+        free(cursor->spans);
+        memset(cursor, 0, sizeof(*cursor));
+        return false;
+    }
+
+    cursor->lexer = rift_lexer_retain(lexer);
+    return true;
+}
+
+/**
+ * Release cursor buffers and its lexer reference
+ */
+void rift_cursor_destroy(LexerCursor* cursor) {
+    if (!cursor) return;
+
+    free(cursor->tokens);
+    free(cursor->spans);
+    rift_lexer_release(cursor->lexer);
+    memset(cursor, 0, sizeof(*cursor));
+}
+
+void rift_cursor_set_input(LexerCursor* cursor, const char* input, size_t length) {
+    if (!cursor) return;
+
+    cursor->input = input;
+    cursor->input_length = input ? length : 0;
+    cursor->position = 0;
+    cursor->token_count = 0;
+    cursor->has_error = false;
+    cursor->error_message[0] = '\0';
+}
+
+/**
+ * Scan one token
+ * R.NEXT(LexerCursor) -> (TokenTriplet, TokenSpan)
+ */
+bool rift_cursor_next(LexerCursor* cursor, TokenTriplet* out_token, TokenSpan* out_span) {
+    if (!cursor || !cursor->input || cursor->position >= cursor->input_length) {
+        return false;
+    }
+
+    const unsigned char* base = (const unsigned char*)cursor->input;
+    const unsigned char* start = base + cursor->position;
+    const unsigned char* limit = base + cursor->input_length;
+
+    TokenType type = TOKEN_UNKNOWN;
+    size_t length = rift_lexer_match(cursor->lexer, start, limit, &type);
+    if (length == 0) {
+        type = TOKEN_UNKNOWN;
+        length = rift_utf8_sequence_length(start, limit);
+    }
+
+    if (out_token) {
+        *out_token = rift_token_create((uint8_t)type, (uint16_t)cursor->position, 0);
+    }
+    if (out_span) {
+        out_span->offset = (uint32_t)cursor->position;
+        out_span->length = (uint32_t)length;
+    }
+
+    cursor->position += length;
+    return true;
+}
+
+/**
+ * Scan all remaining input into the cursor buffer
+ * R.PROCESS(LexerCursor) -> EOF-terminated token array
+ */
+bool rift_cursor_scan(LexerCursor* cursor) {
+    if (!cursor || !cursor->input) {
+        return false;
+    }
+
+    TokenTriplet token;
+    TokenSpan span;
+
+    for (;;) {
+        if (!cursor_reserve(cursor, cursor->token_count + 1)) {
+            cursor_fail(cursor, "Token capacity expansion failed");
+            return false;
+        }
+
+        if (!rift_cursor_next(cursor, &token, &span)) {
+            break;
+        }
+
+        cursor->tokens[cursor->token_count] = token;
+        cursor->spans[cursor->token_count] = span;
+        cursor->token_count++;
+    }
+
+    cursor->tokens[cursor->token_count] =
+        rift_token_create(TOKEN_EOF, (uint16_t)cursor->input_length, 0);
+    cursor->spans[cursor->token_count].offset = (uint32_t)cursor->input_length;
+    cursor->spans[cursor->token_count].length = 0;
+    cursor->token_count++;
+
+    return true;
+}
@@ -0,0 +1,191 @@
+/*
+ * =================================================================
+ * dfa_profile.c - RIFT-0 DFA State Visit Profiling
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Profile-guided state layout for the generated scanner
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(rift_dfa_profile_reset, rift_dfa_profile_save)
+ * R.FLAGS(instrumented_twin, mergeable, build_time_layout)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/dfa_profile.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RIFT_DFA_PROFILE_LINE_MAX   128
+
+/* =================================================================
+ * INTERNAL HELPERS
+ * =================================================================
+ */
+
+/* Edges are emitted sorted by (from, to), so lookup is a binary search */
+static long find_edge(const RiftDfaProfileCounters* counters, unsigned from, unsigned to) {
+    size_t lo = 0;
+    size_t hi = counters->edge_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        unsigned mid_from = counters->edge_from[mid];
+        unsigned mid_to = counters->edge_to[mid];
+        if (mid_from < from || (mid_from == from && mid_to < to)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < counters->edge_count &&
+        counters->edge_from[lo] == from && counters->edge_to[lo] == to) {
+        return (long)lo;
+    }
+    return -1;
+}
+
+/*
+ * Add a profile file's counts into states/edges. Returns 1 when merged,
+ * 0 when the file is absent or for another DFA, -1 when malformed.
+ */
+static int load_existing(const RiftDfaProfileCounters* counters, const char* path,
+                         uint64_t* states, uint64_t* edges) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        return 0;
+    }
+
+    char line[RIFT_DFA_PROFILE_LINE_MAX];
+    bool fingerprint_seen = false;
+    int result = 1;
+
+    while (result == 1 && fgets(line, sizeof(line), in)) {
+        uint64_t fingerprint;
+        unsigned from, to, state_count;
+        uint64_t count;
+
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "fingerprint %" SCNx64, &fingerprint) == 1) {
+            fingerprint_seen = true;
+            if (fingerprint != counters->fingerprint) {
+                result = 0;
+            }
+        } else if (sscanf(line, "states %u", &state_count) == 1) {
+            if (state_count != counters->state_count) {
+                result = 0;
+            }
+        } else if (sscanf(line, "state %u %" SCNu64, &from, &count) == 2) {
+            if (!fingerprint_seen || from >= counters->state_count) {
+                result = -1;
+            } else {
+                states[from] += count;
+            }
+        } else if (sscanf(line, "edge %u %u %" SCNu64, &from, &to, &count) == 3) {
+            long index = fingerprint_seen ? find_edge(counters, from, to) : -1;
+            if (index < 0) {
+                result = -1;
+            } else {
+                edges[index] += count;
+            }
+        } else {
+            result = -1;
+        }
+    }
+
+    fclose(in);
+    return result;
+}
+
+/* =================================================================
+ * PROFILE API
+ * =================================================================
+ */
+
+/**
+ * Zero a scanner's counters
+ * R.RESET(RiftDfaProfileCounters) -> all visits 0
+ */
+void rift_dfa_profile_reset(const RiftDfaProfileCounters* counters) {
+    if (!counters) return;
+
+    memset(counters->state_visits, 0, counters->state_count * sizeof(uint64_t));
+    memset(counters->edge_visits, 0, counters->edge_count * sizeof(uint64_t));
+}
+
+/**
+ * Sum of state visits
+ * R.TOTAL(RiftDfaProfileCounters) -> uint64_t
+ */
+uint64_t rift_dfa_profile_total(const RiftDfaProfileCounters* counters) {
+    if (!counters) return 0;
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < counters->state_count; i++) {
+        total += counters->state_visits[i];
+    }
+    return total;
+}
+
+/**
+ * Write counters to a profile file, merging a matching existing profile
+ * R.SAVE(counters, path) -> bool
+ */
+bool rift_dfa_profile_save(const RiftDfaProfileCounters* counters, const char* path) {
+    if (!counters || !path) {
+        return false;
+    }
+
+    uint64_t* states = calloc(counters->state_count, sizeof(uint64_t));
+    uint64_t* edges = calloc(counters->edge_count ? counters->edge_count : 1, sizeof(uint64_t));
+    if (!states || !edges) {
+        free(states);
+        free(edges);
+        return false;
+    }
+
+    int merged = load_existing(counters, path, states, edges);
+    if (merged < 0) {
+        free(states);
+        free(edges);
+        return false;
+    }
+    if (merged == 0) {
+        /* Absent, or stale for another DFA: start from this run only */
+        memset(states, 0, counters->state_count * sizeof(uint64_t));
+        memset(edges, 0, counters->edge_count * sizeof(uint64_t));
+    }
+
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        free(states);
+        free(edges);
+        return false;
+    }
+
+    fprintf(out, "# rift-0 DFA profile (rift_lexgen --dfa-profile)\n");
+    fprintf(out, "fingerprint %016" PRIx64 "\n", counters->fingerprint);
+    fprintf(out, "states %" PRIu32 "\n", counters->state_count);
+    for (uint32_t i = 0; i < counters->state_count; i++) {
+        uint64_t count = states[i] + counters->state_visits[i];
+        if (count > 0) {
+            fprintf(out, "state %" PRIu32 " %" PRIu64 "\n", i, count);
+        }
+    }
+    for (uint32_t i = 0; i < counters->edge_count; i++) {
+        uint64_t count = edges[i] + counters->edge_visits[i];
+        if (count > 0) {
+            fprintf(out, "edge %u %u %" PRIu64 "\n",
+                    (unsigned)counters->edge_from[i], (unsigned)counters->edge_to[i], count);
+        }
+    }
+
+    bool ok = !ferror(out);
+    ok = (fclose(out) == 0) && ok;
+    free(states);
+    free(edges);
+    return ok;
+}
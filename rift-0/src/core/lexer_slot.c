@@ -0,0 +1,234 @@
+/*
+ * =================================================================
+ * lexer_slot.c - RIFT-0 Hot-Swappable Lexer Generations
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Atomic publication and epoch reclamation of rule sets
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(RiftLexerSlot, Publish, Enter, Exit, Reclaim)
+ * R.FLAGS(atomic_swap, epoch_reclaim, wait_free_readers)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/lexer_slot.h"
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#define RIFT_LEXER_SLOT_QUIESCENT   0
+#define RIFT_LEXER_SLOT_CACHE_LINE  64
+
+/* =================================================================
+ * INTERNAL STRUCTURES
+ * =================================================================
+ */
+
+/* One per worker; padded so readers never share a cache line */
+typedef struct {
+    alignas(RIFT_LEXER_SLOT_CACHE_LINE) atomic_uint_fast64_t epoch;
+    atomic_bool in_use;
+} ReaderRecord;
+
+typedef struct {
+    const CompiledLexer* lexer;
+    uint64_t epoch;                 /* Global epoch when it was replaced */
+} RetiredGeneration;
+
+struct RiftLexerSlot {
+    _Atomic(const CompiledLexer*) current;
+    atomic_uint_fast64_t generation;
+    atomic_uint_fast64_t epoch;     /* Advanced once per publish */
+
+    ReaderRecord readers[RIFT_LEXER_SLOT_MAX_READERS];
+
+    pthread_mutex_t writer;         /* Serializes publish and reclaim */
+    RetiredGeneration* retired;
+    size_t retired_count;
+    size_t retired_capacity;
+};
+
+/*
+ * Release retired generations older than every active reader (writer
+ * lock held). A reader announces its epoch before loading current, so
+ * any reader that loaded a generation retired at epoch E announced an
+ * epoch <= E and is still visible here until it exits.
+ */
+static size_t reclaim_locked(RiftLexerSlot* slot) {
+    uint64_t oldest = UINT64_MAX;
+    for (size_t i = 0; i < RIFT_LEXER_SLOT_MAX_READERS; i++) {
+        uint64_t epoch = atomic_load(&slot->readers[i].epoch);
+        if (epoch != RIFT_LEXER_SLOT_QUIESCENT && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < slot->retired_count; i++) {
+        if (slot->retired[i].epoch < oldest) {
+            rift_lexer_release(slot->retired[i].lexer);
+        } else {
+            slot->retired[kept++] = slot->retired[i];
+        }
+    }
+    slot->retired_count = kept;
+    return kept;
+}
+
+/* =================================================================
+ * SLOT LIFECYCLE
+ * =================================================================
+ */
+
+/**
+ * Create a slot holding its first generation
+ * R.CREATE(CompiledLexer) -> RiftLexerSlot (generation 1)
+ */
+RiftLexerSlot* rift_lexer_slot_create(const CompiledLexer* initial) {
+    RiftLexerSlot* slot = aligned_alloc(RIFT_LEXER_SLOT_CACHE_LINE,
+                                        sizeof(RiftLexerSlot));
+    if (!slot) {
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&slot->writer, NULL) != 0) {
+        free(slot);
+        return NULL;
+    }
+
+    atomic_init(&slot->current, rift_lexer_retain(initial ? initial : rift_lexer_default()));
+    atomic_init(&slot->generation, 1);
+    atomic_init(&slot->epoch, 1);
+    for (size_t i = 0; i < RIFT_LEXER_SLOT_MAX_READERS; i++) {
+        atomic_init(&slot->readers[i].epoch, RIFT_LEXER_SLOT_QUIESCENT);
+        atomic_init(&slot->readers[i].in_use, false);
+    }
+    slot->retired = NULL;
+    slot->retired_count = 0;
+    slot->retired_capacity = 0;
+    return slot;
+}
+
+/**
+ * Destroy the slot and release every generation it holds
+ */
+void rift_lexer_slot_destroy(RiftLexerSlot* slot) {
+    if (!slot) return;
+
+    for (size_t i = 0; i < slot->retired_count; i++) {
+        rift_lexer_release(slot->retired[i].lexer);
+    }
+    rift_lexer_release(atomic_load(&slot->current));
+
+    pthread_mutex_destroy(&slot->writer);
+    free(slot->retired);
+    free(slot);
+}
+
+/* =================================================================
+ * READERS
+ * =================================================================
+ */
+
+int rift_lexer_slot_register(RiftLexerSlot* slot) {
+    if (!slot) return RIFT_LEXER_SLOT_NO_READER;
+
+    for (int i = 0; i < RIFT_LEXER_SLOT_MAX_READERS; i++) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&slot->readers[i].in_use, &expected, true)) {
+            return i;
+        }
+    }
+    return RIFT_LEXER_SLOT_NO_READER;
+}
+
+void rift_lexer_slot_unregister(RiftLexerSlot* slot, int reader) {
+    if (!slot || reader < 0 || reader >= RIFT_LEXER_SLOT_MAX_READERS) return;
+
+    atomic_store(&slot->readers[reader].epoch, RIFT_LEXER_SLOT_QUIESCENT);
+    atomic_store(&slot->readers[reader].in_use, false);
+}
+
+/**
+ * Pin the current generation until exit
+ * R.ENTER(RiftLexerSlot, reader) -> CompiledLexer
+ */
+const CompiledLexer* rift_lexer_slot_enter(RiftLexerSlot* slot, int reader) {
+    if (!slot || reader < 0 || reader >= RIFT_LEXER_SLOT_MAX_READERS) {
+        return NULL;
+    }
+
+    /* Sequentially consistent: the announcement must precede the load */
+    atomic_store(&slot->readers[reader].epoch, atomic_load(&slot->epoch));
+    return atomic_load(&slot->current);
+}
+
+void rift_lexer_slot_exit(RiftLexerSlot* slot, int reader) {
+    if (!slot || reader < 0 || reader >= RIFT_LEXER_SLOT_MAX_READERS) return;
+
+    atomic_store_explicit(&slot->readers[reader].epoch, RIFT_LEXER_SLOT_QUIESCENT,
+                          memory_order_release);
+}
+
+/* =================================================================
+ * WRITERS
+ * =================================================================
+ */
+
+/**
+ * Publish a new generation
+ * R.PUBLISH(RiftLexerSlot, CompiledLexer) -> generation number
+ */
+uint64_t rift_lexer_slot_publish(RiftLexerSlot* slot, const CompiledLexer* lexer) {
+    if (!slot || !lexer) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&slot->writer);
+
+    if (slot->retired_count == slot->retired_capacity) {
+        size_t new_capacity = slot->retired_capacity ? slot->retired_capacity * 2 : 4;
+        RetiredGeneration* grown = realloc(slot->retired,
+                                           new_capacity * sizeof(RetiredGeneration));
+        if (!grown) {
+            pthread_mutex_unlock(&slot->writer);
+            return 0;
+        }
+        slot->retired = grown;
+        slot->retired_capacity = new_capacity;
+    }
+
+    const CompiledLexer* previous = atomic_exchange(&slot->current, rift_lexer_retain(lexer));
+    uint64_t generation = atomic_fetch_add(&slot->generation, 1) + 1;
+
+    /* Readers entering from here on announce a later epoch */
+    slot->retired[slot->retired_count].lexer = previous;
+    slot->retired[slot->retired_count].epoch = atomic_fetch_add(&slot->epoch, 1);
+    slot->retired_count++;
+
+    reclaim_locked(slot);
+    pthread_mutex_unlock(&slot->writer);
+    return generation;
+}
+
+/**
+ * Release retired generations no reader can still see
+ * R.RECLAIM(RiftLexerSlot) -> generations still awaiting quiescence
+ */
+size_t rift_lexer_slot_reclaim(RiftLexerSlot* slot) {
+    if (!slot) return 0;
+
+    pthread_mutex_lock(&slot->writer);
+    size_t pending = reclaim_locked(slot);
+    pthread_mutex_unlock(&slot->writer);
+    return pending;
+}
+
+uint64_t rift_lexer_slot_generation(const RiftLexerSlot* slot) {
+    if (!slot) return 0;
+
+    RiftLexerSlot* mutable_slot = (RiftLexerSlot*)slot;
+    return atomic_load(&mutable_slot->generation);
+}
@@ -0,0 +1,176 @@
+/*
+ * =================================================================
+ * raw_string.c - RIFT-0 Raw String Literal Scanning
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: R"delim(...)delim" and R-pattern literal scanning
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(rift_raw_string_scan, rift_raw_string_split)
+ * R.FLAGS(simd_paren_search, delimiter_memcmp, zero_copy)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/raw_string.h"
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* =================================================================
+ * INTERNAL HELPERS
+ * =================================================================
+ */
+
+static inline bool is_flag_letter(char c) {
+    return c == 'g' || c == 'm' || c == 'i' || c == 't' || c == 'b';
+}
+
+/* Delimiter characters: anything but parens, backslash, quotes, space */
+static inline bool is_delimiter_char(char c) {
+    return c != '(' && c != ')' && c != '\\' && c != '"' && c != '\'' &&
+           c != ' ' && c != '\t' && c != '\n' && c != '\r' && c != '\f' && c != '\v';
+}
+
+/* Parse R, quote and delimiter up to '('; returns the body offset or 0 */
+static size_t parse_prefix(const char* data, size_t length, RiftRawString* out) {
+    if (length < 4 || data[0] != 'R' || (data[1] != '"' && data[1] != '\'')) {
+        return 0;
+    }
+
+    size_t i = 2;
+    while (i < length && data[i] != '(') {
+        if (i - 2 >= RIFT_RAW_DELIMITER_MAX || !is_delimiter_char(data[i])) {
+            return 0;
+        }
+        i++;
+    }
+    if (i >= length) {
+        return 0;
+    }
+
+    out->quote = data[1];
+    out->delimiter_offset = 2;
+    out->delimiter_length = i - 2;
+    out->body_offset = i + 1;
+    return out->body_offset;
+}
+
+/* Next ')' in [p, end), or NULL */
+static const char* find_close_paren(const char* p, const char* end) {
+#ifdef __SSE2__
+    const __m128i paren = _mm_set1_epi8(')');
+    for (; end - p >= 16; p += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)p);
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, paren));
+        if (mask) {
+            return p + __builtin_ctz(mask);
+        }
+    }
+#endif
+    return p < end ? memchr(p, ')', (size_t)(end - p)) : NULL;
+}
+
+/* =================================================================
+ * PUBLIC API
+ * =================================================================
+ */
+
+/**
+ * Scan a raw literal starting at data[0] == 'R'
+ * R.SCAN(data, length) -> Literal length, 0 if absent or unterminated
+ */
+size_t rift_raw_string_scan(const char* data, size_t length, RiftRawString* out) {
+    RiftRawString raw;
+    if (!data || parse_prefix(data, length, &raw) == 0) {
+        return 0;
+    }
+
+    const char* delimiter = data + raw.delimiter_offset;
+    const char* end = data + length;
+    size_t close_length = raw.delimiter_length + 1;    /* delimiter + quote */
+
+    const char* p = data + raw.body_offset;
+    for (;;) {
+        p = find_close_paren(p, end);
+        if (!p || (size_t)(end - p - 1) < close_length) {
+            return 0;                                   /* Unterminated */
+        }
+        if (p[close_length] == raw.quote &&
+            memcmp(p + 1, delimiter, raw.delimiter_length) == 0) {
+            break;
+        }
+        p++;
+    }
+
+    raw.body_length = (size_t)(p - data) - raw.body_offset;
+    raw.suffix_offset = (size_t)(p - data) + 1 + close_length;
+    raw.suffix_length = 0;
+    while (raw.suffix_offset + raw.suffix_length < length &&
+           is_flag_letter(data[raw.suffix_offset + raw.suffix_length])) {
+        raw.suffix_length++;
+    }
+    raw.length = raw.suffix_offset + raw.suffix_length;
+
+    if (out) {
+        *out = raw;
+    }
+    return raw.length;
+}
+
+/**
+ * Recover the layout of an already scanned literal
+ * R.SPLIT(literal, length) -> Layout without touching the body
+ */
+bool rift_raw_string_split(const char* literal, size_t length, RiftRawString* out) {
+    RiftRawString raw;
+    if (!literal || !out || parse_prefix(literal, length, &raw) == 0) {
+        return false;
+    }
+
+    /* Strip flag letters back to the closing quote */
+    size_t quote = length;
+    while (quote > raw.body_offset && is_flag_letter(literal[quote - 1])) {
+        quote--;
+    }
+    if (quote == raw.body_offset || literal[--quote] != raw.quote) {
+        return false;
+    }
+
+    /* ')' delimiter must sit right before the quote */
+    if (quote < raw.body_offset + raw.delimiter_length + 1) {
+        return false;
+    }
+    size_t close = quote - raw.delimiter_length - 1;
+    if (literal[close] != ')' ||
+        memcmp(literal + close + 1, literal + raw.delimiter_offset, raw.delimiter_length) != 0) {
+        return false;
+    }
+
+    raw.body_length = close - raw.body_offset;
+    raw.suffix_offset = quote + 1;
+    raw.suffix_length = length - raw.suffix_offset;
+    raw.length = length;
+    *out = raw;
+    return true;
+}
+
+/**
+ * Map suffix letters to TokenFlags
+ * R.FLAGS(gmitb) -> TOKEN_FLAG_* bits
+ */
+TokenFlags rift_raw_string_flags(const char* suffix, size_t length) {
+    unsigned flags = TOKEN_FLAG_NONE;
+    for (size_t i = 0; suffix && i < length; i++) {
+        switch (suffix[i]) {
+            case 'g': flags |= TOKEN_FLAG_GLOBAL; break;
+            case 'm': flags |= TOKEN_FLAG_MULTILINE; break;
+            case 'i': flags |= TOKEN_FLAG_IGNORECASE; break;
+            case 't': flags |= TOKEN_FLAG_TOPDOWN; break;
+            case 'b': flags |= TOKEN_FLAG_BOTTOMUP; break;
+        }
+    }
+    return (TokenFlags)flags;
+}
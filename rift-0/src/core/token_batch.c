@@ -0,0 +1,465 @@
+/*
+ * =================================================================
+ * token_batch.c - RIFT-0 Batch Tokenization Implementation
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Many small inputs -> one shared token arena
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(TokenBatch, InterleavedScan, ShardedScan)
+ * R.FLAGS(interleaved, arena_backed, shardable)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/token_batch.h"
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/utf8.h"
+#include "rift-0/core/number_parse.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* Inputs longer than this are scanned alone with incremental growth
+ * instead of reserving their worst case (one token per byte) up front */
+#define BATCH_LANE_MAX_INPUT    (64 * 1024)
+
+/* Fewer inputs per worker than this are not worth a thread */
+#define BATCH_MIN_SHARD_INPUTS  64
+
+/* =================================================================
+ * ARENA MANAGEMENT
+ * =================================================================
+ */
+
+void rift_token_batch_init(TokenBatch* batch) {
+    if (!batch) return;
+    memset(batch, 0, sizeof(*batch));
+}
+
+void rift_token_batch_free(TokenBatch* batch) {
+    if (!batch) return;
+
+    free(batch->tokens);
+    free(batch->spans);
+    free(batch->offsets);
+    free(batch->constants);
+    free(batch->constant_offsets);
+    memset(batch, 0, sizeof(*batch));
+}
+
+static bool batch_reserve_tokens(TokenBatch* batch, size_t needed) {
+    if (needed <= batch->token_capacity) {
+        return true;
+    }
+
+    size_t new_capacity = batch->token_capacity ? batch->token_capacity : RIFT_LEXER_DEFAULT_CAPACITY;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+
+    TokenTriplet* tokens = realloc(batch->tokens, new_capacity * sizeof(TokenTriplet));
+    if (!tokens) {
+        return false;
+    }
+    batch->tokens = tokens;
+
+    TokenSpan* spans = realloc(batch->spans, new_capacity * sizeof(TokenSpan));
+    if (!spans) {
+        return false;
+    }
+    batch->spans = spans;
+
+    batch->token_capacity = new_capacity;
+    return true;
+}
+
+static bool batch_reserve_offsets(TokenBatch* batch, size_t input_count) {
+    if (input_count + 1 <= batch->offsets_capacity) {
+        return true;
+    }
+
+    size_t* offsets = realloc(batch->offsets, (input_count + 1) * sizeof(size_t));
+    if (!offsets) {
+        return false;
+    }
+    batch->offsets = offsets;
+
+    size_t* constant_offsets = realloc(batch->constant_offsets, (input_count + 1) * sizeof(size_t));
+    if (!constant_offsets) {
+        return false;
+    }
+    batch->constant_offsets = constant_offsets;
+
+    batch->offsets_capacity = input_count + 1;
+    return true;
+}
+
+static bool batch_reserve_constants(TokenBatch* batch, size_t needed) {
+    if (needed <= batch->constant_capacity) {
+        return true;
+    }
+
+    size_t new_capacity = batch->constant_capacity ? batch->constant_capacity : RIFT_LEXER_DEFAULT_CAPACITY;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+
+    TokenConstant* constants = realloc(batch->constants, new_capacity * sizeof(TokenConstant));
+    if (!constants) {
+        return false;
+    }
+
+    batch->constants = constants;
+    batch->constant_capacity = new_capacity;
+    return true;
+}
+
+const TokenTriplet* rift_token_batch_tokens(const TokenBatch* batch, size_t input,
+                                            size_t* count) {
+    if (!batch || input >= batch->input_count) {
+        if (count) *count = 0;
+        return NULL;
+    }
+
+    if (count) *count = batch->offsets[input + 1] - batch->offsets[input];
+    return batch->tokens + batch->offsets[input];
+}
+
+const TokenSpan* rift_token_batch_spans(const TokenBatch* batch, size_t input,
+                                        size_t* count) {
+    if (!batch || input >= batch->input_count) {
+        if (count) *count = 0;
+        return NULL;
+    }
+
+    if (count) *count = batch->offsets[input + 1] - batch->offsets[input];
+    return batch->spans + batch->offsets[input];
+}
+
+const TokenConstant* rift_token_batch_constants(const TokenBatch* batch, size_t input,
+                                                size_t* count) {
+    if (!batch || input >= batch->input_count) {
+        if (count) *count = 0;
+        return NULL;
+    }
+
+    if (count) *count = batch->constant_offsets[input + 1] - batch->constant_offsets[input];
+    return batch->constants + batch->constant_offsets[input];
+}
+
+/* =================================================================
+ * INTERLEAVED SCAN
+ * =================================================================
+ */
+
+typedef struct {
+    const unsigned char* base;
+    const unsigned char* cursor;
+    const unsigned char* limit;
+    size_t region;                  /* First arena slot reserved for this lane */
+    size_t written;                 /* Tokens emitted so far */
+    size_t input;                   /* Index into the batch */
+} BatchLane;
+
+/* Same token stream as rift_tokenizer_process: trivia is skipped */
+static inline void lane_emit(const CompiledLexer* lexer, TokenBatch* batch, BatchLane* lane) {
+    TokenType type = TOKEN_UNKNOWN;
+    size_t length = rift_lexer_match(lexer, lane->cursor, lane->limit, &type);
+    if (length == 0) {
+        type = TOKEN_UNKNOWN;
+        length = rift_utf8_sequence_length(lane->cursor, lane->limit);
+    }
+
+    if (type == TOKEN_WHITESPACE || type == TOKEN_COMMENT) {
+        lane->cursor += length;
+        return;
+    }
+
+    size_t position = (size_t)(lane->cursor - lane->base);
+    size_t slot = lane->region + lane->written++;
+
+    batch->tokens[slot] = rift_token_create((uint8_t)type, (uint16_t)position, 0);
+    batch->spans[slot].offset = (uint32_t)position;
+    batch->spans[slot].length = (uint32_t)length;
+
+    lane->cursor += length;
+}
+
+/* Convert the numeric literals of one input once its tokens are final */
+static bool batch_finish_input(TokenBatch* batch, size_t input, const char* base, size_t first) {
+    batch->constant_offsets[input] = batch->constant_count;
+
+    for (size_t slot = first; slot < batch->token_count; slot++) {
+        if (batch->tokens[slot].type != TOKEN_LITERAL_NUMBER) {
+            continue;
+        }
+        if (!batch_reserve_constants(batch, batch->constant_count + 1)) {
+            return false;
+        }
+
+        TokenConstant* entry = &batch->constants[batch->constant_count++];
+        entry->token = (uint32_t)(slot - first);
+        if (!rift_number_parse(base + batch->spans[slot].offset, batch->spans[slot].length,
+                               &entry->number)) {
+            entry->number.kind = RIFT_NUMBER_INVALID;
+            entry->number.as.integer = 0;
+        }
+    }
+    return true;
+}
+
+/* Scan one large input on its own, growing the arena as it goes */
+static bool scan_single(const CompiledLexer* lexer, TokenBatch* batch,
+                        size_t input_index, const char* input, size_t length) {
+    BatchLane lane = {
+        .base = (const unsigned char*)input,
+        .cursor = (const unsigned char*)input,
+        .limit = (const unsigned char*)input + length,
+        .region = batch->token_count,
+        .written = 0
+    };
+
+    while (lane.cursor < lane.limit) {
+        if (!batch_reserve_tokens(batch, lane.region + lane.written + 1)) {
+            return false;
+        }
+        lane_emit(lexer, batch, &lane);
+    }
+
+    batch->token_count += lane.written;
+    return batch_finish_input(batch, input_index, input, lane.region);
+}
+
+/* Scan up to RIFT_BATCH_INTERLEAVE small inputs in lockstep. Each lane
+ * owns a region sized for its worst case; regions are compacted once
+ * every lane has finished. */
+static bool scan_lanes(const CompiledLexer* lexer, TokenBatch* batch,
+                       BatchLane* lanes, size_t lane_count, size_t reserve) {
+    if (!batch_reserve_tokens(batch, batch->token_count + reserve)) {
+        return false;
+    }
+
+    size_t active = lane_count;
+    while (active > 0) {
+        active = 0;
+        for (size_t k = 0; k < lane_count; k++) {
+            if (lanes[k].cursor < lanes[k].limit) {
+                lane_emit(lexer, batch, &lanes[k]);
+                active++;
+            }
+        }
+    }
+
+    for (size_t k = 0; k < lane_count; k++) {
+        size_t first = batch->token_count;
+        batch->offsets[lanes[k].input] = first;
+        if (lanes[k].region != first) {
+            memmove(batch->tokens + first, batch->tokens + lanes[k].region,
+                    lanes[k].written * sizeof(TokenTriplet));
+            memmove(batch->spans + first, batch->spans + lanes[k].region,
+                    lanes[k].written * sizeof(TokenSpan));
+        }
+        batch->token_count += lanes[k].written;
+        if (!batch_finish_input(batch, lanes[k].input, (const char*)lanes[k].base, first)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Tokenize n inputs into one arena
+ * R.PROCESS_BATCH(CompiledLexer, inputs[]) -> Interleaved single-thread scan
+ */
+bool rift_tokenizer_process_batch(const CompiledLexer* lexer,
+                                  const char* const inputs[],
+                                  const size_t lengths[],
+                                  size_t n,
+                                  TokenBatch* out) {
+    if (!lexer || !out || (n > 0 && (!inputs || !lengths))) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (inputs[i] && !rift_utf8_validate(inputs[i], lengths[i], NULL)) {
+            return false;
+        }
+    }
+    if (!batch_reserve_offsets(out, n)) {
+        return false;
+    }
+
+    out->token_count = 0;
+    out->constant_count = 0;
+    out->input_count = n;
+
+    BatchLane lanes[RIFT_BATCH_INTERLEAVE];
+    size_t lane_count = 0;
+    size_t reserve = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        size_t length = inputs[i] ? lengths[i] : 0;
+
+        if (length > BATCH_LANE_MAX_INPUT) {
+            /* Flush pending lanes first so offsets stay in input order */
+            if (lane_count > 0 && !scan_lanes(lexer, out, lanes, lane_count, reserve)) {
+                return false;
+            }
+            lane_count = 0;
+            reserve = 0;
+
+            out->offsets[i] = out->token_count;
+            if (!scan_single(lexer, out, i, inputs[i], length)) {
+                return false;
+            }
+            continue;
+        }
+
+        BatchLane* lane = &lanes[lane_count++];
+        lane->base = (const unsigned char*)inputs[i];
+        lane->cursor = lane->base;
+        lane->limit = lane->base + length;
+        lane->region = out->token_count + reserve;
+        lane->written = 0;
+        lane->input = i;
+        reserve += length;
+
+        if (lane_count == RIFT_BATCH_INTERLEAVE) {
+            if (!scan_lanes(lexer, out, lanes, lane_count, reserve)) {
+                return false;
+            }
+            lane_count = 0;
+            reserve = 0;
+        }
+    }
+
+    if (lane_count > 0 && !scan_lanes(lexer, out, lanes, lane_count, reserve)) {
+        return false;
+    }
+
+    out->offsets[n] = out->token_count;
+    out->constant_offsets[n] = out->constant_count;
+    return true;
+}
+
+/* =================================================================
+ * SHARDED SCAN
+ * =================================================================
+ */
+
+typedef struct {
+    const CompiledLexer* lexer;
+    const char* const* inputs;
+    const size_t* lengths;
+    size_t count;
+    TokenBatch batch;
+    bool ok;
+} BatchShard;
+
+static void* shard_worker(void* arg) {
+    BatchShard* shard = arg;
+    shard->ok = rift_tokenizer_process_batch(shard->lexer, shard->inputs, shard->lengths,
+                                             shard->count, &shard->batch);
+    return NULL;
+}
+
+/**
+ * Tokenize n inputs across worker threads
+ * R.PROCESS_BATCH(CompiledLexer, inputs[], threads) -> Ordered concatenation
+ */
+bool rift_tokenizer_process_batch_parallel(const CompiledLexer* lexer,
+                                           const char* const inputs[],
+                                           const size_t lengths[],
+                                           size_t n,
+                                           TokenBatch* out,
+                                           size_t thread_count) {
+    size_t max_shards = n / BATCH_MIN_SHARD_INPUTS;
+    if (thread_count > max_shards) {
+        thread_count = max_shards;
+    }
+    if (thread_count <= 1) {
+        return rift_tokenizer_process_batch(lexer, inputs, lengths, n, out);
+    }
+    if (!lexer || !out || !inputs || !lengths) {
+        return false;
+    }
+
+    BatchShard* shards = calloc(thread_count, sizeof(BatchShard));
+    pthread_t* threads = calloc(thread_count, sizeof(pthread_t));
+    bool* started = calloc(thread_count, sizeof(bool));
+    if (!shards || !threads || !started) {
+        free(shards);
+        free(threads);
+        free(started);
+        return false;
+    }
+
+    /* Contiguous ranges keep the concatenated arena in input order */
+    size_t begin = 0;
+    for (size_t t = 0; t < thread_count; t++) {
+        size_t count = n / thread_count + (t < n % thread_count ? 1 : 0);
+        shards[t].lexer = lexer;
+        shards[t].inputs = inputs + begin;
+        shards[t].lengths = lengths + begin;
+        shards[t].count = count;
+        rift_token_batch_init(&shards[t].batch);
+        begin += count;
+    }
+
+    /* The calling thread takes shard 0 */
+    for (size_t t = 1; t < thread_count; t++) {
+        started[t] = pthread_create(&threads[t], NULL, shard_worker, &shards[t]) == 0;
+        if (!started[t]) {
+            shard_worker(&shards[t]);
+        }
+    }
+    shard_worker(&shards[0]);
+
+    bool ok = true;
+    size_t total_tokens = 0;
+    size_t total_constants = 0;
+    for (size_t t = 0; t < thread_count; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+        ok = ok && shards[t].ok;
+        total_tokens += shards[t].batch.token_count;
+        total_constants += shards[t].batch.constant_count;
+    }
+
+    ok = ok && batch_reserve_offsets(out, n) && batch_reserve_tokens(out, total_tokens) &&
+         batch_reserve_constants(out, total_constants);
+    if (ok) {
+        size_t token_base = 0;
+        size_t constant_base = 0;
+        size_t input_base = 0;
+        for (size_t t = 0; t < thread_count; t++) {
+            const TokenBatch* local = &shards[t].batch;
+            memcpy(out->tokens + token_base, local->tokens, local->token_count * sizeof(TokenTriplet));
+            memcpy(out->spans + token_base, local->spans, local->token_count * sizeof(TokenSpan));
+            memcpy(out->constants + constant_base, local->constants,
+                   local->constant_count * sizeof(TokenConstant));
+            for (size_t i = 0; i < local->input_count; i++) {
+                out->offsets[input_base + i] = token_base + local->offsets[i];
+                out->constant_offsets[input_base + i] = constant_base + local->constant_offsets[i];
+            }
+            token_base += local->token_count;
+            constant_base += local->constant_count;
+            input_base += local->input_count;
+        }
+        out->token_count = total_tokens;
+        out->constant_count = total_constants;
+        out->input_count = n;
+        out->offsets[n] = total_tokens;
+        out->constant_offsets[n] = total_constants;
+    }
+
+    for (size_t t = 0; t < thread_count; t++) {
+        rift_token_batch_free(&shards[t].batch);
+    }
+    free(shards);
+    free(threads);
+    free(started);
+    return ok;
+}
@@ -0,0 +1,605 @@
+/*
+ * =================================================================
+ * token_output.c - RIFT-0 Buffered Token Output Implementation
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Text dumps (tokens/JSON/CSV/XML) without stdio formatting
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(OutputBuffer, TokenDump, ParallelRanges)
+ * R.FLAGS(reusable_buffers, parallel_ranges, ordered_concat)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L /* writev, IOV_MAX */
+
+#include "rift-0/core/token_output.h"
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/* =================================================================
+ * OUTPUT BUFFER
+ * =================================================================
+ */
+
+bool rift_output_init(OutputBuffer* out, int fd, size_t capacity) {
+    if (!out) {
+        return false;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->fd = fd;
+    out->capacity = capacity ? capacity : RIFT_OUTPUT_BUFFER_SIZE;
+    out->data = malloc(out->capacity);
+    if (!out->data) {
+        out->capacity = 0;
+        return false;
+    }
+    return true;
+}
+
+void rift_output_destroy(OutputBuffer* out) {
+    if (!out) return;
+
+    free(out->data);
+    memset(out, 0, sizeof(*out));
+    out->fd = -1;
+}
+
+/* Write every iovec fully, resuming after partial writes */
+static bool write_all(int fd, struct iovec* iov, int iov_count) {
+    while (iov_count > 0) {
+        int batch = iov_count < IOV_MAX ? iov_count : IOV_MAX;
+        ssize_t written = writev(fd, iov, batch);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+
+        size_t remaining = (size_t)written;
+        while (iov_count > 0 && remaining >= iov->iov_len) {
+            remaining -= iov->iov_len;
+            iov++;
+            iov_count--;
+        }
+        if (iov_count > 0) {
+            iov->iov_base = (char*)iov->iov_base + remaining;
+            iov->iov_len -= remaining;
+        }
+    }
+    return true;
+}
+
+bool rift_output_flush(OutputBuffer* out) {
+    if (!out || out->failed) {
+        return false;
+    }
+    if (out->fd < 0 || out->length == 0) {
+        return true;
+    }
+
+    struct iovec iov = { .iov_base = out->data, .iov_len = out->length };
+    if (!write_all(out->fd, &iov, 1)) {
+        out->failed = true;
+        return false;
+    }
+
+    out->length = 0;
+    return true;
+}
+
+bool rift_output_reserve(OutputBuffer* out, size_t n) {
+    if (out->failed) {
+        return false;
+    }
+    if (out->capacity - out->length >= n) {
+        return true;
+    }
+
+    /* File-backed buffers drain first and only grow for oversized writes */
+    if (out->fd >= 0 && !rift_output_flush(out)) {
+        return false;
+    }
+    if (out->capacity - out->length >= n) {
+        return true;
+    }
+
+    size_t capacity = out->capacity ? out->capacity : RIFT_OUTPUT_BUFFER_SIZE;
+    while (capacity - out->length < n) {
+        capacity *= 2;
+    }
+
+    char* data = realloc(out->data, capacity);
+    if (!data) {
+        out->failed = true;
+        return false;
+    }
+
+    out->data = data;
+    out->capacity = capacity;
+    return true;
+}
+
+void rift_output_bytes(OutputBuffer* out, const char* data, size_t length) {
+    if (!rift_output_reserve(out, length)) return;
+
+    memcpy(out->data + out->length, data, length);
+    out->length += length;
+}
+
+void rift_output_str(OutputBuffer* out, const char* str) {
+    rift_output_bytes(out, str, strlen(str));
+}
+
+void rift_output_char(OutputBuffer* out, char c) {
+    if (!rift_output_reserve(out, 1)) return;
+
+    out->data[out->length++] = c;
+}
+
+/* =================================================================
+ * NUMBER FORMATTING
+ * =================================================================
+ */
+
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+void rift_output_u64(OutputBuffer* out, uint64_t value) {
+    if (!rift_output_reserve(out, 20)) return;
+
+    char digits[20];
+    char* p = digits + sizeof(digits);
+
+    while (value >= 100) {
+        unsigned pair = (unsigned)(value % 100) * 2;
+        value /= 100;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+    }
+    if (value >= 10) {
+        unsigned pair = (unsigned)value * 2;
+        *--p = digit_pairs[pair + 1];
+        *--p = digit_pairs[pair];
+    } else {
+        *--p = (char)('0' + value);
+    }
+
+    size_t length = (size_t)(digits + sizeof(digits) - p);
+    memcpy(out->data + out->length, p, length);
+    out->length += length;
+}
+
+void rift_output_hex8(OutputBuffer* out, uint8_t value) {
+    static const char hex[] = "0123456789ABCDEF";
+    if (!rift_output_reserve(out, 4)) return;
+
+    char* p = out->data + out->length;
+    p[0] = '0';
+    p[1] = 'x';
+    p[2] = hex[value >> 4];
+    p[3] = hex[value & 0x0F];
+    out->length += 4;
+}
+
+/* =================================================================
+ * ESCAPING
+ * =================================================================
+ */
+
+static inline bool json_needs_escape(unsigned char c) {
+    return c == '"' || c == '\\' || c < 0x20;
+}
+
+/* Offset of the first byte that needs a JSON escape, or length */
+static size_t json_scan(const unsigned char* data, size_t length) {
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                    _mm_cmpeq_epi8(chunk, backslash));
+        /* min(c, 0x1F) == c exactly when c <= 0x1F */
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+
+        int mask = _mm_movemask_epi8(hits);
+        if (mask) {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (json_needs_escape(data[i])) {
+            return i;
+        }
+    }
+    return length;
+}
+
+void rift_output_json_escaped(OutputBuffer* out, const char* data, size_t length) {
+    static const char hex[] = "0123456789abcdef";
+    const unsigned char* p = (const unsigned char*)data;
+
+    while (length > 0) {
+        size_t run = json_scan(p, length);
+        rift_output_bytes(out, (const char*)p, run);
+        if (run == length) {
+            return;
+        }
+
+        unsigned char c = p[run];
+        char escape[6] = { '\\', 0 };
+        size_t escape_length = 2;
+        switch (c) {
+            case '"':  escape[1] = '"';  break;
+            case '\\': escape[1] = '\\'; break;
+            case '\b': escape[1] = 'b';  break;
+            case '\f': escape[1] = 'f';  break;
+            case '\n': escape[1] = 'n';  break;
+            case '\r': escape[1] = 'r';  break;
+            case '\t': escape[1] = 't';  break;
+            default:
+                memcpy(escape + 1, "u00", 3);
+                escape[4] = hex[c >> 4];
+                escape[5] = hex[c & 0x0F];
+                escape_length = 6;
+                break;
+        }
+        rift_output_bytes(out, escape, escape_length);
+
+        p += run + 1;
+        length -= run + 1;
+    }
+}
+
+void rift_output_xml_escaped(OutputBuffer* out, const char* data, size_t length) {
+    size_t start = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        const char* entity = NULL;
+        switch (data[i]) {
+            case '&':  entity = "&amp;";  break;
+            case '<':  entity = "&lt;";   break;
+            case '>':  entity = "&gt;";   break;
+            case '"':  entity = "&quot;"; break;
+            case '\'': entity = "&apos;"; break;
+            default:   continue;
+        }
+        rift_output_bytes(out, data + start, i - start);
+        rift_output_str(out, entity);
+        start = i + 1;
+    }
+
+    rift_output_bytes(out, data + start, length - start);
+}
+
+void rift_output_csv_field(OutputBuffer* out, const char* data, size_t length) {
+    rift_output_char(out, '"');
+
+    const char* end = data + length;
+    while (data < end) {
+        const char* quote = memchr(data, '"', (size_t)(end - data));
+        if (!quote) {
+            rift_output_bytes(out, data, (size_t)(end - data));
+            break;
+        }
+        rift_output_bytes(out, data, (size_t)(quote - data) + 1);
+        rift_output_char(out, '"');
+        data = quote + 1;
+    }
+
+    rift_output_char(out, '"');
+}
+
+void rift_output_flags(OutputBuffer* out, uint8_t flags) {
+    static const char* names[8] = {
+        "GLOBAL", "MULTILINE", "IGNORECASE", "TOPDOWN",
+        "BOTTOMUP", "COMPOSED", "VALIDATED", "ERROR"
+    };
+
+    if (flags == TOKEN_FLAG_NONE) {
+        rift_output_bytes(out, "NONE", 4);
+        return;
+    }
+
+    bool first = true;
+    for (int bit = 0; bit < 8; bit++) {
+        if (flags & (1u << bit)) {
+            if (!first) rift_output_char(out, '|');
+            rift_output_str(out, names[bit]);
+            first = false;
+        }
+    }
+}
+
+/* =================================================================
+ * TOKEN RECORDS
+ * =================================================================
+ */
+
+typedef struct {
+    const char* name;
+    size_t length;
+} OutputName;
+
+/* Type and flag strings resolved once per dump */
+typedef struct {
+    RiftOutputFormat format;
+    OutputName types[256];
+    char flags[256][80];
+    uint8_t flag_lengths[256];
+} OutputTables;
+
+static void tables_init(OutputTables* tables, RiftOutputFormat format) {
+    tables->format = format;
+
+    for (int i = 0; i < 256; i++) {
+        tables->types[i].name = rift_token_type_to_string((TokenType)i);
+        tables->types[i].length = strlen(tables->types[i].name);
+
+        OutputBuffer scratch = {
+            .fd = -1, .data = tables->flags[i], .capacity = sizeof(tables->flags[i])
+        };
+        rift_output_flags(&scratch, (uint8_t)i);
+        tables->flag_lengths[i] = (uint8_t)scratch.length;
+    }
+}
+
+static void format_record(OutputBuffer* out, const OutputTables* tables,
+                          const TokenTriplet* token, size_t index, size_t count) {
+    const OutputName* type = &tables->types[token->type];
+    const char* flags = tables->flags[token->value];
+    size_t flags_length = tables->flag_lengths[token->value];
+
+    switch (tables->format) {
+        case RIFT_OUTPUT_TOKENS:
+            rift_output_u64(out, index);
+            rift_output_char(out, ' ');
+            rift_output_bytes(out, type->name, type->length);
+            rift_output_char(out, ' ');
+            rift_output_u64(out, token->mem_ptr);
+            rift_output_char(out, ' ');
+            rift_output_hex8(out, (uint8_t)token->value);
+            rift_output_char(out, ' ');
+            rift_output_bytes(out, flags, flags_length);
+            rift_output_char(out, '\n');
+            break;
+
+        case RIFT_OUTPUT_JSON:
+            rift_output_str(out, "    {\n      \"index\": ");
+            rift_output_u64(out, index);
+            rift_output_str(out, ",\n      \"type\": \"");
+            rift_output_bytes(out, type->name, type->length);
+            rift_output_str(out, "\",\n      \"mem_ptr\": ");
+            rift_output_u64(out, token->mem_ptr);
+            rift_output_str(out, ",\n      \"value\": ");
+            rift_output_u64(out, token->value);
+            rift_output_str(out, ",\n      \"flags\": \"");
+            rift_output_bytes(out, flags, flags_length);
+            rift_output_str(out, index + 1 < count ? "\"\n    },\n" : "\"\n    }\n");
+            break;
+
+        case RIFT_OUTPUT_CSV:
+            rift_output_u64(out, index);
+            rift_output_char(out, ',');
+            rift_output_bytes(out, type->name, type->length);
+            rift_output_char(out, ',');
+            rift_output_u64(out, token->mem_ptr);
+            rift_output_char(out, ',');
+            rift_output_u64(out, token->value);
+            rift_output_bytes(out, ",\"", 2);
+            rift_output_bytes(out, flags, flags_length);
+            rift_output_bytes(out, "\"\n", 2);
+            break;
+
+        case RIFT_OUTPUT_XML:
+            rift_output_str(out, "  <token index=\"");
+            rift_output_u64(out, index);
+            rift_output_str(out, "\" type=\"");
+            rift_output_bytes(out, type->name, type->length);
+            rift_output_str(out, "\" mem_ptr=\"");
+            rift_output_u64(out, token->mem_ptr);
+            rift_output_str(out, "\" value=\"");
+            rift_output_u64(out, token->value);
+            rift_output_str(out, "\" flags=\"");
+            rift_output_bytes(out, flags, flags_length);
+            rift_output_str(out, "\"/>\n");
+            break;
+    }
+}
+
+static void format_range(OutputBuffer* out, const OutputTables* tables,
+                         const TokenTriplet* tokens, size_t first, size_t last,
+                         size_t count) {
+    for (size_t i = first; i < last; i++) {
+        format_record(out, tables, &tokens[i], i, count);
+    }
+}
+
+static void format_header(OutputBuffer* out, RiftOutputFormat format,
+                          size_t count, const char* version) {
+    switch (format) {
+        case RIFT_OUTPUT_TOKENS:
+            rift_output_str(out, "# RIFT-0 Token Output\n");
+            rift_output_str(out, "# Format: Index Type MemPtr Value Flags\n");
+            break;
+
+        case RIFT_OUTPUT_JSON:
+            rift_output_str(out, "{\n  \"version\": \"");
+            rift_output_json_escaped(out, version, strlen(version));
+            rift_output_str(out, "\",\n  \"tokenizer\": \"rift-0\",\n  \"token_count\": ");
+            rift_output_u64(out, count);
+            rift_output_str(out, ",\n  \"tokens\": [\n");
+            break;
+
+        case RIFT_OUTPUT_CSV:
+            rift_output_str(out, "Index,Type,MemPtr,Value,Flags\n");
+            break;
+
+        case RIFT_OUTPUT_XML:
+            rift_output_str(out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+            rift_output_str(out, "<rift_tokens version=\"");
+            rift_output_xml_escaped(out, version, strlen(version));
+            rift_output_str(out, "\" count=\"");
+            rift_output_u64(out, count);
+            rift_output_str(out, "\">\n");
+            break;
+    }
+}
+
+static void format_footer(OutputBuffer* out, RiftOutputFormat format) {
+    if (format == RIFT_OUTPUT_JSON) {
+        rift_output_str(out, "  ]\n}\n");
+    } else if (format == RIFT_OUTPUT_XML) {
+        rift_output_str(out, "</rift_tokens>\n");
+    }
+}
+
+/* =================================================================
+ * PARALLEL RANGES
+ * =================================================================
+ */
+
+typedef struct {
+    const OutputTables* tables;
+    const TokenTriplet* tokens;
+    size_t first;
+    size_t last;
+    size_t count;
+    OutputBuffer buffer;            /* Memory-only, reused every round */
+} OutputWorker;
+
+static void* output_worker(void* arg) {
+    OutputWorker* worker = arg;
+    worker->buffer.length = 0;
+    format_range(&worker->buffer, worker->tables, worker->tokens,
+                 worker->first, worker->last, worker->count);
+    return NULL;
+}
+
+static bool write_parallel(OutputBuffer* out, const OutputTables* tables,
+                           const TokenTriplet* tokens, size_t count, size_t thread_count) {
+    OutputWorker* workers = calloc(thread_count, sizeof(OutputWorker));
+    pthread_t* threads = calloc(thread_count, sizeof(pthread_t));
+    bool* started = calloc(thread_count, sizeof(bool));
+    struct iovec* iov = calloc(thread_count + 1, sizeof(struct iovec));
+    bool ok = workers && threads && started && iov;
+
+    for (size_t t = 0; ok && t < thread_count; t++) {
+        workers[t].tables = tables;
+        workers[t].tokens = tokens;
+        workers[t].count = count;
+        ok = rift_output_init(&workers[t].buffer, -1, RIFT_OUTPUT_BUFFER_SIZE);
+    }
+
+    for (size_t next = 0; ok && next < count; ) {
+        size_t used = 0;
+        for (; used < thread_count && next < count; used++) {
+            workers[used].first = next;
+            workers[used].last = next + RIFT_OUTPUT_CHUNK_TOKENS < count
+                                 ? next + RIFT_OUTPUT_CHUNK_TOKENS : count;
+            next = workers[used].last;
+        }
+
+        /* Worker 0 runs on the calling thread */
+        for (size_t t = 1; t < used; t++) {
+            started[t] = pthread_create(&threads[t], NULL, output_worker, &workers[t]) == 0;
+            if (!started[t]) {
+                output_worker(&workers[t]);
+            }
+        }
+        output_worker(&workers[0]);
+
+        int iov_count = 0;
+        if (out->length > 0) {
+            iov[iov_count++] = (struct iovec){ out->data, out->length };
+        }
+        for (size_t t = 0; t < used; t++) {
+            if (started[t]) {
+                pthread_join(threads[t], NULL);
+                started[t] = false;
+            }
+            ok = ok && !workers[t].buffer.failed;
+            iov[iov_count++] = (struct iovec){ workers[t].buffer.data, workers[t].buffer.length };
+        }
+
+        /* Pending header bytes and every chunk leave in one writev */
+        ok = ok && write_all(out->fd, iov, iov_count);
+        out->length = 0;
+    }
+
+    for (size_t t = 0; workers && t < thread_count; t++) {
+        rift_output_destroy(&workers[t].buffer);
+    }
+    free(workers);
+    free(threads);
+    free(started);
+    free(iov);
+
+    out->failed = out->failed || !ok;
+    return ok;
+}
+
+/**
+ * Dump tokens to fd in the given format
+ * R.OUTPUT(TokenTriplet[], format) -> Ordered text on fd
+ */
+bool rift_output_write_tokens(int fd, RiftOutputFormat format,
+                              const TokenTriplet* tokens, size_t count,
+                              const char* version, size_t thread_count) {
+    if (fd < 0 || (count > 0 && !tokens)) {
+        return false;
+    }
+
+    OutputTables* tables = malloc(sizeof(OutputTables));
+    OutputBuffer out;
+    if (!tables || !rift_output_init(&out, fd, RIFT_OUTPUT_BUFFER_SIZE)) {
+        free(tables);
+        return false;
+    }
+    tables_init(tables, format);
+
+    format_header(&out, format, count, version ? version : "");
+
+    if (thread_count > 1 && count > RIFT_OUTPUT_CHUNK_TOKENS) {
+        write_parallel(&out, tables, tokens, count, thread_count);
+    } else {
+        format_range(&out, tables, tokens, 0, count, count);
+    }
+
+    format_footer(&out, format);
+    bool ok = rift_output_flush(&out);
+
+    rift_output_destroy(&out);
+    free(tables);
+    return ok;
+}
@@ -0,0 +1,637 @@
+/*
+ * =================================================================
+ * token_stream.c - RIFT-0 Binary Token Stream Implementation
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Framed token stream for stage handoff (OUTPUT_FORMAT_BINARY)
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(TokenStreamWriter, TokenStreamView, TokenStreamCursor)
+ * R.FLAGS(streaming_write, random_access, mmap_readable)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L /* fileno, mmap */
+
+#include "rift-0/core/token_stream.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define STREAM_MAGIC    "RTK0"
+#define TRAILER_MAGIC   "RTKE"
+
+/* Worst-case encoded bytes per token, per section */
+#define KIND_BYTES_MAX      12      /* type, value, 10-byte run */
+#define OFFSET_BYTES_MAX    10
+#define LENGTH_BYTES_MAX    5
+#define MEMPTR_BYTES_MAX    3
+
+/* =================================================================
+ * ENCODING PRIMITIVES
+ * =================================================================
+ */
+
+static inline void put_u16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static inline void put_u32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static inline void put_u64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static inline uint16_t get_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t get_u32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 3; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+static inline uint64_t get_u64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+static inline uint8_t* put_varint(uint8_t* p, uint64_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static inline bool get_varint(const uint8_t** p, const uint8_t* end, uint64_t* out) {
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64 && *p < end; shift += 7) {
+        uint8_t byte = *(*p)++;
+        v |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *out = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline uint64_t zigzag_encode(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t zigzag_decode(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+uint64_t rift_token_stream_hash(const void* data, size_t length) {
+    const uint8_t* bytes = data;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* =================================================================
+ * STREAMING WRITER
+ * =================================================================
+ */
+
+struct TokenStreamWriter {
+    FILE* out;
+    uint32_t flags;
+    long header_pos;                /* -1 when the output cannot seek */
+    uint64_t bytes_written;         /* Relative to the stream header */
+    uint64_t token_count;
+    bool failed;
+
+    TokenTriplet tokens[RIFT_TOKEN_STREAM_BLOCK_TOKENS];
+    TokenSpan spans[RIFT_TOKEN_STREAM_BLOCK_TOKENS];
+    size_t buffered;
+
+    uint64_t* block_offsets;
+    size_t block_count;
+    size_t block_capacity;
+
+    uint8_t* kinds;                 /* Per-section encode scratch */
+    uint8_t* offsets;
+    uint8_t* lengths;
+    uint8_t* memptrs;
+};
+
+static bool writer_emit(TokenStreamWriter* writer, const void* data, size_t size) {
+    if (size > 0 && fwrite(data, 1, size, writer->out) != size) {
+        writer->failed = true;
+        return false;
+    }
+    writer->bytes_written += size;
+    return true;
+}
+
+/* Encode and write the buffered tokens as one block */
+static bool writer_flush_block(TokenStreamWriter* writer) {
+    if (writer->buffered == 0) {
+        return true;
+    }
+
+    if (writer->block_count == writer->block_capacity) {
+        size_t capacity = writer->block_capacity ? writer->block_capacity * 2 : 16;
+        uint64_t* offsets = realloc(writer->block_offsets, capacity * sizeof(uint64_t));
+        if (!offsets) {
+            writer->failed = true;
+            return false;
+        }
+        writer->block_offsets = offsets;
+        writer->block_capacity = capacity;
+    }
+    writer->block_offsets[writer->block_count++] = writer->bytes_written;
+
+    uint8_t* kp = writer->kinds;
+    uint8_t* op = writer->offsets;
+    uint8_t* lp = writer->lengths;
+    uint8_t* mp = writer->memptrs;
+    bool memptr_mirrors_offset = true;
+    uint64_t prev_end = 0;
+
+    for (size_t i = 0; i < writer->buffered; ) {
+        /* Kinds: one run per stretch of equal (type, value) */
+        size_t run = 1;
+        while (i + run < writer->buffered &&
+               writer->tokens[i + run].type == writer->tokens[i].type &&
+               writer->tokens[i + run].value == writer->tokens[i].value) {
+            run++;
+        }
+        *kp++ = (uint8_t)writer->tokens[i].type;
+        *kp++ = (uint8_t)writer->tokens[i].value;
+        kp = put_varint(kp, run);
+
+        for (size_t end = i + run; i < end; i++) {
+            const TokenSpan* span = &writer->spans[i];
+            op = put_varint(op, zigzag_encode((int64_t)span->offset - (int64_t)prev_end));
+            lp = put_varint(lp, span->length);
+            mp = put_varint(mp, writer->tokens[i].mem_ptr);
+            memptr_mirrors_offset = memptr_mirrors_offset &&
+                                    writer->tokens[i].mem_ptr == (uint16_t)span->offset;
+            prev_end = (uint64_t)span->offset + span->length;
+        }
+    }
+
+    size_t kinds_bytes = (size_t)(kp - writer->kinds);
+    size_t offsets_bytes = (size_t)(op - writer->offsets);
+    size_t lengths_bytes = (size_t)(lp - writer->lengths);
+    size_t memptr_bytes = memptr_mirrors_offset ? 0 : (size_t)(mp - writer->memptrs);
+
+    uint8_t header[RIFT_TOKEN_STREAM_BLOCK_HEADER];
+    put_u32(header + 0, (uint32_t)writer->buffered);
+    put_u32(header + 4, (uint32_t)kinds_bytes);
+    put_u32(header + 8, (uint32_t)offsets_bytes);
+    put_u32(header + 12, (uint32_t)lengths_bytes);
+    put_u32(header + 16, (uint32_t)memptr_bytes);
+
+    bool ok = writer_emit(writer, header, sizeof(header)) &&
+              writer_emit(writer, writer->kinds, kinds_bytes) &&
+              writer_emit(writer, writer->offsets, offsets_bytes) &&
+              writer_emit(writer, writer->lengths, lengths_bytes) &&
+              writer_emit(writer, writer->memptrs, memptr_bytes);
+
+    writer->buffered = 0;
+    return ok;
+}
+
+/**
+ * Begin a binary token stream
+ * R.CREATE(TokenStreamWriter) -> Header emitted, block buffer ready
+ */
+TokenStreamWriter* rift_token_stream_writer_create(FILE* out, uint64_t source_hash,
+                                                   uint32_t flags) {
+    if (!out) {
+        return NULL;
+    }
+
+    TokenStreamWriter* writer = calloc(1, sizeof(TokenStreamWriter));
+    if (!writer) {
+        return NULL;
+    }
+
+    const size_t block = RIFT_TOKEN_STREAM_BLOCK_TOKENS;
+    writer->kinds = malloc(block * KIND_BYTES_MAX);
+    writer->offsets = malloc(block * OFFSET_BYTES_MAX);
+    writer->lengths = malloc(block * LENGTH_BYTES_MAX);
+    writer->memptrs = malloc(block * MEMPTR_BYTES_MAX);
+    if (!writer->kinds || !writer->offsets || !writer->lengths || !writer->memptrs) {
+        rift_token_stream_writer_destroy(writer);
+        return NULL;
+    }
+
+    writer->out = out;
+    writer->flags = flags;
+    writer->header_pos = ftell(out);
+
+    uint8_t header[RIFT_TOKEN_STREAM_HEADER_SIZE] = {0};
+    memcpy(header, STREAM_MAGIC, 4);
+    put_u16(header + 4, RIFT_TOKEN_STREAM_VERSION);
+    put_u16(header + 6, RIFT_TOKEN_STREAM_HEADER_SIZE);
+    put_u32(header + 8, flags);
+    put_u64(header + 16, source_hash);
+    put_u64(header + 24, RIFT_TOKEN_STREAM_UNKNOWN_COUNT);
+
+    if (!writer_emit(writer, header, sizeof(header))) {
+        rift_token_stream_writer_destroy(writer);
+        return NULL;
+    }
+
+    return writer;
+}
+
+bool rift_token_stream_write(TokenStreamWriter* writer,
+                             const TokenTriplet* tokens,
+                             const TokenSpan* spans,
+                             size_t count) {
+    if (!writer || writer->failed || (count > 0 && !tokens)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        writer->tokens[writer->buffered] = tokens[i];
+        if (spans) {
+            writer->spans[writer->buffered] = spans[i];
+        } else {
+            writer->spans[writer->buffered].offset = tokens[i].mem_ptr;
+            writer->spans[writer->buffered].length = 0;
+        }
+        writer->buffered++;
+
+        if (writer->buffered == RIFT_TOKEN_STREAM_BLOCK_TOKENS && !writer_flush_block(writer)) {
+            return false;
+        }
+    }
+
+    writer->token_count += count;
+    return true;
+}
+
+/**
+ * Close the stream
+ * R.FINISH(TokenStreamWriter) -> Final block, index, trailer, header patch
+ */
+bool rift_token_stream_writer_finish(TokenStreamWriter* writer) {
+    if (!writer || writer->failed || !writer_flush_block(writer)) {
+        return false;
+    }
+
+    uint64_t index_offset = 0;
+    if (writer->flags & RIFT_TOKEN_STREAM_FLAG_INDEX) {
+        index_offset = writer->bytes_written;
+        for (size_t i = 0; i < writer->block_count; i++) {
+            uint8_t entry[8];
+            put_u64(entry, writer->block_offsets[i]);
+            if (!writer_emit(writer, entry, sizeof(entry))) {
+                return false;
+            }
+        }
+    }
+
+    uint8_t trailer[RIFT_TOKEN_STREAM_TRAILER_SIZE];
+    put_u64(trailer + 0, index_offset);
+    put_u64(trailer + 8, writer->token_count);
+    put_u32(trailer + 16, (uint32_t)writer->block_count);
+    memcpy(trailer + 20, TRAILER_MAGIC, 4);
+    if (!writer_emit(writer, trailer, sizeof(trailer))) {
+        return false;
+    }
+
+    /* Seekable outputs also carry the count up front */
+    if (writer->header_pos >= 0 &&
+        fseek(writer->out, writer->header_pos + 24, SEEK_SET) == 0) {
+        uint8_t count[8];
+        put_u64(count, writer->token_count);
+        bool patched = fwrite(count, 1, sizeof(count), writer->out) == sizeof(count);
+        if (fseek(writer->out, 0, SEEK_END) != 0 || !patched) {
+            writer->failed = true;
+            return false;
+        }
+    }
+
+    return fflush(writer->out) == 0;
+}
+
+void rift_token_stream_writer_destroy(TokenStreamWriter* writer) {
+    if (!writer) return;
+
+    free(writer->block_offsets);
+    free(writer->kinds);
+    free(writer->offsets);
+    free(writer->lengths);
+    free(writer->memptrs);
+    free(writer);
+}
+
+/**
+ * Write a processed context as a binary stream
+ * R.OUTPUT(TokenizerContext) -> OUTPUT_FORMAT_BINARY
+ */
+bool rift_tokenizer_write_stream(const TokenizerContext* ctx, FILE* out, uint32_t flags) {
+    if (!ctx || !out) {
+        return false;
+    }
+
+    uint64_t hash = rift_token_stream_hash(ctx->input_buffer,
+                                           ctx->input_buffer ? ctx->input_length : 0);
+    TokenStreamWriter* writer = rift_token_stream_writer_create(out, hash, flags);
+    if (!writer) {
+        return false;
+    }
+
+    bool ok = rift_token_stream_write(writer, ctx->tokens, ctx->spans, ctx->token_count) &&
+              rift_token_stream_writer_finish(writer);
+
+    rift_token_stream_writer_destroy(writer);
+    return ok;
+}
+
+/* =================================================================
+ * READER
+ * =================================================================
+ */
+
+/**
+ * Validate stream framing over caller-owned bytes
+ * R.OPEN(TokenStreamView) -> Header, trailer and index located in place
+ */
+bool rift_token_stream_open(TokenStreamView* view, const void* data, size_t size) {
+    if (!view || !data) {
+        return false;
+    }
+
+    memset(view, 0, sizeof(*view));
+    const uint8_t* bytes = data;
+
+    if (size < RIFT_TOKEN_STREAM_HEADER_SIZE + RIFT_TOKEN_STREAM_TRAILER_SIZE ||
+        memcmp(bytes, STREAM_MAGIC, 4) != 0) {
+        return false;
+    }
+
+    view->header.version = get_u16(bytes + 4);
+    view->header.header_size = get_u16(bytes + 6);
+    view->header.flags = get_u32(bytes + 8);
+    view->header.source_hash = get_u64(bytes + 16);
+    view->header.token_count = get_u64(bytes + 24);
+    if (view->header.version != RIFT_TOKEN_STREAM_VERSION ||
+        view->header.header_size < RIFT_TOKEN_STREAM_HEADER_SIZE ||
+        view->header.header_size > size - RIFT_TOKEN_STREAM_TRAILER_SIZE) {
+        return false;
+    }
+
+    const uint8_t* trailer = bytes + size - RIFT_TOKEN_STREAM_TRAILER_SIZE;
+    if (memcmp(trailer + 20, TRAILER_MAGIC, 4) != 0) {
+        return false;
+    }
+
+    uint64_t index_offset = get_u64(trailer);
+    view->token_count = get_u64(trailer + 8);
+    view->block_count = get_u32(trailer + 16);
+    view->blocks_end = trailer;
+
+    if (view->header.token_count != RIFT_TOKEN_STREAM_UNKNOWN_COUNT &&
+        view->header.token_count != view->token_count) {
+        return false;
+    }
+
+    if (view->header.flags & RIFT_TOKEN_STREAM_FLAG_INDEX) {
+        uint64_t index_bytes = (uint64_t)view->block_count * 8;
+        if (index_offset < view->header.header_size ||
+            index_offset + index_bytes != size - RIFT_TOKEN_STREAM_TRAILER_SIZE) {
+            return false;
+        }
+        view->index = bytes + index_offset;
+        view->blocks_end = view->index;
+    }
+
+    view->data = bytes;
+    view->size = size;
+    return true;
+}
+
+/**
+ * Map a stream file read-only
+ * R.MAP(path) -> TokenStreamView backed by the page cache
+ */
+bool rift_token_stream_map(TokenStreamView* view, const char* path) {
+    if (!view || !path) {
+        return false;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    if (!rift_token_stream_open(view, data, size)) {
+        munmap(data, size);
+        return false;
+    }
+
+    view->mapped = true;
+    return true;
+}
+
+void rift_token_stream_close(TokenStreamView* view) {
+    if (!view) return;
+
+    if (view->mapped) {
+        munmap((void*)view->data, view->size);
+    }
+    memset(view, 0, sizeof(*view));
+}
+
+/* =================================================================
+ * LAZY CURSOR
+ * =================================================================
+ */
+
+void rift_token_stream_cursor_init(TokenStreamCursor* cursor, const TokenStreamView* view) {
+    if (!cursor) return;
+
+    memset(cursor, 0, sizeof(*cursor));
+    cursor->view = view;
+    if (view && view->data) {
+        cursor->block = view->data + view->header.header_size;
+    }
+}
+
+/* Enter the block at cursor->block and advance block to its successor */
+static bool cursor_load_block(TokenStreamCursor* cursor) {
+    const uint8_t* block = cursor->block;
+    const uint8_t* end = cursor->view->blocks_end;
+
+    if (!block || block >= end) {
+        return false;
+    }
+    if ((size_t)(end - block) < RIFT_TOKEN_STREAM_BLOCK_HEADER) {
+        cursor->corrupt = true;
+        return false;
+    }
+
+    uint32_t count = get_u32(block);
+    uint64_t sections[4] = {
+        get_u32(block + 4), get_u32(block + 8), get_u32(block + 12), get_u32(block + 16)
+    };
+    uint64_t payload = sections[0] + sections[1] + sections[2] + sections[3];
+
+    const uint8_t* p = block + RIFT_TOKEN_STREAM_BLOCK_HEADER;
+    if (count == 0 || payload > (uint64_t)(end - p)) {
+        cursor->corrupt = true;
+        return false;
+    }
+
+    cursor->kinds = p;
+    cursor->kinds_end = p += sections[0];
+    cursor->offsets = p;
+    cursor->offsets_end = p += sections[1];
+    cursor->lengths = p;
+    cursor->lengths_end = p += sections[2];
+    cursor->memptrs = sections[3] ? p : NULL;
+    cursor->memptrs_end = p += sections[3];
+
+    cursor->block = p;
+    cursor->block_remaining = count;
+    cursor->run_remaining = 0;
+    cursor->prev_end = 0;
+    return true;
+}
+
+/**
+ * Decode the next token in place
+ * R.NEXT(TokenStreamCursor) -> (TokenTriplet, TokenSpan)
+ */
+bool rift_token_stream_next(TokenStreamCursor* cursor, TokenTriplet* out_token,
+                            TokenSpan* out_span) {
+    if (!cursor || !cursor->view || cursor->corrupt) {
+        return false;
+    }
+
+    if (cursor->block_remaining == 0 && !cursor_load_block(cursor)) {
+        return false;
+    }
+
+    if (cursor->run_remaining == 0) {
+        uint64_t run = 0;
+        if (cursor->kinds_end - cursor->kinds < 2) {
+            cursor->corrupt = true;
+            return false;
+        }
+        cursor->run_type = *cursor->kinds++;
+        cursor->run_value = *cursor->kinds++;
+        if (!get_varint(&cursor->kinds, cursor->kinds_end, &run) || run == 0) {
+            cursor->corrupt = true;
+            return false;
+        }
+        cursor->run_remaining = run;
+    }
+
+    uint64_t delta = 0;
+    uint64_t length = 0;
+    uint64_t mem_ptr = 0;
+    if (!get_varint(&cursor->offsets, cursor->offsets_end, &delta) ||
+        !get_varint(&cursor->lengths, cursor->lengths_end, &length) ||
+        (cursor->memptrs && !get_varint(&cursor->memptrs, cursor->memptrs_end, &mem_ptr))) {
+        cursor->corrupt = true;
+        return false;
+    }
+
+    uint64_t offset = cursor->prev_end + (uint64_t)zigzag_decode(delta);
+    if (!cursor->memptrs) {
+        mem_ptr = (uint16_t)offset;
+    }
+
+    if (out_token) {
+        *out_token = rift_token_create(cursor->run_type, (uint16_t)mem_ptr, cursor->run_value);
+    }
+    if (out_span) {
+        out_span->offset = (uint32_t)offset;
+        out_span->length = (uint32_t)length;
+    }
+
+    cursor->prev_end = offset + length;
+    cursor->run_remaining--;
+    cursor->block_remaining--;
+    cursor->position++;
+    return true;
+}
+
+/**
+ * Position the cursor at token_index
+ * R.SEEK(TokenStreamCursor) -> Index lookup, or block-header walk without one
+ */
+bool rift_token_stream_seek(TokenStreamCursor* cursor, uint64_t token_index) {
+    if (!cursor || !cursor->view || !cursor->view->data ||
+        token_index > cursor->view->token_count) {
+        return false;
+    }
+
+    const TokenStreamView* view = cursor->view;
+    uint64_t block_number = token_index / RIFT_TOKEN_STREAM_BLOCK_TOKENS;
+
+    rift_token_stream_cursor_init(cursor, view);
+
+    if (block_number >= view->block_count) {
+        /* Seeking to the end of a stream of whole blocks */
+        cursor->block = view->blocks_end;
+        cursor->position = token_index;
+        return token_index == view->token_count;
+    }
+
+    if (view->index) {
+        uint64_t offset = get_u64(view->index + block_number * 8);
+        if (offset < view->header.header_size ||
+            offset >= (uint64_t)(view->blocks_end - view->data)) {
+            cursor->corrupt = true;
+            return false;
+        }
+        cursor->block = view->data + offset;
+    } else {
+        for (uint64_t b = 0; b < block_number; b++) {
+            if (!cursor_load_block(cursor)) {
+                cursor->corrupt = true;
+                return false;
+            }
+        }
+        cursor->block_remaining = 0;
+    }
+
+    cursor->position = block_number * RIFT_TOKEN_STREAM_BLOCK_TOKENS;
+    while (cursor->position < token_index) {
+        if (!rift_token_stream_next(cursor, NULL, NULL)) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -15,7 +15,13 @@
  * =================================================================
  */
 
+#define _POSIX_C_SOURCE 200809L /* strdup */
+
 #include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/utf8.h"
+#include "rift-0/core/raw_string.h"
+#include "rift-0/core/union_dfa.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -27,6 +33,10 @@
 #include <pthread.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* =================================================================
  * INTERNAL UTILITY MACROS
  * =================================================================
@@ -41,6 +51,17 @@
  * =================================================================
  */
 
+/* Drop cached patterns and their union DFA; the arrays are kept */
+static void tokenizer_clear_patterns(TokenizerContext* ctx) {
+    for (size_t i = 0; i < ctx->composition_count; i++) {
+        rift_regex_destroy(ctx->compositions[i]);
+        free(ctx->composition_names[i]);
+    }
+    ctx->composition_count = 0;
+    rift_union_dfa_destroy(ctx->pattern_dfa);
+    ctx->pattern_dfa = NULL;
+}
+
 /**
  * Create new tokenizer context with specified capacity
  * R.CREATE(TokenizerContext) -> AEGIS compliant initialization
@@ -62,13 +83,28 @@ TokenizerContext* rift_tokenizer_create(size_t initial_capacity) {
         return NULL;
     }
     
+    ctx->spans = calloc(initial_capacity, sizeof(TokenSpan));
+    if (!ctx->spans) {
+        free(ctx->tokens);
+        free(ctx);
+        return NULL;
+    }
+    
     ctx->token_capacity = initial_capacity;
     ctx->token_count = 0;
     
+    /* Share the immutable default rule set */
+    ctx->lexer = rift_lexer_retain(rift_lexer_default());
+    
     /* Initialize pattern storage */
     ctx->composition_capacity = RIFT_TOKENIZER_MAX_PATTERNS;
     ctx->compositions = calloc(ctx->composition_capacity, sizeof(RegexComposition*));
-    if (!ctx->compositions) {
+    ctx->composition_names = calloc(ctx->composition_capacity, sizeof(char*));
+    if (!ctx->compositions || !ctx->composition_names) {
+        free(ctx->compositions);
+        free(ctx->composition_names);
+        rift_lexer_release(ctx->lexer);
+        free(ctx->spans);
         free(ctx->tokens);
         free(ctx);
         return NULL;
@@ -76,6 +112,7 @@ TokenizerContext* rift_tokenizer_create(size_t initial_capacity) {
     
     /* Initialize state */
     ctx->input_buffer = NULL;
+    ctx->input_capacity = 0;
     ctx->input_length = 0;
     ctx->input_position = 0;
     ctx->dfa_root = NULL;
@@ -89,8 +126,9 @@ TokenizerContext* rift_tokenizer_create(size_t initial_capacity) {
     /* Initialize statistics */
     memset(&ctx->stats, 0, sizeof(TokenizerStats));
     ctx->stats.memory_allocated = sizeof(TokenizerContext) + 
-                                  (initial_capacity * sizeof(TokenTriplet)) +
-                                  (ctx->composition_capacity * sizeof(RegexComposition*));
+                                  (initial_capacity * (sizeof(TokenTriplet) + sizeof(TokenSpan))) +
+                                  (ctx->composition_capacity *
+                                   (sizeof(RegexComposition*) + sizeof(char*)));
     ctx->stats.memory_peak = ctx->stats.memory_allocated;
     
     return ctx;
@@ -105,6 +143,14 @@ void rift_tokenizer_destroy(TokenizerContext* ctx) {
     
     /* Free token storage */
     RIFT_SAFE_FREE(ctx->tokens);
+    RIFT_SAFE_FREE(ctx->spans);
+    RIFT_SAFE_FREE(ctx->trivia);
+    RIFT_SAFE_FREE(ctx->constants);
+    RIFT_SAFE_FREE(ctx->newlines);
+    
+    /* Drop shared rule set reference */
+    rift_lexer_release(ctx->lexer);
+    ctx->lexer = NULL;
     
     /* Free input buffer */
     RIFT_SAFE_FREE(ctx->input_buffer);
@@ -113,14 +159,9 @@ void rift_tokenizer_destroy(TokenizerContext* ctx) {
     RIFT_SAFE_FREE(ctx->error_message);
     
     /* Free pattern compositions */
-    if (ctx->compositions) {
-        for (size_t i = 0; i < ctx->composition_count; i++) {
-            if (ctx->compositions[i]) {
-                rift_regex_destroy(ctx->compositions[i]);
-            }
-        }
-        free(ctx->compositions);
-    }
+    tokenizer_clear_patterns(ctx);
+    RIFT_SAFE_FREE(ctx->compositions);
+    RIFT_SAFE_FREE(ctx->composition_names);
     
     /* Free DFA state machine */
     if (ctx->dfa_root) {
@@ -143,18 +184,31 @@ void rift_tokenizer_destroy(TokenizerContext* ctx) {
 /**
  * Reset tokenizer to initial state
  * R.RESET(TokenizerContext) -> Clean state preservation
+ *
+ * Token, span and input buffers stay at their high-water mark so a
+ * reused context performs no allocation; see rift_tokenizer_trim.
  */
 bool rift_tokenizer_reset(TokenizerContext* ctx) {
     if (!ctx) return false;
     
     /* Reset processing state */
     ctx->token_count = 0;
+    ctx->trivia_count = 0;
+    ctx->constant_count = 0;
+    ctx->newlines_valid = false;
     ctx->input_position = 0;
+    ctx->input_length = 0;
+    if (ctx->input_buffer) {
+        ctx->input_buffer[0] = '\0';
+    }
     ctx->has_error = false;
     
     /* Clear error message */
     RIFT_SAFE_FREE(ctx->error_message);
     
+    /* Cached patterns belong to the previous user (pooled contexts) */
+    tokenizer_clear_patterns(ctx);
+    
     /* Reset statistics (preserve allocations) */
     size_t memory_allocated = ctx->stats.memory_allocated;
     size_t memory_peak = ctx->stats.memory_peak;
@@ -165,28 +219,116 @@ bool rift_tokenizer_reset(TokenizerContext* ctx) {
     return true;
 }
 
+/**
+ * Release retained capacity above token_capacity and drop the input buffer
+ * R.TRIM(TokenizerContext) -> Return idle memory to the allocator
+ */
+bool rift_tokenizer_trim(TokenizerContext* ctx, size_t token_capacity) {
+    if (!ctx) return false;
+    
+    if (token_capacity == 0) {
+        token_capacity = RIFT_TOKENIZER_DEFAULT_CAPACITY;
+    }
+    if (token_capacity < ctx->token_count) {
+        token_capacity = ctx->token_count;
+    }
+    
+    if (token_capacity < ctx->token_capacity) {
+        TokenTriplet* tokens = realloc(ctx->tokens, token_capacity * sizeof(TokenTriplet));
+        if (!tokens) {
+            return false;
+        }
+        ctx->tokens = tokens;
+        
+        /* A failed span shrink leaves a larger block, which stays valid */
+        TokenSpan* spans = realloc(ctx->spans, token_capacity * sizeof(TokenSpan));
+        if (spans) {
+            ctx->spans = spans;
+        }
+        
+        ctx->stats.memory_allocated -= (ctx->token_capacity - token_capacity) *
+                                       (sizeof(TokenTriplet) + sizeof(TokenSpan));
+        ctx->token_capacity = token_capacity;
+    }
+    
+    if (ctx->trivia_count == 0 && ctx->trivia) {
+        ctx->stats.memory_allocated -= ctx->trivia_capacity * sizeof(TriviaEntry);
+        RIFT_SAFE_FREE(ctx->trivia);
+        ctx->trivia_capacity = 0;
+    }
+    
+    if (ctx->constant_count == 0 && ctx->constants) {
+        ctx->stats.memory_allocated -= ctx->constant_capacity * sizeof(TokenConstant);
+        RIFT_SAFE_FREE(ctx->constants);
+        ctx->constant_capacity = 0;
+    }
+    
+    if (!ctx->newlines_valid && ctx->newlines) {
+        ctx->stats.memory_allocated -= ctx->newline_capacity * sizeof(uint32_t);
+        RIFT_SAFE_FREE(ctx->newlines);
+        ctx->newline_capacity = 0;
+    }
+    
+    if (ctx->input_length == 0 && ctx->input_buffer) {
+        ctx->stats.memory_allocated -= ctx->input_capacity;
+        RIFT_SAFE_FREE(ctx->input_buffer);
+        ctx->input_capacity = 0;
+    }
+    
+    return true;
+}
+
+/**
+ * Bytes currently held by reusable buffers
+ */
+size_t rift_tokenizer_retained_bytes(const TokenizerContext* ctx) {
+    if (!ctx) return 0;
+    
+    return ctx->token_capacity * (sizeof(TokenTriplet) + sizeof(TokenSpan)) +
+           ctx->trivia_capacity * sizeof(TriviaEntry) +
+           ctx->constant_capacity * sizeof(TokenConstant) +
+           ctx->newline_capacity * sizeof(uint32_t) +
+           ctx->input_capacity;
+}
+
 /* =================================================================
  * INPUT MANAGEMENT FUNCTIONS
  * =================================================================
  */
 
+/**
+ * Grow the owned input buffer to hold length bytes plus terminator
+ * R.RESERVE(input) -> High-water mark reuse, no shrinking
+ */
+static bool tokenizer_reserve_input(TokenizerContext* ctx, size_t length) {
+    if (ctx->input_buffer && length + 1 <= ctx->input_capacity) {
+        return true;
+    }
+    
+    char* buffer = realloc(ctx->input_buffer, length + 1);
+    if (!buffer) {
+        ctx->has_error = true;
+        ctx->error_message = strdup("Memory allocation failed for input buffer");
+        return false;
+    }
+    
+    ctx->stats.memory_allocated += (length + 1) - ctx->input_capacity;
+    ctx->stats.memory_peak = RIFT_MAX(ctx->stats.memory_peak, ctx->stats.memory_allocated);
+    ctx->input_buffer = buffer;
+    ctx->input_capacity = length + 1;
+    return true;
+}
+
 /**
  * Set input text for processing
- * R.INPUT(buffer, length) -> Safe buffer management
+ * R.INPUT(buffer, length) -> Copy into the retained input buffer
  */
 bool rift_tokenizer_set_input(TokenizerContext* ctx, const char* input, size_t length) {
     if (!ctx || !input) {
         return false;
     }
     
-    /* Free existing buffer */
-    RIFT_SAFE_FREE(ctx->input_buffer);
-    
-    /* Allocate and copy new buffer */
-    ctx->input_buffer = malloc(length + 1);
-    if (!ctx->input_buffer) {
-        ctx->has_error = true;
-        ctx->error_message = strdup("Memory allocation failed for input buffer");
+    if (!tokenizer_reserve_input(ctx, length)) {
         return false;
     }
     
@@ -194,17 +336,14 @@ bool rift_tokenizer_set_input(TokenizerContext* ctx, const char* input, size_t l
     ctx->input_buffer[length] = '\0';
     ctx->input_length = length;
     ctx->input_position = 0;
-    
-    /* Update memory statistics */
-    ctx->stats.memory_allocated += length + 1;
-    ctx->stats.memory_peak = RIFT_MAX(ctx->stats.memory_peak, ctx->stats.memory_allocated);
+    ctx->newlines_valid = false;
     
     return true;
 }
 
 /**
  * Set input from file
- * R.INPUT(filename) -> File-based input loading
+ * R.INPUT(filename) -> Read directly into the retained input buffer
  */
 bool rift_tokenizer_set_input_file(TokenizerContext* ctx, const char* filename) {
     if (!ctx || !filename) {
@@ -230,33 +369,30 @@ bool rift_tokenizer_set_input_file(TokenizerContext* ctx, const char* filename)
         return false;
     }
     
-    /* Allocate buffer */
-    char* buffer = malloc(file_size + 1);
-    if (!buffer) {
+    if (!tokenizer_reserve_input(ctx, (size_t)file_size)) {
         fclose(file);
-        ctx->has_error = true;
-        ctx->error_message = strdup("Memory allocation failed for file buffer");
         return false;
     }
     
     /* Read file */
-    size_t bytes_read = fread(buffer, 1, file_size, file);
+    size_t bytes_read = fread(ctx->input_buffer, 1, (size_t)file_size, file);
     fclose(file);
     
     if (bytes_read != (size_t)file_size) {
-        free(buffer);
+        ctx->input_length = 0;
+        ctx->newlines_valid = false;
+        ctx->input_buffer[0] = '\0';
         ctx->has_error = true;
         ctx->error_message = strdup("Failed to read complete file");
         return false;
     }
     
-    buffer[file_size] = '\0';
-    
-    /* Set input using buffer */
-    bool result = rift_tokenizer_set_input(ctx, buffer, file_size);
-    free(buffer);
+    ctx->input_buffer[file_size] = '\0';
+    ctx->input_length = (size_t)file_size;
+    ctx->input_position = 0;
+    ctx->newlines_valid = false;
     
-    return result;
+    return true;
 }
 
 /* =================================================================
@@ -264,9 +400,89 @@ bool rift_tokenizer_set_input_file(TokenizerContext* ctx, const char* filename)
  * =================================================================
  */
 
+/**
+ * Bind a compiled rule set to this context
+ * R.BIND(TokenizerContext, CompiledLexer) -> Shared rules, private state
+ */
+bool rift_tokenizer_set_lexer(TokenizerContext* ctx, const CompiledLexer* lexer) {
+    if (!ctx || !lexer) {
+        return false;
+    }
+    
+    const CompiledLexer* previous = ctx->lexer;
+    ctx->lexer = rift_lexer_retain(lexer);
+    rift_lexer_release(previous);
+    return true;
+}
+
+/**
+ * Record one whitespace or comment match in the trivia table
+ * R.TRIVIA(type, span) -> Side table keyed by preceding significant token
+ */
+static bool tokenizer_push_trivia(TokenizerContext* ctx, TokenType type,
+                                  size_t offset, size_t length) {
+    if (ctx->trivia_count == ctx->trivia_capacity) {
+        size_t new_capacity = ctx->trivia_capacity ? ctx->trivia_capacity * 2 
+                                                   : RIFT_TOKENIZER_DEFAULT_CAPACITY;
+        TriviaEntry* trivia = realloc(ctx->trivia, new_capacity * sizeof(TriviaEntry));
+        if (!trivia) {
+            ctx->has_error = true;
+            ctx->error_message = strdup("Trivia capacity expansion failed");
+            return false;
+        }
+        ctx->stats.memory_allocated += (new_capacity - ctx->trivia_capacity) * sizeof(TriviaEntry);
+        ctx->stats.memory_peak = RIFT_MAX(ctx->stats.memory_peak, ctx->stats.memory_allocated);
+        ctx->trivia = trivia;
+        ctx->trivia_capacity = new_capacity;
+    }
+    
+    TriviaEntry* entry = &ctx->trivia[ctx->trivia_count++];
+    entry->anchor = (uint32_t)ctx->token_count;
+    entry->offset = (uint32_t)offset;
+    entry->length = (uint32_t)length;
+    entry->type = (uint8_t)type;
+    return true;
+}
+
+/**
+ * Convert one numeric literal into the constant table
+ * R.CONVERT(token, span) -> Side table keyed by token index
+ */
+static bool tokenizer_push_constant(TokenizerContext* ctx, size_t offset, size_t length) {
+    if (ctx->constant_count == ctx->constant_capacity) {
+        size_t new_capacity = ctx->constant_capacity ? ctx->constant_capacity * 2
+                                                     : RIFT_TOKENIZER_DEFAULT_CAPACITY;
+        TokenConstant* constants = realloc(ctx->constants, new_capacity * sizeof(TokenConstant));
+        if (!constants) {
+            ctx->has_error = true;
+            ctx->error_message = strdup("Constant capacity expansion failed");
+            return false;
+        }
+        ctx->stats.memory_allocated += (new_capacity - ctx->constant_capacity) * sizeof(TokenConstant);
+        ctx->stats.memory_peak = RIFT_MAX(ctx->stats.memory_peak, ctx->stats.memory_allocated);
+        ctx->constants = constants;
+        ctx->constant_capacity = new_capacity;
+    }
+    
+    TokenConstant* entry = &ctx->constants[ctx->constant_count++];
+    entry->token = (uint32_t)ctx->token_count;
+    if (!rift_number_parse(ctx->input_buffer + offset, length, &entry->number)) {
+        entry->number.kind = RIFT_NUMBER_INVALID;
+        entry->number.as.integer = 0;
+    }
+    return true;
+}
+
 /**
  * Process input and generate tokens
- * R.PROCESS(TokenizerContext) -> DFA-based tokenization
+ * R.PROCESS(TokenizerContext) -> Lock-free scan over the shared lexer
+ *
+ * The compiled rules are immutable, so no lock is taken here even when
+ * thread safety is enabled; the context itself is owned by one thread.
+ * Whitespace and comments are routed to the trivia table (or dropped),
+ * so consumers see significant tokens only. Numeric literals are
+ * converted here, once, into the constant table. Input must be well-formed
+ * UTF-8: identifier rules match encoded bytes and never decode.
  */
 bool rift_tokenizer_process(TokenizerContext* ctx) {
     if (!ctx || !ctx->input_buffer) {
@@ -275,14 +491,27 @@ bool rift_tokenizer_process(TokenizerContext* ctx) {
     
     clock_t start_time = clock();
     ctx->token_count = 0;
+    ctx->trivia_count = 0;
+    ctx->constant_count = 0;
+    
+    size_t bad_offset = 0;
+    if (!rift_utf8_validate(ctx->input_buffer, ctx->input_length, &bad_offset)) {
+        char message[64];
+        snprintf(message, sizeof(message), "Invalid UTF-8 at byte %zu", bad_offset);
+        RIFT_SAFE_FREE(ctx->error_message);
+        ctx->error_message = strdup(message);
+        ctx->has_error = true;
+        ctx->stats.error_count++;
+        return false;
+    }
     
-    /* Basic whitespace-aware tokenization for demo */
-    size_t pos = 0;
-    while (pos < ctx->input_length) {
-        char ch = ctx->input_buffer[pos];
-        
-        /* Ensure token capacity */
-        if (ctx->token_count >= ctx->token_capacity) {
+    const unsigned char* base = (const unsigned char*)ctx->input_buffer;
+    const unsigned char* cursor = base;
+    const unsigned char* limit = base + ctx->input_length;
+    
+    while (cursor < limit) {
+        /* Ensure token capacity (one slot is kept for EOF) */
+        if (ctx->token_count + 1 >= ctx->token_capacity) {
             size_t new_capacity = ctx->token_capacity * 2;
             TokenTriplet* new_tokens = realloc(ctx->tokens, 
                                                new_capacity * sizeof(TokenTriplet));
@@ -292,36 +521,74 @@ bool rift_tokenizer_process(TokenizerContext* ctx) {
                 return false;
             }
             ctx->tokens = new_tokens;
+            
+            TokenSpan* new_spans = realloc(ctx->spans, new_capacity * sizeof(TokenSpan));
+            if (!new_spans) {
+                ctx->has_error = true;
+                ctx->error_message = strdup("Token capacity expansion failed");
+                return false;
+            }
+            ctx->spans = new_spans;
+            ctx->stats.memory_allocated += (new_capacity - ctx->token_capacity) *
+                                           (sizeof(TokenTriplet) + sizeof(TokenSpan));
+            ctx->stats.memory_peak = RIFT_MAX(ctx->stats.memory_peak, ctx->stats.memory_allocated);
             ctx->token_capacity = new_capacity;
         }
         
-        /* Simple character classification */
+        /* Longest match against the shared compiled rules */
         TokenType type = TOKEN_UNKNOWN;
-        if (ch >= 'a' && ch <= 'z') type = TOKEN_IDENTIFIER;
-        else if (ch >= 'A' && ch <= 'Z') type = TOKEN_IDENTIFIER;
-        else if (ch >= '0' && ch <= '9') type = TOKEN_LITERAL_NUMBER;
-        else if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r') type = TOKEN_WHITESPACE;
-        else if (ch == '+' || ch == '-' || ch == '*' || ch == '/') type = TOKEN_OPERATOR;
-        else type = TOKEN_PUNCTUATION;
+        size_t length = rift_lexer_match(ctx->lexer, cursor, limit, &type);
+        
+        /* Cached patterns win ties, like rule specs over the defaults */
+        if (ctx->pattern_dfa) {
+            TokenType pattern_type = TOKEN_UNKNOWN;
+            size_t pattern_length = rift_dfa_table_scan(rift_union_dfa_table(ctx->pattern_dfa),
+                                                        cursor, limit, &pattern_type);
+            if (pattern_length > 0 && pattern_length >= length) {
+                length = pattern_length;
+                type = pattern_type;
+            }
+        }
+        
+        if (length == 0) {
+            /* No rule matches: one unknown token per code point */
+            type = TOKEN_UNKNOWN;
+            length = rift_utf8_sequence_length(cursor, limit);
+        }
         
-        /* Create token */
-        ctx->tokens[ctx->token_count] = rift_token_create(type, pos, 0);
+        size_t offset = (size_t)(cursor - base);
+        if (type == TOKEN_WHITESPACE || type == TOKEN_COMMENT) {
+            if (ctx->keep_trivia && !tokenizer_push_trivia(ctx, type, offset, length)) {
+                return false;
+            }
+            cursor += length;
+            continue;
+        }
+        
+        if (type == TOKEN_LITERAL_NUMBER && !tokenizer_push_constant(ctx, offset, length)) {
+            return false;
+        }
+        
+        ctx->tokens[ctx->token_count] = rift_token_create(type, offset, 0);
+        ctx->spans[ctx->token_count].offset = (uint32_t)offset;
+        ctx->spans[ctx->token_count].length = (uint32_t)length;
         ctx->token_count++;
         
-        pos++;
+        cursor += length;
     }
     
     /* Add EOF token */
-    if (ctx->token_count < ctx->token_capacity) {
-        ctx->tokens[ctx->token_count] = rift_token_create(TOKEN_EOF, ctx->input_length, 0);
-        ctx->token_count++;
-    }
+    ctx->tokens[ctx->token_count] = rift_token_create(TOKEN_EOF, ctx->input_length, 0);
+    ctx->spans[ctx->token_count].offset = (uint32_t)ctx->input_length;
+    ctx->spans[ctx->token_count].length = 0;
+    ctx->token_count++;
     
     /* Update statistics */
     clock_t end_time = clock();
     ctx->stats.processing_time = ((double)(end_time - start_time)) / CLOCKS_PER_SEC;
     ctx->stats.tokens_processed = ctx->input_length;
     ctx->stats.tokens_generated = ctx->token_count;
+    ctx->stats.dfa_states_created = rift_lexer_dfa_state_count(ctx->lexer);
     
     return true;
 }
@@ -339,6 +606,261 @@ TokenTriplet* rift_tokenizer_get_tokens(TokenizerContext* ctx, size_t* count) {
     return ctx->tokens;
 }
 
+/**
+ * Get byte extents parallel to rift_tokenizer_get_tokens
+ * R.GET(spans, count) -> Token source ranges
+ */
+const TokenSpan* rift_tokenizer_get_spans(const TokenizerContext* ctx, size_t* count) {
+    if (!ctx || !count) {
+        return NULL;
+    }
+    
+    *count = ctx->token_count;
+    return ctx->spans;
+}
+
+/**
+ * Enable or disable trivia recording for subsequent processing
+ * R.CONFIGURE(keep_trivia) -> Formatters and LSP opt in; parsers do not
+ */
+void rift_tokenizer_set_trivia(TokenizerContext* ctx, bool keep_trivia) {
+    if (!ctx) return;
+    
+    ctx->keep_trivia = keep_trivia;
+    if (!keep_trivia) {
+        ctx->trivia_count = 0;
+    }
+}
+
+/**
+ * Get the whole trivia table, ordered by offset
+ */
+const TriviaEntry* rift_tokenizer_get_trivia(const TokenizerContext* ctx, size_t* count) {
+    if (!ctx || !count) {
+        return NULL;
+    }
+    
+    *count = ctx->trivia_count;
+    return ctx->trivia;
+}
+
+/* First trivia entry whose anchor is >= anchor (entries are sorted) */
+static size_t trivia_lower_bound(const TokenizerContext* ctx, size_t anchor) {
+    size_t low = 0;
+    size_t high = ctx->trivia_count;
+    
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (ctx->trivia[mid].anchor < anchor) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static const TriviaEntry* trivia_run(const TokenizerContext* ctx, size_t anchor, size_t* count) {
+    size_t first = trivia_lower_bound(ctx, anchor);
+    size_t last = first;
+    while (last < ctx->trivia_count && ctx->trivia[last].anchor == anchor) {
+        last++;
+    }
+    
+    *count = last - first;
+    return *count > 0 ? &ctx->trivia[first] : NULL;
+}
+
+/**
+ * Get the trivia between token_index and the next token
+ * R.GET(trivia, token) -> Binary search on the anchor column
+ */
+const TriviaEntry* rift_tokenizer_trivia_after(const TokenizerContext* ctx,
+                                               size_t token_index, size_t* count) {
+    if (!ctx || !count) {
+        return NULL;
+    }
+    
+    return trivia_run(ctx, token_index + 1, count);
+}
+
+/**
+ * Get the trivia before the first token
+ */
+const TriviaEntry* rift_tokenizer_leading_trivia(const TokenizerContext* ctx, size_t* count) {
+    if (!ctx || !count) {
+        return NULL;
+    }
+    
+    return trivia_run(ctx, 0, count);
+}
+
+/**
+ * Get the converted value of a numeric literal token
+ * R.GET(constant, token) -> Binary search on the token column
+ */
+const TokenConstant* rift_tokenizer_get_constant(const TokenizerContext* ctx,
+                                                 size_t token_index) {
+    if (!ctx) {
+        return NULL;
+    }
+    
+    size_t low = 0;
+    size_t high = ctx->constant_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (ctx->constants[mid].token < token_index) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    
+    if (low < ctx->constant_count && ctx->constants[low].token == token_index) {
+        return &ctx->constants[low];
+    }
+    return NULL;
+}
+
+/**
+ * Get the whole constant table, ordered by token index
+ */
+const TokenConstant* rift_tokenizer_get_constants(const TokenizerContext* ctx, size_t* count) {
+    if (!ctx || !count) {
+        return NULL;
+    }
+    
+    *count = ctx->constant_count;
+    return ctx->constants;
+}
+
+/**
+ * Get the body of a raw string token without copying
+ * R.GET(raw_body, token) -> Pointer into the input, not NUL-terminated
+ *
+ * The layout is recovered from the delimiter and suffix at both ends
+ * of the token span; the body itself is not rescanned.
+ */
+const char* rift_tokenizer_raw_body(const TokenizerContext* ctx, size_t token_index,
+                                    size_t* length, TokenFlags* flags) {
+    if (!ctx || !length || token_index >= ctx->token_count ||
+        ctx->tokens[token_index].type != TOKEN_LITERAL_STRING) {
+        return NULL;
+    }
+    
+    const TokenSpan* span = &ctx->spans[token_index];
+    const char* literal = ctx->input_buffer + span->offset;
+    RiftRawString raw;
+    if (!rift_raw_string_split(literal, span->length, &raw)) {
+        return NULL;
+    }
+    
+    *length = raw.body_length;
+    if (flags) {
+        *flags = rift_raw_string_flags(literal + raw.suffix_offset, raw.suffix_length);
+    }
+    return literal + raw.body_offset;
+}
+
+/* =================================================================
+ * SOURCE LOCATIONS
+ * =================================================================
+ */
+
+static bool tokenizer_push_newline(TokenizerContext* ctx, size_t offset) {
+    if (ctx->newline_count == ctx->newline_capacity) {
+        size_t new_capacity = ctx->newline_capacity ? ctx->newline_capacity * 2 : 256;
+        uint32_t* newlines = realloc(ctx->newlines, new_capacity * sizeof(uint32_t));
+        if (!newlines) {
+            return false;
+        }
+        ctx->stats.memory_allocated += (new_capacity - ctx->newline_capacity) * sizeof(uint32_t);
+        ctx->stats.memory_peak = RIFT_MAX(ctx->stats.memory_peak, ctx->stats.memory_allocated);
+        ctx->newlines = newlines;
+        ctx->newline_capacity = new_capacity;
+    }
+    
+    ctx->newlines[ctx->newline_count++] = (uint32_t)offset;
+    return true;
+}
+
+/**
+ * Record the offset of every '\n' in the current input
+ * R.INDEX(input) -> 16-byte compares; only blocks with a hit are walked
+ */
+static bool tokenizer_build_newlines(TokenizerContext* ctx) {
+    const unsigned char* input = (const unsigned char*)ctx->input_buffer;
+    size_t length = ctx->input_length;
+    size_t i = 0;
+    
+    ctx->newline_count = 0;
+    
+#ifdef __SSE2__
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(input + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+        while (mask) {
+            if (!tokenizer_push_newline(ctx, i + (size_t)__builtin_ctz(mask))) {
+                return false;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    
+    while (i < length) {
+        const unsigned char* hit = memchr(input + i, '\n', length - i);
+        if (!hit) break;
+        if (!tokenizer_push_newline(ctx, (size_t)(hit - input))) {
+            return false;
+        }
+        i = (size_t)(hit - input) + 1;
+    }
+    
+    ctx->newlines_valid = true;
+    return true;
+}
+
+/**
+ * Resolve a byte offset (e.g. TokenSpan.offset) to line and column
+ * R.LOCATE(offset) -> Binary search over the lazy newline table
+ *
+ * Tokens only carry offsets; diagnostics pay for line numbers when
+ * they ask. Offsets past the end clamp to the end of input.
+ */
+bool rift_tokenizer_get_location(TokenizerContext* ctx, size_t offset,
+                                 size_t* line, size_t* column) {
+    if (!ctx || !line || !column) {
+        return false;
+    }
+    
+    if (!ctx->newlines_valid && !tokenizer_build_newlines(ctx)) {
+        return false;
+    }
+    
+    if (offset > ctx->input_length) {
+        offset = ctx->input_length;
+    }
+    
+    /* Newlines strictly before offset */
+    size_t low = 0;
+    size_t high = ctx->newline_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (ctx->newlines[mid] < offset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    
+    size_t line_start = low ? (size_t)ctx->newlines[low - 1] + 1 : 0;
+    *line = low + 1;
+    *column = offset - line_start + 1;
+    return true;
+}
+
 /**
  * Get next token (streaming interface)
  * R.NEXT(TokenTriplet) -> Sequential token access
@@ -465,4 +987,27 @@ const char* rift_tokenizer_version(void) {
  */
 const char* rift_tokenizer_build_info(void) {
     return "RIFT-0 Tokenizer - AEGIS Framework - OBINexus Computing";
-}
\ No newline at end of file
+}
+
+/**
+ * Feature checks reported by the CLI --version output
+ */
+bool rift_tokenizer_has_dfa_support(void) {
+    return true;
+}
+
+bool rift_tokenizer_has_regex_compose(void) {
+    return true;
+}
+
+bool rift_tokenizer_has_thread_safety(void) {
+#ifdef RIFT_THREAD_SUPPORT
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool rift_tokenizer_has_caching(void) {
+    return true;
+}
@@ -0,0 +1,308 @@
+/*
+ * =================================================================
+ * tokenizer_pool.c - RIFT-0 Tokenizer Context Pool Implementation
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Checkout/return reuse of TokenizerContext instances
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(TokenizerPool, Checkout, Return, IdleTrim)
+ * R.FLAGS(thread_safe, lifo_reuse, idle_trim)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L /* clock_gettime */
+
+#include "rift-0/core/tokenizer_pool.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+/* =================================================================
+ * INTERNAL STRUCTURES
+ * =================================================================
+ */
+
+typedef struct {
+    TokenizerContext* ctx;
+    double returned_at;             /* Monotonic seconds */
+    bool trimmed;                   /* Buffers already released */
+} PoolSlot;
+
+struct TokenizerPool {
+    pthread_mutex_t mutex;
+    TokenizerPoolConfig config;
+
+    /* LIFO idle list: the most recently returned (warmest) context is
+     * on top, so the oldest entries sit at index 0 */
+    PoolSlot* idle;
+    size_t idle_count;
+
+    TokenizerPoolStats stats;
+
+    /* Hot-swap binding: the slot generation last seen by checkout */
+    int slot_reader;
+    const CompiledLexer* slot_lexer;
+};
+
+static double pool_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Trim idle contexts older than the policy threshold (lock held) */
+static size_t pool_trim_locked(TokenizerPool* pool, double now) {
+    size_t trimmed = 0;
+
+    for (size_t i = 0; i < pool->idle_count; i++) {
+        PoolSlot* slot = &pool->idle[i];
+        if (now - slot->returned_at < pool->config.idle_trim_seconds) {
+            break;  /* Younger entries lie above this one */
+        }
+        if (slot->trimmed) {
+            continue;
+        }
+        if (rift_tokenizer_trim(slot->ctx, pool->config.trim_capacity)) {
+            slot->trimmed = true;
+            trimmed++;
+        }
+    }
+
+    pool->stats.trims += trimmed;
+    return trimmed;
+}
+
+/*
+ * Reference to the slot's current generation (lock held). The pool's
+ * single reader record is serialized by the pool lock and only pins the
+ * slot long enough to retain what it loaded.
+ */
+static const CompiledLexer* pool_slot_lexer_locked(TokenizerPool* pool,
+                                                   const CompiledLexer** replaced) {
+    const CompiledLexer* current = rift_lexer_slot_enter(pool->config.lexer_slot,
+                                                         pool->slot_reader);
+    if (current != pool->slot_lexer) {
+        *replaced = pool->slot_lexer;
+        pool->slot_lexer = rift_lexer_retain(current);
+    }
+    rift_lexer_slot_exit(pool->config.lexer_slot, pool->slot_reader);
+
+    return rift_lexer_retain(pool->slot_lexer);
+}
+
+/* =================================================================
+ * POOL LIFECYCLE
+ * =================================================================
+ */
+
+/**
+ * Create a context pool
+ * R.CREATE(TokenizerPool) -> Empty idle list, shared lexer retained
+ */
+TokenizerPool* rift_tokenizer_pool_create(const TokenizerPoolConfig* config) {
+    TokenizerPool* pool = calloc(1, sizeof(TokenizerPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    if (config) {
+        pool->config = *config;
+    }
+    if (pool->config.max_idle == 0) {
+        pool->config.max_idle = RIFT_POOL_DEFAULT_MAX_IDLE;
+    }
+    if (pool->config.initial_capacity == 0) {
+        pool->config.initial_capacity = RIFT_TOKENIZER_DEFAULT_CAPACITY;
+    }
+    if (pool->config.trim_capacity == 0) {
+        pool->config.trim_capacity = pool->config.initial_capacity;
+    }
+    if (pool->config.idle_trim_seconds == 0.0) {
+        pool->config.idle_trim_seconds = RIFT_POOL_DEFAULT_IDLE_SECONDS;
+    } else if (pool->config.idle_trim_seconds == RIFT_POOL_TRIM_IMMEDIATE) {
+        pool->config.idle_trim_seconds = 0.0;
+    } else if (pool->config.idle_trim_seconds == RIFT_POOL_TRIM_NEVER) {
+        pool->config.idle_trim_seconds = HUGE_VAL;
+    }
+
+    pool->config.lexer = rift_lexer_retain(pool->config.lexer ? pool->config.lexer
+                                                              : rift_lexer_default());
+
+    pool->slot_reader = RIFT_LEXER_SLOT_NO_READER;
+    if (pool->config.lexer_slot) {
+        pool->slot_reader = rift_lexer_slot_register(pool->config.lexer_slot);
+    }
+
+    pool->idle = calloc(pool->config.max_idle, sizeof(PoolSlot));
+    if (!pool->idle || pthread_mutex_init(&pool->mutex, NULL) != 0 ||
+        (pool->config.lexer_slot && pool->slot_reader == RIFT_LEXER_SLOT_NO_READER)) {
+        rift_lexer_slot_unregister(pool->config.lexer_slot, pool->slot_reader);
+        rift_lexer_release(pool->config.lexer);
+        free(pool->idle);
+        free(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+/**
+ * Destroy the pool and every idle context
+ * Checked-out contexts remain owned by their callers.
+ */
+void rift_tokenizer_pool_destroy(TokenizerPool* pool) {
+    if (!pool) return;
+
+    for (size_t i = 0; i < pool->idle_count; i++) {
+        rift_tokenizer_destroy(pool->idle[i].ctx);
+    }
+
+    rift_lexer_slot_unregister(pool->config.lexer_slot, pool->slot_reader);
+    rift_lexer_release(pool->slot_lexer);
+    rift_lexer_release(pool->config.lexer);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->idle);
+    free(pool);
+}
+
+/* =================================================================
+ * CHECKOUT / RETURN
+ * =================================================================
+ */
+
+TokenizerContext* rift_tokenizer_pool_checkout(TokenizerPool* pool) {
+    if (!pool) return NULL;
+
+    TokenizerContext* ctx = NULL;
+    const CompiledLexer* lexer = pool->config.lexer;   /* Borrowed from the pool */
+    const CompiledLexer* owned = NULL;
+    const CompiledLexer* replaced = NULL;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->stats.checkouts++;
+    if (pool->idle_count > 0) {
+        ctx = pool->idle[--pool->idle_count].ctx;
+        pool->stats.hits++;
+    } else {
+        pool->stats.misses++;
+    }
+    pool->stats.active_contexts++;
+    if (pool->config.lexer_slot) {
+        lexer = owned = pool_slot_lexer_locked(pool, &replaced);
+    }
+    if (ctx && ctx->lexer != lexer) {
+        pool->stats.rebinds++;
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    /* Releases may free a retired generation; keep them outside the lock */
+    rift_lexer_release(replaced);
+
+    if (!ctx) {
+        /* Miss: allocate outside the lock */
+        ctx = rift_tokenizer_create(pool->config.initial_capacity);
+    }
+    if (!ctx || (ctx->lexer != lexer && !rift_tokenizer_set_lexer(ctx, lexer))) {
+        rift_lexer_release(owned);
+        rift_tokenizer_destroy(ctx);
+        pthread_mutex_lock(&pool->mutex);
+        pool->stats.active_contexts--;
+        pthread_mutex_unlock(&pool->mutex);
+        return NULL;
+    }
+
+    rift_lexer_release(owned);
+    return ctx;
+}
+
+void rift_tokenizer_pool_return(TokenizerPool* pool, TokenizerContext* ctx) {
+    if (!pool || !ctx) return;
+
+    /* Reset keeps buffers at their high-water mark */
+    rift_tokenizer_reset(ctx);
+    double now = pool_now();
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->stats.returns++;
+    pool->stats.active_contexts--;
+
+    bool keep = pool->idle_count < pool->config.max_idle;
+    if (keep) {
+        PoolSlot* slot = &pool->idle[pool->idle_count++];
+        slot->ctx = ctx;
+        slot->returned_at = now;
+        slot->trimmed = false;
+    } else {
+        pool->stats.discards++;
+    }
+
+    pool_trim_locked(pool, now);
+    pthread_mutex_unlock(&pool->mutex);
+
+    if (!keep) {
+        rift_tokenizer_destroy(ctx);
+    }
+}
+
+size_t rift_tokenizer_pool_trim(TokenizerPool* pool) {
+    if (!pool) return 0;
+
+    pthread_mutex_lock(&pool->mutex);
+    size_t trimmed = pool_trim_locked(pool, pool_now());
+    pthread_mutex_unlock(&pool->mutex);
+
+    return trimmed;
+}
+
+/* =================================================================
+ * STATISTICS
+ * =================================================================
+ */
+
+TokenizerPoolStats rift_tokenizer_pool_get_stats(const TokenizerPool* pool) {
+    TokenizerPoolStats stats = {0};
+    if (!pool) return stats;
+
+    TokenizerPool* mutable_pool = (TokenizerPool*)pool;
+    pthread_mutex_lock(&mutable_pool->mutex);
+    stats = pool->stats;
+    stats.idle_contexts = pool->idle_count;
+    stats.retained_bytes = 0;
+    for (size_t i = 0; i < pool->idle_count; i++) {
+        stats.retained_bytes += rift_tokenizer_retained_bytes(pool->idle[i].ctx);
+    }
+    pthread_mutex_unlock(&mutable_pool->mutex);
+
+    return stats;
+}
+
+double rift_tokenizer_pool_hit_rate(const TokenizerPoolStats* stats) {
+    if (!stats || stats->checkouts == 0) {
+        return 0.0;
+    }
+    return (double)stats->hits / (double)stats->checkouts;
+}
+
+void rift_tokenizer_pool_print_stats(const TokenizerPool* pool) {
+    if (!pool) return;
+
+    TokenizerPoolStats stats = rift_tokenizer_pool_get_stats(pool);
+
+    printf("=== RIFT-0 Tokenizer Pool Statistics ===\n");
+    printf("Checkouts: %llu\n", (unsigned long long)stats.checkouts);
+    printf("Hit Rate: %.2f%% (%llu hits, %llu misses)\n",
+           rift_tokenizer_pool_hit_rate(&stats) * 100.0,
+           (unsigned long long)stats.hits, (unsigned long long)stats.misses);
+    printf("Returns: %llu (%llu discarded)\n",
+           (unsigned long long)stats.returns, (unsigned long long)stats.discards);
+    printf("Idle Trims: %llu\n", (unsigned long long)stats.trims);
+    printf("Lexer Rebinds: %llu\n", (unsigned long long)stats.rebinds);
+    printf("Idle / Active Contexts: %zu / %zu\n", stats.idle_contexts, stats.active_contexts);
+    printf("Retained Bytes: %zu\n", stats.retained_bytes);
+    printf("========================================\n");
+}
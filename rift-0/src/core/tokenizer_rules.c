@@ -15,13 +15,17 @@
  * =================================================================
  */
 
+#define _POSIX_C_SOURCE 200809L /* strdup */
+
 #include "rift-0/core/tokenizer.h"
 #include "rift-0/core/tokenizer_rules.h"
+#include "rift-0/core/union_dfa.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <assert.h>
+#include <pthread.h>
 
 /* =================================================================
  * TOKENTRIPLET BITFIELD VALIDATION
@@ -91,6 +95,39 @@ const char* rift_token_type_to_string(TokenType type) {
     }
 }
 
+/**
+ * Token type name for CLI and diagnostic output
+ * R.NAME(TokenType) -> Same spelling as rift_token_type_to_string
+ */
+const char* rift_token_type_name(TokenType type) {
+    return rift_token_type_to_string(type);
+}
+
+/**
+ * Render token flags as "GLOBAL|MULTILINE|..." or "NONE"
+ * Returns a static buffer; not reentrant.
+ */
+const char* rift_token_flags_string(TokenFlags flags) {
+    static const char* names[8] = {
+        "GLOBAL", "MULTILINE", "IGNORECASE", "TOPDOWN",
+        "BOTTOMUP", "COMPOSED", "VALIDATED", "ERROR"
+    };
+    static char buffer[96];
+
+    if ((flags & 0xFF) == TOKEN_FLAG_NONE) return "NONE";
+
+    size_t length = 0;
+    for (int bit = 0; bit < 8; bit++) {
+        if (!(flags & (1u << bit))) continue;
+        if (length) buffer[length++] = '|';
+        size_t name_length = strlen(names[bit]);
+        memcpy(buffer + length, names[bit], name_length);
+        length += name_length;
+    }
+    buffer[length] = '\0';
+    return buffer;
+}
+
 /* =================================================================
  * DFA STATE MANAGEMENT FUNCTIONS
  * =================================================================
@@ -291,20 +328,58 @@ void rift_regex_destroy(RegexComposition* regex) {
  * =================================================================
  */
 
-/* Simple pattern cache for demonstration */
-static struct {
-    char* pattern_names[RIFT_TOKENIZER_MAX_PATTERNS];
-    RegexComposition* patterns[RIFT_TOKENIZER_MAX_PATTERNS];
-    size_t count;
-} pattern_cache = {0};
+/* Token type rift_regex_compile gave the pattern's final state */
+static TokenType regex_final_type(const RegexComposition* comp) {
+    const DFAState* state = comp->start_state;
+    while (state && !state->is_final) {
+        state = state->next_state;
+    }
+    return state ? state->token_type : TOKEN_UNKNOWN;
+}
+
+/* Grow the context's name and composition arrays together */
+static bool reserve_compositions(TokenizerContext* ctx) {
+    if (ctx->composition_count < ctx->composition_capacity) {
+        return true;
+    }
+    
+    size_t capacity = ctx->composition_capacity ? ctx->composition_capacity * 2
+                                                : RIFT_TOKENIZER_MAX_PATTERNS;
+    RegexComposition** compositions = realloc(ctx->compositions,
+                                              capacity * sizeof(RegexComposition*));
+    if (!compositions) {
+        return false;
+    }
+    ctx->compositions = compositions;
+    
+    char** names = realloc(ctx->composition_names, capacity * sizeof(char*));
+    if (!names) {
+        return false;
+    }
+    ctx->composition_names = names;
+    
+    ctx->stats.memory_allocated += (capacity - ctx->composition_capacity) *
+                                   (sizeof(RegexComposition*) + sizeof(char*));
+    if (ctx->stats.memory_allocated > ctx->stats.memory_peak) {
+        ctx->stats.memory_peak = ctx->stats.memory_allocated;
+    }
+    ctx->composition_capacity = capacity;
+    return true;
+}
 
 /**
  * Cache compiled pattern by name
  * R.CACHE(pattern_name, RegexComposition) -> Pattern storage
+ *
+ * Patterns belong to the context and are dropped by
+ * rift_tokenizer_reset. The literal is also added to the context's
+ * union DFA, which the tokenizer scans alongside its lexer. Each
+ * addition only touches the states on the new pattern's path (see
+ * union_dfa.h).
  */
 bool rift_tokenizer_cache_pattern(TokenizerContext* ctx, const char* name,
                                    const char* pattern, TokenFlags flags) {
-    if (!ctx || !name || !pattern || pattern_cache.count >= RIFT_TOKENIZER_MAX_PATTERNS) {
+    if (!ctx || !name || !pattern || !reserve_compositions(ctx)) {
         return false;
     }
     
@@ -314,14 +389,31 @@ bool rift_tokenizer_cache_pattern(TokenizerContext* ctx, const char* name,
         return false;
     }
     
-    /* Store in cache */
-    size_t index = pattern_cache.count;
-    pattern_cache.pattern_names[index] = strdup(name);
-    pattern_cache.patterns[index] = comp;
-    pattern_cache.count++;
+    char* stored_name = strdup(name);
+    if (!stored_name) {
+        rift_regex_destroy(comp);
+        return false;
+    }
+    
+    /* Combine with earlier patterns under the compiled classification */
+    if (!ctx->pattern_dfa) {
+        ctx->pattern_dfa = rift_union_dfa_create();
+    }
+    if (!ctx->pattern_dfa ||
+        !rift_union_dfa_add(ctx->pattern_dfa, pattern, comp->pattern_length,
+                            regex_final_type(comp), flags)) {
+        free(stored_name);
+        rift_regex_destroy(comp);
+        return false;
+    }
+    
+    /* Store in the context */
+    ctx->composition_names[ctx->composition_count] = stored_name;
+    ctx->compositions[ctx->composition_count] = comp;
+    ctx->composition_count++;
     
     /* Update context statistics */
-    ctx->stats.regex_patterns = pattern_cache.count;
+    ctx->stats.regex_patterns = ctx->composition_count;
     
     return true;
 }
@@ -333,10 +425,10 @@ bool rift_tokenizer_cache_pattern(TokenizerContext* ctx, const char* name,
 RegexComposition* rift_tokenizer_get_cached_pattern(TokenizerContext* ctx, const char* name) {
     if (!ctx || !name) return NULL;
     
-    for (size_t i = 0; i < pattern_cache.count; i++) {
-        if (pattern_cache.pattern_names[i] && 
-            strcmp(pattern_cache.pattern_names[i], name) == 0) {
-            return pattern_cache.patterns[i];
+    for (size_t i = 0; i < ctx->composition_count; i++) {
+        if (ctx->composition_names[i] && 
+            strcmp(ctx->composition_names[i], name) == 0) {
+            return ctx->compositions[i];
         }
     }
     
@@ -0,0 +1,577 @@
+/*
+ * =================================================================
+ * union_dfa.c - RIFT-0 Incremental Union DFA
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Runtime literal patterns combined into one minimal DFA
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(rift_union_dfa_add, rift_union_dfa_compact)
+ * R.FLAGS(incremental, local_minimize, batched_compaction)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/union_dfa.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define UNION_DFA_INITIAL_CAPACITY  64
+#define UNION_DFA_REGISTER_EMPTY    0u              /* Ids >= 2 are registered */
+#define UNION_DFA_REGISTER_TOMB     UINT32_MAX
+
+typedef enum {
+    STATE_FREE = 0,
+    STATE_LIVE,
+    STATE_REGISTERED                /* Live and in the equivalence register */
+} StateStatus;
+
+/* =================================================================
+ * INTERNAL STRUCTURES
+ * =================================================================
+ */
+
+struct RiftUnionDfa {
+    uint16_t* transitions;          /* capacity * 256 */
+    uint8_t* accept;
+    uint32_t* in_degree;            /* Incoming transitions, with multiplicity */
+    uint8_t* status;                /* StateStatus */
+    uint32_t capacity;
+    uint32_t used;                  /* Rows handed out, holes included */
+
+    uint32_t* free_slots;
+    uint32_t free_count;
+
+    /* Open-addressed register of minimized states keyed by row */
+    uint32_t* reg;
+    uint32_t reg_capacity;
+    uint32_t reg_used;              /* Entries plus tombstones */
+
+    RiftDfaTable table;
+    RiftUnionDfaStats stats;
+};
+
+/* States at one depth of an addition; olds[i] is cloned into news[i] */
+typedef struct {
+    uint32_t* olds;
+    uint32_t* news;
+    size_t* level_start;            /* length + 2 entries */
+    size_t count;
+    size_t capacity;
+} AddPlan;
+
+static inline uint16_t* state_row(const RiftUnionDfa* dfa, uint32_t state) {
+    return &dfa->transitions[(size_t)state * 256];
+}
+
+static void refresh_table(RiftUnionDfa* dfa) {
+    dfa->table.state_count = dfa->used;
+    dfa->table.transitions = dfa->transitions;
+    dfa->table.accept = dfa->accept;
+    dfa->stats.table_states = dfa->used;
+}
+
+static bool grow_states(RiftUnionDfa* dfa, uint32_t needed) {
+    if (needed <= dfa->capacity) {
+        return true;
+    }
+
+    uint32_t new_capacity = dfa->capacity ? dfa->capacity : UNION_DFA_INITIAL_CAPACITY;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    if (new_capacity > RIFT_UNION_DFA_MAX_STATES) {
+        new_capacity = RIFT_UNION_DFA_MAX_STATES;
+    }
+
+    uint16_t* transitions = realloc(dfa->transitions, (size_t)new_capacity * 256 * sizeof(uint16_t));
+    if (!transitions) return false;
+    dfa->transitions = transitions;
+
+    uint8_t* accept = realloc(dfa->accept, new_capacity);
+    if (!accept) return false;
+    dfa->accept = accept;
+
+    uint32_t* in_degree = realloc(dfa->in_degree, new_capacity * sizeof(uint32_t));
+    if (!in_degree) return false;
+    dfa->in_degree = in_degree;
+
+    uint8_t* status = realloc(dfa->status, new_capacity);
+    if (!status) return false;
+    dfa->status = status;
+
+    uint32_t* free_slots = realloc(dfa->free_slots, new_capacity * sizeof(uint32_t));
+    if (!free_slots) return false;
+    dfa->free_slots = free_slots;
+
+    size_t added = new_capacity - dfa->capacity;
+    memset(state_row(dfa, dfa->capacity), 0, added * 256 * sizeof(uint16_t));
+    memset(dfa->accept + dfa->capacity, 0, added);
+    memset(dfa->in_degree + dfa->capacity, 0, added * sizeof(uint32_t));
+    memset(dfa->status + dfa->capacity, STATE_FREE, added);
+    dfa->capacity = new_capacity;
+    refresh_table(dfa);
+    return true;
+}
+
+/* Capacity is reserved by the caller, so this cannot fail */
+static uint32_t alloc_state(RiftUnionDfa* dfa) {
+    uint32_t state = dfa->free_count > 0 ? dfa->free_slots[--dfa->free_count]
+                                         : dfa->used++;
+    memset(state_row(dfa, state), 0, 256 * sizeof(uint16_t));
+    dfa->accept[state] = TOKEN_UNKNOWN;
+    dfa->in_degree[state] = 0;
+    dfa->status[state] = STATE_LIVE;
+    dfa->stats.live_states++;
+    return state;
+}
+
+/* =================================================================
+ * EQUIVALENCE REGISTER
+ * Two states of an acyclic DFA are equivalent when they accept the
+ * same type and every transition goes to the same (already minimal)
+ * state, so a row compare is a complete equivalence test.
+ * =================================================================
+ */
+
+static uint64_t hash_state(const RiftUnionDfa* dfa, uint32_t state) {
+    const uint16_t* row = state_row(dfa, state);
+    uint64_t hash = 0xcbf29ce484222325ULL ^ dfa->accept[state];
+    for (int c = 0; c < 256; c++) {
+        if (row[c] != 0) {
+            hash = (hash ^ ((uint64_t)c << 16 | row[c])) * 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+static bool states_equal(const RiftUnionDfa* dfa, uint32_t a, uint32_t b) {
+    return dfa->accept[a] == dfa->accept[b] &&
+           memcmp(state_row(dfa, a), state_row(dfa, b), 256 * sizeof(uint16_t)) == 0;
+}
+
+static uint32_t register_find(const RiftUnionDfa* dfa, uint32_t state) {
+    if (dfa->reg_capacity == 0) return 0;
+
+    uint32_t mask = dfa->reg_capacity - 1;
+    for (uint32_t i = (uint32_t)hash_state(dfa, state) & mask;; i = (i + 1) & mask) {
+        uint32_t entry = dfa->reg[i];
+        if (entry == UNION_DFA_REGISTER_EMPTY) return 0;
+        if (entry != UNION_DFA_REGISTER_TOMB && entry != state && states_equal(dfa, entry, state)) {
+            return entry;
+        }
+    }
+}
+
+static void register_place(RiftUnionDfa* dfa, uint32_t state) {
+    uint32_t mask = dfa->reg_capacity - 1;
+    uint32_t i = (uint32_t)hash_state(dfa, state) & mask;
+    while (dfa->reg[i] != UNION_DFA_REGISTER_EMPTY && dfa->reg[i] != UNION_DFA_REGISTER_TOMB) {
+        i = (i + 1) & mask;
+    }
+    if (dfa->reg[i] == UNION_DFA_REGISTER_EMPTY) {
+        dfa->reg_used++;
+    }
+    dfa->reg[i] = state;
+    dfa->status[state] = STATE_REGISTERED;
+}
+
+/* Rebuild the register from the status table at a capacity for `live` states */
+static bool register_rebuild(RiftUnionDfa* dfa, uint32_t live) {
+    uint32_t capacity = 64;
+    while (capacity < live * 2) {
+        capacity *= 2;
+    }
+
+    uint32_t* reg = calloc(capacity, sizeof(uint32_t));
+    if (!reg) return false;
+
+    free(dfa->reg);
+    dfa->reg = reg;
+    dfa->reg_capacity = capacity;
+    dfa->reg_used = 0;
+    for (uint32_t s = 2; s < dfa->used; s++) {
+        if (dfa->status[s] == STATE_REGISTERED) {
+            register_place(dfa, s);
+        }
+    }
+    return true;
+}
+
+static void register_remove(RiftUnionDfa* dfa, uint32_t state) {
+    uint32_t mask = dfa->reg_capacity - 1;
+    for (uint32_t i = (uint32_t)hash_state(dfa, state) & mask;; i = (i + 1) & mask) {
+        if (dfa->reg[i] == state) {
+            dfa->reg[i] = UNION_DFA_REGISTER_TOMB;
+            dfa->status[state] = STATE_LIVE;
+            return;
+        }
+    }
+}
+
+/* =================================================================
+ * REACHABILITY
+ * =================================================================
+ */
+
+/* Free state and everything only it reached; stack holds >= capacity ids */
+static void release_unreachable(RiftUnionDfa* dfa, uint32_t state, uint32_t* stack) {
+    size_t top = 0;
+    stack[top++] = state;
+
+    while (top > 0) {
+        uint32_t s = stack[--top];
+        if (s <= RIFT_DFA_START_STATE || dfa->status[s] == STATE_FREE || dfa->in_degree[s] != 0) {
+            continue;
+        }
+
+        if (dfa->status[s] == STATE_REGISTERED) {
+            register_remove(dfa, s);
+        }
+        uint16_t* row = state_row(dfa, s);
+        for (int c = 0; c < 256; c++) {
+            uint32_t t = row[c];
+            if (t != RIFT_DFA_DEAD_STATE && --dfa->in_degree[t] == 0) {
+                stack[top++] = t;
+            }
+        }
+        memset(row, 0, 256 * sizeof(uint16_t));
+        dfa->accept[s] = TOKEN_UNKNOWN;
+        dfa->status[s] = STATE_FREE;
+        dfa->free_slots[dfa->free_count++] = s;
+        dfa->stats.live_states--;
+        dfa->stats.states_released++;
+    }
+}
+
+static int byte_variants(unsigned char c, bool ignore_case, unsigned char out[2]) {
+    out[0] = c;
+    if (ignore_case && ((c | 0x20) >= 'a' && (c | 0x20) <= 'z')) {
+        out[1] = (unsigned char)(c ^ 0x20);
+        return 2;
+    }
+    return 1;
+}
+
+/* =================================================================
+ * ADDITION
+ * =================================================================
+ */
+
+static bool plan_push(AddPlan* plan, uint32_t old_state) {
+    if (plan->count == plan->capacity) {
+        size_t new_capacity = plan->capacity ? plan->capacity * 2 : 32;
+        uint32_t* olds = realloc(plan->olds, new_capacity * sizeof(uint32_t));
+        if (!olds) return false;
+        plan->olds = olds;
+        plan->capacity = new_capacity;
+    }
+    plan->olds[plan->count++] = old_state;
+    return true;
+}
+
+static size_t plan_find(const AddPlan* plan, size_t level, uint32_t old_state) {
+    for (size_t i = plan->level_start[level]; i < plan->level_start[level + 1]; i++) {
+        if (plan->olds[i] == old_state) return i;
+    }
+    return SIZE_MAX;
+}
+
+/*
+ * Dry run: the distinct existing states (dead included) each prefix of
+ * the literal reaches. Level k+1 is cloned once per entry, so the plan
+ * size is exactly the number of states the addition creates.
+ */
+static bool plan_addition(const RiftUnionDfa* dfa, const unsigned char* literal, size_t length,
+                          bool ignore_case, AddPlan* plan) {
+    plan->level_start = malloc((length + 2) * sizeof(size_t));
+    if (!plan->level_start || !plan_push(plan, RIFT_DFA_START_STATE)) {
+        return false;
+    }
+    plan->level_start[0] = 0;
+    plan->level_start[1] = 1;
+
+    for (size_t k = 0; k < length; k++) {
+        unsigned char variants[2];
+        int variant_count = byte_variants(literal[k], ignore_case, variants);
+        plan->level_start[k + 2] = plan->level_start[k + 1];
+
+        for (size_t i = plan->level_start[k]; i < plan->level_start[k + 1]; i++) {
+            for (int v = 0; v < variant_count; v++) {
+                uint32_t from = plan->olds[i];
+                uint32_t next = from == RIFT_DFA_DEAD_STATE ? RIFT_DFA_DEAD_STATE
+                                                            : state_row(dfa, from)[variants[v]];
+                if (plan_find(plan, k + 1, next) != SIZE_MAX) continue;
+                if (!plan_push(plan, next)) return false;
+                plan->level_start[k + 2]++;
+            }
+        }
+    }
+
+    plan->news = malloc(plan->count * sizeof(uint32_t));
+    return plan->news != NULL;
+}
+
+/* State standing for plan entry i once cloned (the start is edited in place) */
+static inline uint32_t plan_state(const AddPlan* plan, size_t i) {
+    return i == 0 ? RIFT_DFA_START_STATE : plan->news[i];
+}
+
+/* Point parents at `level` from `from` to `to` on the literal's bytes */
+static void redirect_parents(RiftUnionDfa* dfa, const AddPlan* plan, size_t level,
+                             const unsigned char* variants, int variant_count,
+                             uint32_t from, uint32_t to) {
+    for (size_t i = plan->level_start[level]; i < plan->level_start[level + 1]; i++) {
+        uint16_t* row = state_row(dfa, plan_state(plan, i));
+        for (int v = 0; v < variant_count; v++) {
+            if (row[variants[v]] == from) {
+                row[variants[v]] = (uint16_t)to;
+                dfa->in_degree[to]++;
+                dfa->in_degree[from]--;
+            }
+        }
+    }
+}
+
+/**
+ * Add a literal pattern incrementally
+ * R.ADD(RiftUnionDfa, literal, TokenType, flags) -> bool
+ */
+bool rift_union_dfa_add(RiftUnionDfa* dfa, const char* literal, size_t length,
+                        TokenType type, TokenFlags flags) {
+    if (!dfa || !literal || length == 0 || type == TOKEN_UNKNOWN || type > 0xFF) {
+        return false;
+    }
+
+    const unsigned char* bytes = (const unsigned char*)literal;
+    bool ignore_case = (flags & TOKEN_FLAG_IGNORECASE) != 0;
+
+    AddPlan plan = {0};
+    bool ok = plan_addition(dfa, bytes, length, ignore_case, &plan);
+
+    /* Reserve rows, register slots and scratch up front so nothing below fails */
+    size_t created = ok ? plan.count - 1 : 0;
+    size_t reused = created < dfa->free_count ? created : dfa->free_count;
+    size_t rows = (size_t)dfa->used + created - reused;
+    ok = ok && rows <= RIFT_UNION_DFA_MAX_STATES && grow_states(dfa, (uint32_t)rows);
+    if (ok && (dfa->reg_used + created + 1) * 4 > (size_t)dfa->reg_capacity * 3) {
+        ok = register_rebuild(dfa, dfa->stats.live_states + (uint32_t)created);
+    }
+    uint32_t* orphans = ok ? malloc(dfa->capacity * sizeof(uint32_t)) : NULL;
+    uint32_t* work = ok ? malloc(dfa->capacity * sizeof(uint32_t)) : NULL;
+    if (!orphans || !work) {
+        free(orphans);
+        free(work);
+        free(plan.olds);
+        free(plan.news);
+        free(plan.level_start);
+        return false;
+    }
+
+    /* Clone every state on the new path, copying its outgoing edges */
+    for (size_t k = 1; k <= length; k++) {
+        for (size_t i = plan.level_start[k]; i < plan.level_start[k + 1]; i++) {
+            uint32_t from = plan.olds[i];
+            uint32_t clone = alloc_state(dfa);
+            if (from != RIFT_DFA_DEAD_STATE) {
+                memcpy(state_row(dfa, clone), state_row(dfa, from), 256 * sizeof(uint16_t));
+                for (int c = 0; c < 256; c++) {
+                    uint32_t t = state_row(dfa, clone)[c];
+                    if (t != RIFT_DFA_DEAD_STATE) dfa->in_degree[t]++;
+                }
+                dfa->accept[clone] = dfa->accept[from];
+            }
+            /* Earlier patterns keep priority on equal length */
+            if (k == length && dfa->accept[clone] == TOKEN_UNKNOWN) {
+                dfa->accept[clone] = (uint8_t)type;
+            }
+            plan.news[i] = clone;
+            dfa->stats.states_cloned++;
+        }
+    }
+
+    /* Wire parents to clones; originals no longer referenced are released below */
+    size_t orphan_count = 0;
+    for (size_t k = 0; k < length; k++) {
+        unsigned char variants[2];
+        int variant_count = byte_variants(bytes[k], ignore_case, variants);
+        for (size_t i = plan.level_start[k]; i < plan.level_start[k + 1]; i++) {
+            uint16_t* row = state_row(dfa, plan_state(&plan, i));
+            for (int v = 0; v < variant_count; v++) {
+                /* Originals are never edited, so they still give the plan key */
+                uint32_t from = plan.olds[i];
+                uint32_t key = from == RIFT_DFA_DEAD_STATE ? RIFT_DFA_DEAD_STATE
+                                                           : state_row(dfa, from)[variants[v]];
+                uint32_t previous = row[variants[v]];
+                uint32_t clone = plan.news[plan_find(&plan, k + 1, key)];
+                row[variants[v]] = (uint16_t)clone;
+                dfa->in_degree[clone]++;
+                if (previous != RIFT_DFA_DEAD_STATE && --dfa->in_degree[previous] == 0) {
+                    orphans[orphan_count++] = previous;
+                }
+            }
+        }
+    }
+
+    /* Re-minimize bottom up: fold each clone into an equivalent state */
+    for (size_t k = length; k >= 1; k--) {
+        unsigned char variants[2];
+        int variant_count = byte_variants(bytes[k - 1], ignore_case, variants);
+        for (size_t i = plan.level_start[k]; i < plan.level_start[k + 1]; i++) {
+            uint32_t clone = plan.news[i];
+            uint32_t twin = register_find(dfa, clone);
+            if (twin == 0) {
+                register_place(dfa, clone);
+                continue;
+            }
+            redirect_parents(dfa, &plan, k - 1, variants, variant_count, clone, twin);
+            dfa->stats.states_merged++;
+            release_unreachable(dfa, clone, work);
+        }
+    }
+
+    /* Originals left without parents (the clones took over their edges) */
+    for (size_t i = 0; i < orphan_count; i++) {
+        release_unreachable(dfa, orphans[i], work);
+    }
+
+    free(work);
+    free(orphans);
+    free(plan.olds);
+    free(plan.news);
+    free(plan.level_start);
+
+    dfa->stats.pattern_count++;
+    refresh_table(dfa);
+
+    if (dfa->used >= RIFT_UNION_DFA_COMPACT_MIN &&
+        dfa->free_count * RIFT_UNION_DFA_COMPACT_RATIO >= dfa->used) {
+        rift_union_dfa_compact(dfa);
+    }
+    return true;
+}
+
+/* =================================================================
+ * LIFECYCLE & COMPACTION
+ * =================================================================
+ */
+
+RiftUnionDfa* rift_union_dfa_create(void) {
+    RiftUnionDfa* dfa = calloc(1, sizeof(RiftUnionDfa));
+    if (!dfa) {
+        return NULL;
+    }
+
+    if (!grow_states(dfa, UNION_DFA_INITIAL_CAPACITY) || !register_rebuild(dfa, 0)) {
+        rift_union_dfa_destroy(dfa);
+        return NULL;
+    }
+
+    dfa->used = RIFT_DFA_START_STATE + 1;
+    dfa->status[RIFT_DFA_DEAD_STATE] = STATE_LIVE;
+    dfa->status[RIFT_DFA_START_STATE] = STATE_LIVE;
+    dfa->stats.live_states = 2;
+    refresh_table(dfa);
+    return dfa;
+}
+
+void rift_union_dfa_destroy(RiftUnionDfa* dfa) {
+    if (!dfa) return;
+
+    free(dfa->transitions);
+    free(dfa->accept);
+    free(dfa->in_degree);
+    free(dfa->status);
+    free(dfa->free_slots);
+    free(dfa->reg);
+    free(dfa);
+}
+
+/**
+ * Renumber live states breadth-first into a dense table
+ * R.COMPACT(RiftUnionDfa) -> bool
+ */
+bool rift_union_dfa_compact(RiftUnionDfa* dfa) {
+    if (!dfa) return false;
+
+    uint32_t live = dfa->stats.live_states;
+    uint32_t* remap = calloc(dfa->used, sizeof(uint32_t));
+    uint32_t* order = malloc(live * sizeof(uint32_t));
+    uint16_t* transitions = calloc((size_t)dfa->capacity * 256, sizeof(uint16_t));
+    uint8_t* accept = calloc(dfa->capacity, 1);
+    if (!remap || !order || !transitions || !accept) {
+        free(remap);
+        free(order);
+        free(transitions);
+        free(accept);
+        return false;
+    }
+
+    /* Breadth-first from the start: hot short prefixes share rows */
+    uint32_t next_id = RIFT_DFA_START_STATE + 1;
+    size_t head = 0, tail = 0;
+    remap[RIFT_DFA_START_STATE] = RIFT_DFA_START_STATE;
+    order[tail++] = RIFT_DFA_START_STATE;
+    while (head < tail) {
+        const uint16_t* row = state_row(dfa, order[head++]);
+        for (int c = 0; c < 256; c++) {
+            uint32_t t = row[c];
+            if (t != RIFT_DFA_DEAD_STATE && remap[t] == 0) {
+                remap[t] = next_id++;
+                order[tail++] = t;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < tail; i++) {
+        uint32_t s = order[i];
+        const uint16_t* row = state_row(dfa, s);
+        uint16_t* out = &transitions[(size_t)remap[s] * 256];
+        for (int c = 0; c < 256; c++) {
+            out[c] = (uint16_t)remap[row[c]];
+        }
+        accept[remap[s]] = dfa->accept[s];
+    }
+
+    free(dfa->transitions);
+    free(dfa->accept);
+    dfa->transitions = transitions;
+    dfa->accept = accept;
+    dfa->used = next_id;
+    dfa->free_count = 0;
+
+    memset(dfa->in_degree, 0, dfa->capacity * sizeof(uint32_t));
+    memset(dfa->status, STATE_FREE, dfa->capacity);
+    dfa->status[RIFT_DFA_DEAD_STATE] = STATE_LIVE;
+    dfa->status[RIFT_DFA_START_STATE] = STATE_LIVE;
+    for (uint32_t s = RIFT_DFA_START_STATE; s < dfa->used; s++) {
+        const uint16_t* row = state_row(dfa, s);
+        for (int c = 0; c < 256; c++) {
+            if (row[c] != RIFT_DFA_DEAD_STATE) dfa->in_degree[row[c]]++;
+        }
+        if (s > RIFT_DFA_START_STATE) dfa->status[s] = STATE_REGISTERED;
+    }
+
+    free(remap);
+    free(order);
+    dfa->stats.live_states = dfa->used;
+    dfa->stats.compactions++;
+    refresh_table(dfa);
+    return register_rebuild(dfa, dfa->used);
+}
+
+/**
+ * Current tables for the static-table matchers
+ * R.TABLE(RiftUnionDfa) -> RiftDfaTable
+ */
+const RiftDfaTable* rift_union_dfa_table(const RiftUnionDfa* dfa) {
+    return dfa ? &dfa->table : NULL;
+}
+
+RiftUnionDfaStats rift_union_dfa_get_stats(const RiftUnionDfa* dfa) {
+    RiftUnionDfaStats stats = {0};
+    if (dfa) {
+        stats = dfa->stats;
+    }
+    return stats;
+}
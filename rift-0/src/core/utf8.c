@@ -0,0 +1,291 @@
+/*
+ * =================================================================
+ * utf8.c - RIFT-0 UTF-8 Validation
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: ASCII fast path, SIMD lookup validator, scalar decoder
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.IMPLEMENT(rift_utf8_validate)
+ * R.FLAGS(ascii_fast_path, simd_lookup, scalar_fallback)
+ *
+ * Author: Nnamdi Michael Okpala & AEGIS Integration Team
+ * =================================================================
+ */
+
+#include "rift-0/core/utf8.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define UTF8_ASCII_MASK64   0x8080808080808080ULL
+
+/* =================================================================
+ * SCALAR DECODER
+ * =================================================================
+ */
+
+/* Length of the well-formed sequence at p, or 0 (Unicode Table 3-7) */
+static size_t utf8_sequence_length(const unsigned char* p, size_t available) {
+    unsigned char lead = p[0];
+    unsigned char low = 0x80, high = 0xBF;
+    size_t length;
+
+    if (lead < 0x80) {
+        return 1;
+    } else if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        if (lead == 0xE0) low = 0xA0;           /* Overlong */
+        if (lead == 0xED) high = 0x9F;          /* Surrogates */
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        if (lead == 0xF0) low = 0x90;           /* Overlong */
+        if (lead == 0xF4) high = 0x8F;          /* Above U+10FFFF */
+    } else {
+        return 0;
+    }
+
+    if (available < length || p[1] < low || p[1] > high) {
+        return 0;
+    }
+    for (size_t i = 2; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) return 0;
+    }
+    return length;
+}
+
+/*
+ * Validate every sequence starting before stop. *pos advances past the
+ * last one (possibly beyond stop), or is left on the bad sequence.
+ */
+static bool utf8_validate_scalar(const unsigned char* data, size_t length,
+                                 size_t* pos, size_t stop) {
+    size_t i = *pos;
+
+    while (i < stop) {
+        /* Eight ASCII bytes at a time */
+        if (i + 8 <= length) {
+            uint64_t word;
+            memcpy(&word, data + i, sizeof(word));
+            if ((word & UTF8_ASCII_MASK64) == 0) {
+                i += 8;
+                continue;
+            }
+        }
+
+        size_t n = utf8_sequence_length(data + i, length - i);
+        if (n == 0) {
+            *pos = i;
+            return false;
+        }
+        i += n;
+    }
+
+    *pos = i;
+    return true;
+}
+
+/* =================================================================
+ * SSSE3 LOOKUP VALIDATOR
+ * Each byte pair (previous, current) is classified through three
+ * 16-entry nibble tables; a set bit common to all three lookups is an
+ * error. Bytes that must be the 2nd/3rd continuation of a 3- or 4-byte
+ * sequence are checked separately from the lead two bytes back.
+ * =================================================================
+ */
+
+#if defined(__SSSE3__)
+
+#define UTF8_TOO_SHORT      (1 << 0)    /* Lead byte without continuation */
+#define UTF8_TOO_LONG       (1 << 1)    /* ASCII followed by continuation */
+#define UTF8_OVERLONG_3     (1 << 2)
+#define UTF8_TOO_LARGE      (1 << 3)
+#define UTF8_SURROGATE      (1 << 4)
+#define UTF8_OVERLONG_2     (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4     (1 << 6)
+#define UTF8_TWO_CONTS      (1 << 7)    /* Continuation after continuation */
+#define UTF8_CARRY          (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+typedef struct {
+    __m128i error;
+    __m128i prev_input;
+    __m128i prev_incomplete;
+} Utf8LookupState;
+
+static inline __m128i utf8_high_nibbles(__m128i v) {
+    return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+}
+
+static inline __m128i utf8_special_cases(__m128i input, __m128i prev1) {
+    const __m128i byte_1_high_table = _mm_setr_epi8(
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        (char)UTF8_TWO_CONTS, (char)UTF8_TWO_CONTS, (char)UTF8_TWO_CONTS, (char)UTF8_TWO_CONTS,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4);
+
+    const __m128i byte_1_low_table = _mm_setr_epi8(
+        (char)(UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4),
+        (char)(UTF8_CARRY | UTF8_OVERLONG_2),
+        (char)UTF8_CARRY,
+        (char)UTF8_CARRY,
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+        (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000));
+
+    const __m128i byte_2_high_table = _mm_setr_epi8(
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+               UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4),
+        (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+               UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+        (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+               UTF8_SURROGATE | UTF8_TOO_LARGE),
+        (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+               UTF8_SURROGATE | UTF8_TOO_LARGE),
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+
+    __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, utf8_high_nibbles(prev1));
+    __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table,
+                                          _mm_and_si128(prev1, _mm_set1_epi8(0x0F)));
+    __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, utf8_high_nibbles(input));
+    return _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+}
+
+static inline void utf8_lookup_block(Utf8LookupState* state, __m128i input) {
+    if (_mm_movemask_epi8(input) == 0) {
+        /* ASCII block: only a sequence cut off by the last block can fail */
+        state->error = _mm_or_si128(state->error, state->prev_incomplete);
+    } else {
+        __m128i prev1 = _mm_alignr_epi8(input, state->prev_input, 15);
+        __m128i prev2 = _mm_alignr_epi8(input, state->prev_input, 14);
+        __m128i prev3 = _mm_alignr_epi8(input, state->prev_input, 13);
+        __m128i special = utf8_special_cases(input, prev1);
+
+        /* Only 111xxxxx two back / 1111xxxx three back leave the high bit set */
+        __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+        __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+        __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+        state->error = _mm_or_si128(state->error, _mm_xor_si128(must23, special));
+    }
+
+    /* Lead bytes in the last three positions still need continuations */
+    const __m128i max_complete = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    state->prev_incomplete = _mm_subs_epu8(input, max_complete);
+    state->prev_input = input;
+}
+
+static inline bool utf8_lookup_failed(const Utf8LookupState* state) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(state->error, _mm_setzero_si128())) != 0xFFFF;
+}
+
+static bool utf8_validate_lookup(const unsigned char* data, size_t length) {
+    Utf8LookupState state;
+    state.error = _mm_setzero_si128();
+    state.prev_input = _mm_setzero_si128();
+    state.prev_incomplete = _mm_setzero_si128();
+
+    size_t pos = 0;
+    for (; pos + 64 <= length; pos += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(data + pos));
+        __m128i b = _mm_loadu_si128((const __m128i*)(data + pos + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(data + pos + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*)(data + pos + 48));
+
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) == 0) {
+            state.error = _mm_or_si128(state.error, state.prev_incomplete);
+            state.prev_incomplete = _mm_setzero_si128();
+            state.prev_input = d;
+            continue;
+        }
+
+        utf8_lookup_block(&state, a);
+        utf8_lookup_block(&state, b);
+        utf8_lookup_block(&state, c);
+        utf8_lookup_block(&state, d);
+        if (utf8_lookup_failed(&state)) {
+            return false;
+        }
+    }
+
+    /* Zero padding is ASCII, so it also flushes a truncated final sequence */
+    unsigned char tail[64];
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, data + pos, length - pos);
+    for (size_t i = 0; i < sizeof(tail); i += 16) {
+        utf8_lookup_block(&state, _mm_loadu_si128((const __m128i*)(tail + i)));
+    }
+    state.error = _mm_or_si128(state.error, state.prev_incomplete);
+
+    return !utf8_lookup_failed(&state);
+}
+
+#endif /* __SSSE3__ */
+
+/* =================================================================
+ * PUBLIC ENTRY POINT
+ * =================================================================
+ */
+
+/**
+ * Validate a buffer as UTF-8
+ * R.VALIDATE(data, length) -> true when well formed
+ */
+bool rift_utf8_validate(const char* data, size_t length, size_t* error_offset) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t pos = 0;
+
+    if (!data) {
+        if (error_offset) *error_offset = 0;
+        return length == 0;
+    }
+
+#if defined(__SSSE3__)
+    if (utf8_validate_lookup(bytes, length)) {
+        return true;
+    }
+    /* Rare path: rescan to report where it went wrong */
+#elif defined(__SSE2__)
+    while (pos + 64 <= length) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(bytes + pos));
+        __m128i b = _mm_loadu_si128((const __m128i*)(bytes + pos + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(bytes + pos + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*)(bytes + pos + 48));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) == 0) {
+            pos += 64;
+            continue;
+        }
+        if (!utf8_validate_scalar(bytes, length, &pos, pos + 64)) {
+            if (error_offset) *error_offset = pos;
+            return false;
+        }
+    }
+#endif
+
+    if (!utf8_validate_scalar(bytes, length, &pos, length)) {
+        if (error_offset) *error_offset = pos;
+        return false;
+    }
+    return true;
+}
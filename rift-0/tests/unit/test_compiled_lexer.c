@@ -0,0 +1,243 @@
+/**
+ * =================================================================
+ * test_compiled_lexer.c - RIFT-0 Shared Compiled Lexer Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: CompiledLexer sharing and per-thread cursor validation
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+#define SCAN_THREADS 4
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static const char* g_source =
+    "let total = count + 42; // running sum\n"
+    "if (total >= limit) { emit(\"done\"); }\n";
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/**
+ * Test: default lexer produces longest-match tokens with spans
+ */
+static bool test_default_lexer_scan(void) {
+    LexerCursor cursor;
+    TEST_ASSERT(rift_cursor_init(&cursor, rift_lexer_default(), 4),
+                "Cursor initializes over default lexer");
+
+    rift_cursor_set_input(&cursor, "x1 >= 42", 8);
+    TEST_ASSERT(rift_cursor_scan(&cursor), "Scan succeeds");
+
+    /* x1, ' ', >=, ' ', 42, EOF */
+    TEST_ASSERT(cursor.token_count == 6, "Six tokens including EOF");
+    TEST_ASSERT(cursor.tokens[0].type == TOKEN_IDENTIFIER, "Identifier first");
+    TEST_ASSERT(cursor.spans[0].length == 2, "Identifier spans two bytes");
+    TEST_ASSERT(cursor.tokens[2].type == TOKEN_OPERATOR, "Operator third");
+    TEST_ASSERT(cursor.spans[2].length == 2, "Compound operator matched whole");
+    TEST_ASSERT(cursor.tokens[4].type == TOKEN_LITERAL_NUMBER, "Number fifth");
+    TEST_ASSERT(cursor.tokens[5].type == TOKEN_EOF, "EOF terminates stream");
+
+    rift_cursor_destroy(&cursor);
+    TEST_PASS("Default lexer scan");
+}
+
+/**
+ * Test: rule specs override default rules on equal-length matches
+ */
+static bool test_rule_spec_override(void) {
+    const LexerRuleSpec rules[] = {
+        { "let", "let", TOKEN_KEYWORD, TOKEN_FLAG_NONE },
+        { "if",  "IF",  TOKEN_KEYWORD, TOKEN_FLAG_IGNORECASE },
+    };
+
+    const CompiledLexer* lexer = rift_lexer_compile(rules, 2);
+    TEST_ASSERT(lexer != NULL, "Rule specs compile");
+    TEST_ASSERT(rift_lexer_rule_count(lexer) == 2, "Both rules retained");
+
+    const unsigned char* input = (const unsigned char*)"letter if";
+    TokenType type = TOKEN_UNKNOWN;
+
+    size_t length = rift_lexer_match(lexer, input, input + 9, &type);
+    TEST_ASSERT(length == 6 && type == TOKEN_IDENTIFIER,
+                "Longer identifier beats keyword prefix");
+
+    length = rift_lexer_match(lexer, input + 7, input + 9, &type);
+    TEST_ASSERT(length == 2 && type == TOKEN_KEYWORD,
+                "Case-insensitive keyword wins tie");
+
+    rift_lexer_release(lexer);
+    TEST_PASS("Rule spec override");
+}
+
+/**
+ * Test: each rule keeps its own case mode in a mixed-flag rule set
+ */
+static bool test_mixed_flag_rules(void) {
+    const LexerRuleSpec rules[] = {
+        { "select", "Select", TOKEN_KEYWORD,  TOKEN_FLAG_IGNORECASE | TOKEN_FLAG_GLOBAL },
+        { "from",   "FROM",   TOKEN_KEYWORD,  TOKEN_FLAG_NONE },
+        { "x1",     "x_1",    TOKEN_KEYWORD,  TOKEN_FLAG_IGNORECASE },
+        { "index",  "[[",     TOKEN_OPERATOR, TOKEN_FLAG_IGNORECASE },
+    };
+
+    const CompiledLexer* lexer = rift_lexer_compile(rules, 4);
+    TEST_ASSERT(lexer != NULL, "Mixed-flag rules compile");
+
+    static const struct {
+        const char* input;
+        TokenType type;
+    } cases[] = {
+        { "sElEcT", TOKEN_KEYWORD },
+        { "FROM",   TOKEN_KEYWORD },
+        { "from",   TOKEN_IDENTIFIER },
+        { "X_1",    TOKEN_KEYWORD },
+        { "[[",     TOKEN_OPERATOR },
+        { "{{",     TOKEN_PUNCTUATION },
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const unsigned char* input = (const unsigned char*)cases[i].input;
+        TokenType type = TOKEN_UNKNOWN;
+        rift_lexer_match(lexer, input, input + strlen(cases[i].input), &type);
+        TEST_ASSERT(type == cases[i].type, "Per-rule case mode");
+    }
+
+    rift_lexer_release(lexer);
+    TEST_PASS("Mixed flag rules");
+}
+
+typedef struct {
+    const CompiledLexer* lexer;
+    size_t token_count;
+    TokenType types[64];
+    bool ok;
+} ScanJob;
+
+static void* scan_worker(void* arg) {
+    ScanJob* job = arg;
+    LexerCursor cursor;
+
+    job->ok = rift_cursor_init(&cursor, job->lexer, 0);
+    if (!job->ok) return NULL;
+
+    for (int round = 0; round < 1000 && job->ok; round++) {
+        rift_cursor_set_input(&cursor, g_source, strlen(g_source));
+        job->ok = rift_cursor_scan(&cursor);
+    }
+
+    job->token_count = cursor.token_count;
+    for (size_t i = 0; i < cursor.token_count && i < 64; i++) {
+        job->types[i] = (TokenType)cursor.tokens[i].type;
+    }
+
+    rift_cursor_destroy(&cursor);
+    return NULL;
+}
+
+/**
+ * Test: one lexer shared by several threads yields identical streams
+ */
+static bool test_shared_lexer_threads(void) {
+    const LexerRuleSpec rules[] = {
+        { "let", "let", TOKEN_KEYWORD, TOKEN_FLAG_NONE },
+    };
+    const CompiledLexer* lexer = rift_lexer_compile(rules, 1);
+    TEST_ASSERT(lexer != NULL, "Shared lexer compiles");
+
+    pthread_t threads[SCAN_THREADS];
+    ScanJob jobs[SCAN_THREADS];
+    memset(jobs, 0, sizeof(jobs));
+
+    for (int i = 0; i < SCAN_THREADS; i++) {
+        jobs[i].lexer = lexer;
+        TEST_ASSERT(pthread_create(&threads[i], NULL, scan_worker, &jobs[i]) == 0,
+                    "Worker thread starts");
+    }
+    for (int i = 0; i < SCAN_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    /* Workers released their references; ours is the last one */
+    for (int i = 0; i < SCAN_THREADS; i++) {
+        TEST_ASSERT(jobs[i].ok, "Worker scan succeeded");
+        TEST_ASSERT(jobs[i].token_count == jobs[0].token_count, "Token counts agree");
+        TEST_ASSERT(memcmp(jobs[i].types, jobs[0].types, sizeof(jobs[0].types)) == 0,
+                    "Token streams agree");
+    }
+    TEST_ASSERT(jobs[0].types[0] == TOKEN_KEYWORD, "Keyword rule applied in workers");
+
+    rift_lexer_release(lexer);
+    TEST_PASS("Shared lexer across threads");
+}
+
+/**
+ * Test: TokenizerContext delegates to its bound lexer
+ */
+static bool test_context_binding(void) {
+    const LexerRuleSpec rules[] = {
+        { "emit", "emit", TOKEN_KEYWORD, TOKEN_FLAG_NONE },
+    };
+    const CompiledLexer* lexer = rift_lexer_compile(rules, 1);
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(lexer && ctx, "Lexer and context created");
+
+    TEST_ASSERT(rift_tokenizer_set_lexer(ctx, lexer), "Lexer bound to context");
+    rift_lexer_release(lexer);  /* Context keeps its own reference */
+
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, "emit(x)", 7), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Context processes input");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 5, "emit ( x ) EOF");
+    TEST_ASSERT(tokens[0].type == TOKEN_KEYWORD && spans[0].length == 4,
+                "Bound rule set used by context");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Context lexer binding");
+}
+
+int main(void) {
+    printf("RIFT-0 Compiled Lexer Tests\n");
+    printf("===========================\n");
+
+    run_test("Default Lexer Scan", test_default_lexer_scan);
+    run_test("Rule Spec Override", test_rule_spec_override);
+    run_test("Mixed Flag Rules", test_mixed_flag_rules);
+    run_test("Shared Lexer Threads", test_shared_lexer_threads);
+    run_test("Context Binding", test_context_binding);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,158 @@
+/**
+ * =================================================================
+ * test_dfa_profile.c - RIFT-0 DFA Visit Profile Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Instrumented scanner counters and profile files
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/default_scanner.h"
+#include "rift-0/core/dfa_profile.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+#define PROFILE_PATH "test_dfa_profile.prof"
+
+static const char* g_sample =
+    "int main(void) {\n"
+    "    // count to 0x10\n"
+    "    for (int i = 0; i < 16; i++) { total += i * 2.5e3; }\n"
+    "    return puts(\"done\") >= 0 && 'x' != '\\n';\n"
+    "}\n";
+
+/* Start-state visits in a profile file */
+static uint64_t read_start_visits(const char* path) {
+    FILE* in = fopen(path, "r");
+    if (!in) return 0;
+
+    char line[128];
+    uint64_t visits = 0;
+    while (fgets(line, sizeof(line), in)) {
+        unsigned state;
+        uint64_t count;
+        if (sscanf(line, "state %u %" SCNu64, &state, &count) == 2 && state == 0) {
+            visits = count;
+        }
+    }
+    fclose(in);
+    return visits;
+}
+
+static bool test_instrumented_scan_matches(void) {
+    const RiftDfaProfileCounters* counters = &rift_default_profiled_counters;
+    rift_dfa_profile_reset(counters);
+    TEST_ASSERT(rift_dfa_profile_total(counters) == 0, "Reset clears counters");
+    TEST_ASSERT(counters->state_count == rift_default_dfa_state_count, "Same DFA as the default scanner");
+
+    const unsigned char* p = (const unsigned char*)g_sample;
+    const unsigned char* end = p + strlen(g_sample);
+    uint64_t scans = 0;
+    while (p < end) {
+        TokenType plain_type = TOKEN_UNKNOWN;
+        TokenType profiled_type = TOKEN_UNKNOWN;
+        size_t plain = rift_default_scan(p, end, &plain_type);
+        size_t profiled = rift_default_profiled_scan(p, end, &profiled_type);
+        TEST_ASSERT(plain == profiled && plain_type == profiled_type, "Twin returns the same match");
+        p += plain ? plain : 1;
+        scans++;
+    }
+
+    TEST_ASSERT(counters->state_visits[0] == scans, "Every scan enters the start state");
+
+    uint64_t edges = 0;
+    for (uint32_t i = 0; i < counters->edge_count; i++) {
+        edges += counters->edge_visits[i];
+    }
+    TEST_ASSERT(edges + scans == rift_dfa_profile_total(counters), "Each non-start visit follows one edge");
+    TEST_PASS("Instrumented scan matches");
+}
+
+static bool test_profile_merges_across_runs(void) {
+    const RiftDfaProfileCounters* counters = &rift_default_profiled_counters;
+    remove(PROFILE_PATH);
+
+    TokenizerContext* ctx = rift_tokenizer_create(64);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_lexer(ctx, rift_lexer_profiling()), "Profiling lexer selected");
+
+    rift_dfa_profile_reset(counters);
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, g_sample, strlen(g_sample)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Processed with the profiling lexer");
+    uint64_t run_visits = counters->state_visits[0];
+    TEST_ASSERT(run_visits > 0, "Tokenizer drove the instrumented scanner");
+
+    TEST_ASSERT(rift_dfa_profile_save(counters, PROFILE_PATH), "First save");
+    TEST_ASSERT(read_start_visits(PROFILE_PATH) == run_visits, "Profile holds this run");
+    TEST_ASSERT(rift_dfa_profile_save(counters, PROFILE_PATH), "Second save");
+    TEST_ASSERT(read_start_visits(PROFILE_PATH) == 2 * run_visits, "Matching profile is merged");
+
+    rift_tokenizer_destroy(ctx);
+    remove(PROFILE_PATH);
+    TEST_PASS("Profile merges across runs");
+}
+
+static bool test_stale_and_malformed_profiles(void) {
+    const RiftDfaProfileCounters* counters = &rift_default_profiled_counters;
+
+    FILE* out = fopen(PROFILE_PATH, "w");
+    TEST_ASSERT(out != NULL, "Stale profile written");
+    fprintf(out, "fingerprint %016" PRIx64 "\nstate 0 999999\n", counters->fingerprint ^ 1u);
+    fclose(out);
+
+    TEST_ASSERT(rift_dfa_profile_save(counters, PROFILE_PATH), "Stale profile replaced");
+    TEST_ASSERT(read_start_visits(PROFILE_PATH) == counters->state_visits[0], "Stale counts dropped");
+
+    out = fopen(PROFILE_PATH, "w");
+    TEST_ASSERT(out != NULL, "Malformed profile written");
+    fprintf(out, "fingerprint %016" PRIx64 "\nedge 0 0 5\n", counters->fingerprint);
+    fclose(out);
+    TEST_ASSERT(!rift_dfa_profile_save(counters, PROFILE_PATH), "Unknown edge rejected");
+
+    remove(PROFILE_PATH);
+    TEST_PASS("Stale and malformed profiles");
+}
+
+int main(void) {
+    printf("RIFT-0 DFA Profile Tests\n");
+    printf("========================\n");
+
+    run_test("Instrumented Scan Matches", test_instrumented_scan_matches);
+    run_test("Profile Merges Across Runs", test_profile_merges_across_runs);
+    run_test("Stale And Malformed Profiles", test_stale_and_malformed_profiles);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
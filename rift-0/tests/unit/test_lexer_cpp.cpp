@@ -0,0 +1,125 @@
+/**
+ * =================================================================
+ * test_lexer_cpp.cpp - RIFT-0 Compile-Time C++ Lexer Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: constexpr DFA tables and string_view token access
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/lexer.hpp"
+#include "rift-0/core/tokenizer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+using sql_lexer = rift::lexer<
+    rift::rule<"select", TOKEN_KEYWORD, TOKEN_FLAG_IGNORECASE>,
+    rift::rule<"from", TOKEN_KEYWORD>,
+    rift::rule<"FROM", TOKEN_OPERATOR>,
+    rift::rule<"selection", TOKEN_DELIMITER>,
+    rift::rule<"<=>", TOKEN_OPERATOR>>;
+
+/* Tables are built by the compiler, so these are checked at build time */
+static_assert(sql_lexer::match_literal("SeLeCt *").type == TOKEN_KEYWORD);
+static_assert(sql_lexer::match_literal("SeLeCt *").text.size() == 6);
+static_assert(sql_lexer::match_literal("from").type == TOKEN_KEYWORD);
+static_assert(sql_lexer::match_literal("FROM").type == TOKEN_OPERATOR);
+static_assert(sql_lexer::match_literal("From").type == TOKEN_UNKNOWN);
+static_assert(sql_lexer::match_literal("selections").text == "selection");
+static_assert(sql_lexer::match_literal("SELECTION").type == TOKEN_KEYWORD);
+static_assert(sql_lexer::state_count() <= 2 + 6 + 4 + 4 + 9 + 3);
+
+/**
+ * Test: scanning layers the literal table over the default rules
+ */
+static bool test_static_scan(void) {
+    static const char source[] = "SELECT a <=> b FROM t // done\n";
+    static const TokenType expected[] = {
+        TOKEN_KEYWORD, TOKEN_IDENTIFIER, TOKEN_OPERATOR, TOKEN_IDENTIFIER,
+        TOKEN_OPERATOR, TOKEN_IDENTIFIER
+    };
+    static const char* texts[] = { "SELECT", "a", "<=>", "b", "FROM", "t" };
+
+    auto stream = sql_lexer::scan(source);
+    size_t count = 0;
+    for (rift::token t; stream.next(t); count++) {
+        TEST_ASSERT(count < 6, "No extra tokens");
+        TEST_ASSERT(t.type == expected[count], "Token type");
+        TEST_ASSERT(t.text == texts[count], "Token text");
+        TEST_ASSERT(t.text.data() == source + t.offset, "Text views the input");
+    }
+    TEST_ASSERT(count == 6, "All tokens seen");
+
+    /* An unmatched code point is one unknown token, as in the C tokenizer */
+    auto symbol = sql_lexer::scan("a \xE2\x82\xAC b");
+    rift::token t;
+    TEST_ASSERT(symbol.next(t) && symbol.next(t), "Symbol token");
+    TEST_ASSERT(t.type == TOKEN_UNKNOWN && t.text.size() == 3, "Euro sign kept whole");
+    TEST_PASS("Static scan");
+}
+
+/**
+ * Test: the same tables drive a TokenizerContext through the C API
+ */
+static bool test_context_binding(void) {
+    const CompiledLexer* lexer = sql_lexer::compile();
+    TEST_ASSERT(lexer != nullptr, "Lexer over static tables");
+
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != nullptr, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_lexer(ctx, lexer), "Lexer bound");
+    rift_lexer_release(lexer);
+
+    static const char source[] = "select x from y";
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, source, sizeof(source) - 1), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    TEST_ASSERT(count == 5, "select x from y EOF");
+    TEST_ASSERT(tokens[0].type == TOKEN_KEYWORD && tokens[2].type == TOKEN_KEYWORD,
+                "Keywords from the static table");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Context binding");
+}
+
+int main(void) {
+    printf("RIFT-0 C++ Lexer Tests\n");
+    printf("======================\n");
+
+    run_test("Static Scan", test_static_scan);
+    run_test("Context Binding", test_context_binding);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
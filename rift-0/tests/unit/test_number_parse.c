@@ -0,0 +1,156 @@
+/**
+ * =================================================================
+ * test_number_parse.c - RIFT-0 Numeric Literal Conversion Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Lex-time number conversion and the constant table
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/number_parse.h"
+#include "rift-0/core/compiled_lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+static bool parse(const char* text, RiftNumber* out) {
+    return rift_number_parse(text, strlen(text), out);
+}
+
+/**
+ * Test: integer forms, separators and overflow
+ */
+static bool test_integers(void) {
+    RiftNumber n;
+    TEST_ASSERT(parse("0", &n) && n.kind == RIFT_NUMBER_INTEGER && n.as.integer == 0, "Zero");
+    TEST_ASSERT(parse("1_000_000", &n) && n.as.integer == 1000000, "Decimal separators");
+    TEST_ASSERT(parse("0xFF_ff", &n) && n.as.integer == 0xFFFF, "Hex");
+    TEST_ASSERT(parse("0b1010_0001", &n) && n.as.integer == 0xA1, "Binary");
+    TEST_ASSERT(parse("18446744073709551615", &n) && n.kind == RIFT_NUMBER_INTEGER &&
+                n.as.integer == UINT64_MAX, "uint64 maximum stays integral");
+    TEST_ASSERT(parse("18446744073709551616", &n) && n.kind == RIFT_NUMBER_FLOAT &&
+                n.as.real == 18446744073709551616.0, "Decimal overflow becomes float");
+    TEST_ASSERT(parse("0xFFFFFFFFFFFFFFFF", &n) && n.as.integer == UINT64_MAX, "Hex maximum");
+    TEST_ASSERT(!parse("0x1_0000_0000_0000_0000", &n), "Hex overflow rejected");
+    TEST_ASSERT(!parse("0b102", &n) && !parse("0x_", &n), "Bad digits rejected");
+    TEST_ASSERT(!parse("0x_1", &n) && !parse("0b1_", &n), "Radix separator needs digits on both sides");
+    TEST_ASSERT(!parse("1_", &n) && !parse("_1", &n) && !parse("1__0", &n), "Stray decimal separators rejected");
+    TEST_ASSERT(!parse("1_.5", &n) && !parse("1._5", &n) && !parse("1_e5", &n),
+                "Separator next to '.' or exponent rejected");
+    TEST_PASS("Integer conversion");
+}
+
+/**
+ * Test: floats round exactly like strtod across all three paths
+ */
+static bool test_floats(void) {
+    static const char* cases[] = {
+        "0.1", "3.14159", "6.02214076e23", "1e22", "1e23", "9007199254740993.0",
+        "2.2250738585072011e-308", "4.9e-324", "1e-400", "1.7976931348623157e308",
+        "123456789012345678901234567890.5", "0.000000000000000000000000000001",
+        "7.3177701707893310e+15", "1_000.25"
+    };
+    RiftNumber n;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char plain[64];
+        size_t k = 0;
+        for (const char* c = cases[i]; *c; c++) {
+            if (*c != '_') plain[k++] = *c;
+        }
+        plain[k] = '\0';
+        double expected = strtod(plain, NULL);
+        TEST_ASSERT(parse(cases[i], &n) && n.kind == RIFT_NUMBER_FLOAT, "Float kind");
+        TEST_ASSERT(memcmp(&n.as.real, &expected, sizeof(double)) == 0, "Matches strtod");
+    }
+
+    /* Shortest round-trip strings of pseudo-random doubles */
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 100000; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double value;
+        uint64_t bits = state & 0x7FEFFFFFFFFFFFFFULL;
+        memcpy(&value, &bits, sizeof(value));
+
+        char text[40];
+        snprintf(text, sizeof(text), "%.*e", 1 + (int)(state % 17), value);
+        double expected = strtod(text, NULL);
+        TEST_ASSERT(parse(text, &n) && memcmp(&n.as.real, &expected, sizeof(double)) == 0,
+                    "Random literal matches strtod");
+    }
+    TEST_PASS("Float conversion");
+}
+
+/**
+ * Test: processing fills the constant table keyed by token index
+ */
+static bool test_constant_table(void) {
+    static const char source[] = "x = 0x10 + 2.5e1 * y - 1_000;";
+
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, source, sizeof(source) - 1), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    TEST_ASSERT(count == 11, "x = 0x10 + 2.5e1 * y - 1_000 ; EOF");
+    TEST_ASSERT(tokens[2].type == TOKEN_LITERAL_NUMBER, "Hex lexed as one number");
+
+    size_t constant_count = 0;
+    rift_tokenizer_get_constants(ctx, &constant_count);
+    TEST_ASSERT(constant_count == 3, "One constant per number");
+
+    const TokenConstant* c = rift_tokenizer_get_constant(ctx, 2);
+    TEST_ASSERT(c && c->number.kind == RIFT_NUMBER_INTEGER && c->number.as.integer == 16, "0x10");
+    c = rift_tokenizer_get_constant(ctx, 4);
+    TEST_ASSERT(c && c->number.kind == RIFT_NUMBER_FLOAT && c->number.as.real == 25.0, "2.5e1");
+    c = rift_tokenizer_get_constant(ctx, 8);
+    TEST_ASSERT(c && c->number.as.integer == 1000, "1_000");
+    TEST_ASSERT(rift_tokenizer_get_constant(ctx, 6) == NULL, "Identifier has no constant");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Constant table");
+}
+
+int main(void) {
+    printf("RIFT-0 Numeric Literal Tests\n");
+    printf("============================\n");
+
+    run_test("Integer Conversion", test_integers);
+    run_test("Float Conversion", test_floats);
+    run_test("Constant Table", test_constant_table);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,129 @@
+/**
+ * =================================================================
+ * test_profile_layout.c - RIFT-0 Profile-Guided Scanner Layout Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: rift_lexgen --dfa-profile output equivalence
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * Built by `make profile-check` against a scanner that rift_lexgen
+ * laid out from a profile the CLI recorded (rift-0 --dfa-profile).
+ * Layout only reorders states and branches, so rift_layout_scan must
+ * return exactly what the library's unprofiled rift_default_scan does.
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/default_scanner.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/* Generated by rift_lexgen --prefix rift_layout --dfa-profile FILE */
+size_t rift_layout_scan(const unsigned char* cursor, const unsigned char* limit,
+                        TokenType* out_type);
+extern const size_t rift_layout_dfa_state_count;
+
+static const char** g_inputs;
+static int g_input_count;
+
+/* Compare both scanners from every byte offset, not just token starts */
+static bool scanners_agree(const unsigned char* data, size_t length) {
+    const unsigned char* end = data + length;
+    for (const unsigned char* p = data; p < end; p++) {
+        TokenType plain_type = TOKEN_UNKNOWN;
+        TokenType layout_type = TOKEN_UNKNOWN;
+        size_t plain = rift_default_scan(p, end, &plain_type);
+        size_t layout = rift_layout_scan(p, end, &layout_type);
+        if (plain != layout || (plain && plain_type != layout_type)) {
+            printf("  Mismatch at offset %zu: %zu/%d vs %zu/%d\n",
+                   (size_t)(p - data), plain, (int)plain_type, layout, (int)layout_type);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool test_same_dfa(void) {
+    TEST_ASSERT(rift_layout_dfa_state_count == rift_default_dfa_state_count,
+                "Profiled layout keeps the minimized DFA");
+    TEST_PASS("Same DFA");
+}
+
+static bool test_profiled_inputs_match(void) {
+    TEST_ASSERT(g_input_count > 0, "Profiled inputs given");
+
+    for (int i = 0; i < g_input_count; i++) {
+        FILE* in = fopen(g_inputs[i], "rb");
+        TEST_ASSERT(in != NULL, "Input opened");
+        fseek(in, 0, SEEK_END);
+        long size = ftell(in);
+        fseek(in, 0, SEEK_SET);
+        TEST_ASSERT(size >= 0, "Input size read");
+
+        unsigned char* data = malloc((size_t)size + 1);
+        TEST_ASSERT(data != NULL, "Input buffer allocated");
+        size_t got = fread(data, 1, (size_t)size, in);
+        fclose(in);
+
+        bool agree = got == (size_t)size && scanners_agree(data, got);
+        free(data);
+        TEST_ASSERT(agree, "Profiled scanner matches the default on a profiled input");
+    }
+    TEST_PASS("Profiled inputs match");
+}
+
+static bool test_cold_paths_match(void) {
+    /* States the profile never visited still have to scan correctly */
+    static const char* cold =
+        "0b1011 0o17 0x_ 1e+ 1.5e-3f \"unterminated\n 'a' '\\'' /* open\n"
+        "R\"/[a-z]+/gi\" @@ $$ \\\\ \xc3\xa9t\xc3\xa9 \xff\xfe\x01\t\r\n";
+    TEST_ASSERT(scanners_agree((const unsigned char*)cold, strlen(cold)), "Cold paths agree");
+
+    unsigned char bytes[256];
+    for (int i = 0; i < 256; i++) bytes[i] = (unsigned char)i;
+    TEST_ASSERT(scanners_agree(bytes, sizeof(bytes)), "Every byte value agrees");
+    TEST_PASS("Cold paths match");
+}
+
+int main(int argc, char* argv[]) {
+    printf("RIFT-0 Profile Layout Tests\n");
+    printf("===========================\n");
+
+    g_inputs = (const char**)(argv + 1);
+    g_input_count = argc - 1;
+
+    run_test("Same DFA", test_same_dfa);
+    run_test("Profiled Inputs Match", test_profiled_inputs_match);
+    run_test("Cold Paths Match", test_cold_paths_match);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,138 @@
+/**
+ * =================================================================
+ * test_raw_string.c - RIFT-0 Raw String Literal Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Delimiter scanning and zero-copy raw bodies
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/raw_string.h"
+#include "rift-0/core/compiled_lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+static size_t scan(const char* text, RiftRawString* out) {
+    return rift_raw_string_scan(text, strlen(text), out);
+}
+
+/**
+ * Test: the body ends at ')' + delimiter + quote, not at the first ')'
+ */
+static bool test_delimiter_scan(void) {
+    RiftRawString raw;
+    const char* text = "R\"xy(a)\"b)x\"c)xy\" tail";
+    TEST_ASSERT(scan(text, &raw) == 17, "Literal ends after )xy\"");
+    TEST_ASSERT(raw.delimiter_length == 2 && raw.body_offset == 5 && raw.body_length == 8,
+                "Body spans the false closers");
+    TEST_ASSERT(memcmp(text + raw.body_offset, "a)\"b)x\"c", 8) == 0, "Body is in place");
+
+    TEST_ASSERT(scan("R\"(x)\"", &raw) == 6 && raw.body_length == 1, "Empty delimiter");
+    TEST_ASSERT(scan("R'(a|b)'gi;", &raw) == 10 && raw.suffix_length == 2, "Pattern flags");
+    TEST_ASSERT(rift_raw_string_flags("gi", 2) == (TOKEN_FLAG_GLOBAL | TOKEN_FLAG_IGNORECASE),
+                "Flags mapped");
+    TEST_ASSERT(scan("R\"ab(x)a\"", &raw) == 0, "Unterminated");
+    TEST_ASSERT(scan("R\"a b(x)a b\"", &raw) == 0, "Space in delimiter");
+    TEST_ASSERT(scan("R\"12345678901234567(x)12345678901234567\"", &raw) == 0,
+                "Delimiter over 16 bytes");
+
+    RiftRawString split;
+    text = "R\"xy(a)\"b)x\"c)xy\"gm";
+    TEST_ASSERT(scan(text, &raw) == strlen(text), "Scanned with suffix");
+    TEST_ASSERT(rift_raw_string_split(text, raw.length, &split) &&
+                memcmp(&split, &raw, sizeof(raw)) == 0, "Split agrees with scan");
+    TEST_PASS("Delimiter scan");
+}
+
+/**
+ * Test: a multi-megabyte body full of ')' candidates
+ */
+static bool test_large_body(void) {
+    const size_t body_length = 4u << 20;
+    char* text = malloc(body_length + 32);
+    TEST_ASSERT(text != NULL, "Buffer allocated");
+
+    memcpy(text, "R\"end(", 6);
+    for (size_t i = 0; i < body_length; i++) {
+        text[6 + i] = (i % 61 == 0) ? ')' : (i % 67 == 0) ? 'e' : 'a';
+    }
+    memcpy(text + 6 + body_length, ")end\"", 5);
+
+    RiftRawString raw;
+    size_t length = rift_raw_string_scan(text, body_length + 11, &raw);
+    free(text);
+    TEST_ASSERT(length == body_length + 11, "Whole literal");
+    TEST_ASSERT(raw.body_length == body_length, "Whole body");
+    TEST_PASS("Large body");
+}
+
+/**
+ * Test: the tokenizer emits raw literals as one string token
+ */
+static bool test_tokenizer_raw_literal(void) {
+    static const char source[] = "re = R\"re(a)\"|b)re\"gi;";
+
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, source, sizeof(source) - 1), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    TEST_ASSERT(count == 5, "re = literal ; EOF");
+    TEST_ASSERT(tokens[2].type == TOKEN_LITERAL_STRING, "Raw literal is a string token");
+
+    size_t length = 0;
+    TokenFlags flags = TOKEN_FLAG_NONE;
+    const char* body = rift_tokenizer_raw_body(ctx, 2, &length, &flags);
+    TEST_ASSERT(body && length == 5 && memcmp(body, "a)\"|b", 5) == 0, "Zero-copy body");
+    TEST_ASSERT(body >= ctx->input_buffer && body < ctx->input_buffer + ctx->input_length,
+                "Body points into the input");
+    TEST_ASSERT(flags == (TOKEN_FLAG_GLOBAL | TOKEN_FLAG_IGNORECASE), "Suffix flags");
+    TEST_ASSERT(rift_tokenizer_raw_body(ctx, 0, &length, NULL) == NULL, "Identifier has no body");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Tokenizer raw literal");
+}
+
+int main(void) {
+    printf("RIFT-0 Raw String Tests\n");
+    printf("=======================\n");
+
+    run_test("Delimiter Scan", test_delimiter_scan);
+    run_test("Large Body", test_large_body);
+    run_test("Tokenizer Raw Literal", test_tokenizer_raw_literal);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,237 @@
+/**
+ * =================================================================
+ * test_token_batch.c - RIFT-0 Batch Tokenization Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Shared token arena, offsets index and sharded scan
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/token_batch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+#define BATCH_INPUTS 1000
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static const char* g_expressions[] = {
+    "a + b",
+    "x1 >= 42",
+    "",
+    "(foo * bar) / 7",
+    "count++",
+    "\"str\" + 'c'",
+    "r = 3.14 // pi",
+    "/* lead */ x\n\t+ 0x1F /* mid */ * 1_000",
+    "   \n// only trivia\n",
+};
+#define EXPRESSION_COUNT (sizeof(g_expressions) / sizeof(g_expressions[0]))
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/* Compare one batch slice against rift_tokenizer_process on the same input */
+static bool slice_matches_process(const TokenBatch* batch, size_t index,
+                                  const char* input, size_t length) {
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    if (!ctx) {
+        return false;
+    }
+    bool ok = rift_tokenizer_set_input(ctx, input, length) && rift_tokenizer_process(ctx);
+
+    size_t expected_count = 0;
+    size_t count = 0;
+    const TokenTriplet* expected = rift_tokenizer_get_tokens(ctx, &expected_count);
+    const TokenSpan* expected_spans = rift_tokenizer_get_spans(ctx, &expected_count);
+    const TokenTriplet* tokens = rift_token_batch_tokens(batch, index, &count);
+    const TokenSpan* spans = rift_token_batch_spans(batch, index, &count);
+
+    /* Process output carries a trailing EOF the batch omits */
+    ok = ok && count + 1 == expected_count;
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = tokens[i].type == expected[i].type &&
+             tokens[i].mem_ptr == expected[i].mem_ptr &&
+             spans[i].offset == expected_spans[i].offset &&
+             spans[i].length == expected_spans[i].length;
+    }
+
+    size_t expected_constant_count = 0;
+    size_t constant_count = 0;
+    const TokenConstant* expected_constants = rift_tokenizer_get_constants(ctx, &expected_constant_count);
+    const TokenConstant* constants = rift_token_batch_constants(batch, index, &constant_count);
+    ok = ok && constant_count == expected_constant_count;
+    for (size_t i = 0; ok && i < constant_count; i++) {
+        ok = constants[i].token == expected_constants[i].token &&
+             constants[i].number.kind == expected_constants[i].number.kind &&
+             constants[i].number.as.integer == expected_constants[i].number.as.integer;
+    }
+
+    rift_tokenizer_destroy(ctx);
+    return ok;
+}
+
+/**
+ * Test: interleaved batch matches rift_tokenizer_process per input,
+ * trivia dropped and numeric constants included
+ */
+static bool test_batch_matches_process(void) {
+    size_t lengths[EXPRESSION_COUNT];
+    for (size_t i = 0; i < EXPRESSION_COUNT; i++) {
+        lengths[i] = strlen(g_expressions[i]);
+    }
+
+    TokenBatch batch;
+    rift_token_batch_init(&batch);
+    TEST_ASSERT(rift_tokenizer_process_batch(rift_lexer_default(), g_expressions, lengths,
+                                             EXPRESSION_COUNT, &batch),
+                "Batch processes");
+    TEST_ASSERT(batch.input_count == EXPRESSION_COUNT, "Every input indexed");
+    TEST_ASSERT(batch.offsets[EXPRESSION_COUNT] == batch.token_count, "Offsets close the arena");
+
+    size_t count = 0;
+    rift_token_batch_tokens(&batch, 2, &count);
+    TEST_ASSERT(count == 0, "Empty input yields no tokens");
+
+    for (size_t i = 0; i < EXPRESSION_COUNT; i++) {
+        TEST_ASSERT(slice_matches_process(&batch, i, g_expressions[i], lengths[i]),
+                    "Batch slice matches rift_tokenizer_process");
+    }
+
+    const TokenTriplet* tokens = rift_token_batch_tokens(&batch, EXPRESSION_COUNT - 1, &count);
+    TEST_ASSERT(tokens != NULL && count == 0, "Trivia-only input yields no tokens");
+    rift_token_batch_constants(&batch, EXPRESSION_COUNT - 2, &count);
+    TEST_ASSERT(count == 2, "0x1F and 1_000 converted");
+
+    /* Reuse keeps the arena and replaces its contents */
+    size_t capacity = batch.token_capacity;
+    TEST_ASSERT(rift_tokenizer_process_batch(rift_lexer_default(), g_expressions, lengths,
+                                             2, &batch),
+                "Batch reprocesses");
+    TEST_ASSERT(batch.input_count == 2 && batch.token_capacity == capacity,
+                "Arena reused across calls");
+
+    rift_token_batch_free(&batch);
+    TEST_PASS("Batch matches process");
+}
+
+/**
+ * Test: inputs scanned alone take the same steps; ill-formed UTF-8
+ * fails the batch as it fails rift_tokenizer_process
+ */
+static bool test_large_and_invalid_inputs(void) {
+    static const char chunk[] = "total = total + 42; /* step */\n";
+    size_t large_length = 100 * 1024;
+    char* large = malloc(large_length);
+    TEST_ASSERT(large != NULL, "Large input allocated");
+    for (size_t i = 0; i < large_length; i++) {
+        large[i] = chunk[i % (sizeof(chunk) - 1)];
+    }
+
+    const char* inputs[] = { "x // a", large, "7" };
+    size_t lengths[] = { 6, large_length, 1 };
+
+    TokenBatch batch;
+    rift_token_batch_init(&batch);
+    TEST_ASSERT(rift_tokenizer_process_batch(rift_lexer_default(), inputs, lengths, 3, &batch),
+                "Batch with a large input processes");
+    for (size_t i = 0; i < 3; i++) {
+        TEST_ASSERT(slice_matches_process(&batch, i, inputs[i], lengths[i]),
+                    "Each slice matches rift_tokenizer_process");
+    }
+
+    const char* broken[] = { "ok", "bad \xC3(" };
+    size_t broken_lengths[] = { 2, 6 };
+    TEST_ASSERT(!rift_tokenizer_process_batch(rift_lexer_default(), broken, broken_lengths, 2, &batch),
+                "Ill-formed UTF-8 rejected");
+
+    rift_token_batch_free(&batch);
+    free(large);
+    TEST_PASS("Large and invalid inputs");
+}
+
+/**
+ * Test: sharded batch equals the single-thread batch
+ */
+static bool test_parallel_batch(void) {
+    const char* inputs[BATCH_INPUTS];
+    size_t lengths[BATCH_INPUTS];
+    for (size_t i = 0; i < BATCH_INPUTS; i++) {
+        inputs[i] = g_expressions[i % EXPRESSION_COUNT];
+        lengths[i] = strlen(inputs[i]);
+    }
+
+    TokenBatch serial;
+    TokenBatch sharded;
+    rift_token_batch_init(&serial);
+    rift_token_batch_init(&sharded);
+
+    TEST_ASSERT(rift_tokenizer_process_batch(rift_lexer_default(), inputs, lengths,
+                                             BATCH_INPUTS, &serial),
+                "Serial batch processes");
+    TEST_ASSERT(rift_tokenizer_process_batch_parallel(rift_lexer_default(), inputs, lengths,
+                                                      BATCH_INPUTS, &sharded, 4),
+                "Sharded batch processes");
+
+    TEST_ASSERT(serial.token_count == sharded.token_count, "Token counts agree");
+    TEST_ASSERT(memcmp(serial.offsets, sharded.offsets,
+                       (BATCH_INPUTS + 1) * sizeof(size_t)) == 0,
+                "Offsets index agrees");
+    TEST_ASSERT(memcmp(serial.tokens, sharded.tokens,
+                       serial.token_count * sizeof(TokenTriplet)) == 0,
+                "Token arenas agree");
+    TEST_ASSERT(memcmp(serial.spans, sharded.spans,
+                       serial.token_count * sizeof(TokenSpan)) == 0,
+                "Span arenas agree");
+    TEST_ASSERT(serial.constant_count == sharded.constant_count &&
+                memcmp(serial.constant_offsets, sharded.constant_offsets,
+                       (BATCH_INPUTS + 1) * sizeof(size_t)) == 0,
+                "Constant index agrees");
+    for (size_t i = 0; i < serial.constant_count; i++) {
+        TEST_ASSERT(serial.constants[i].token == sharded.constants[i].token &&
+                    serial.constants[i].number.as.integer == sharded.constants[i].number.as.integer,
+                    "Constants agree");
+    }
+
+    rift_token_batch_free(&serial);
+    rift_token_batch_free(&sharded);
+    TEST_PASS("Sharded batch");
+}
+
+int main(void) {
+    printf("RIFT-0 Batch Tokenization Tests\n");
+    printf("===============================\n");
+
+    run_test("Batch Matches Process", test_batch_matches_process);
+    run_test("Large And Invalid Inputs", test_large_and_invalid_inputs);
+    run_test("Parallel Batch", test_parallel_batch);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,185 @@
+/**
+ * =================================================================
+ * test_token_output.c - RIFT-0 Buffered Token Output Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Hand-rolled formatting, escaping and parallel ranges
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L /* fileno, lseek */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/token_output.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Enough for several parallel rounds */
+#define DUMP_TOKENS (RIFT_OUTPUT_CHUNK_TOKENS * 5 + 123)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/* Render a dump into a heap string through a temporary file */
+static char* dump_to_string(RiftOutputFormat format, const TokenTriplet* tokens,
+                            size_t count, size_t threads, size_t* length) {
+    FILE* file = tmpfile();
+    if (!file) return NULL;
+
+    char* text = NULL;
+    if (rift_output_write_tokens(fileno(file), format, tokens, count, "1.0.0", threads)) {
+        /* Dumps bypass stdio, so size the file through its descriptor */
+        off_t end = lseek(fileno(file), 0, SEEK_END);
+        text = malloc((size_t)end + 1);
+        rewind(file);
+        if (text && fread(text, 1, (size_t)end, file) == (size_t)end) {
+            text[end] = '\0';
+            *length = (size_t)end;
+        } else {
+            free(text);
+            text = NULL;
+        }
+    }
+
+    fclose(file);
+    return text;
+}
+
+/**
+ * Test: integer and escape formatting match their stdio equivalents
+ */
+static bool test_formatting_primitives(void) {
+    OutputBuffer out;
+    TEST_ASSERT(rift_output_init(&out, -1, 8), "Memory buffer initializes");
+
+    const uint64_t values[] = { 0, 7, 10, 99, 100, 65535, 1234567890123ULL, UINT64_MAX };
+    char expected[512] = {0};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        rift_output_u64(&out, values[i]);
+        rift_output_char(&out, ' ');
+        snprintf(expected + strlen(expected), sizeof(expected) - strlen(expected),
+                 "%llu ", (unsigned long long)values[i]);
+    }
+    rift_output_hex8(&out, 0xA7);
+    strcat(expected, "0xA7");
+
+    TEST_ASSERT(out.length == strlen(expected) && memcmp(out.data, expected, out.length) == 0,
+                "Integers format like printf");
+
+    /* Long clean runs exercise the vector scan; escapes land mid-block */
+    static const char raw[] = "plain text that spans more than sixteen bytes \"quoted\\\"\n\ttab\x01";
+    static const char json[] = "plain text that spans more than sixteen bytes \\\"quoted\\\\\\\"\\n\\ttab\\u0001";
+    out.length = 0;
+    rift_output_json_escaped(&out, raw, sizeof(raw) - 1);
+    TEST_ASSERT(out.length == sizeof(json) - 1 && memcmp(out.data, json, out.length) == 0,
+                "JSON escaping");
+
+    out.length = 0;
+    rift_output_csv_field(&out, "say \"hi\", ok", 12);
+    TEST_ASSERT(out.length == 16 && memcmp(out.data, "\"say \"\"hi\"\", ok\"", 16) == 0,
+                "CSV quotes doubled");
+
+    out.length = 0;
+    rift_output_xml_escaped(&out, "a<b & 'c'", 9);
+    TEST_ASSERT(out.length == 26 && memcmp(out.data, "a&lt;b &amp; &apos;c&apos;", 26) == 0,
+                "XML entities");
+
+    out.length = 0;
+    rift_output_flags(&out, TOKEN_FLAG_GLOBAL | TOKEN_FLAG_IGNORECASE);
+    TEST_ASSERT(out.length == 17 && memcmp(out.data, "GLOBAL|IGNORECASE", 17) == 0,
+                "Flag names joined");
+
+    rift_output_destroy(&out);
+    TEST_PASS("Formatting primitives");
+}
+
+/**
+ * Test: CSV dump matches the former fprintf layout
+ */
+static bool test_csv_dump_layout(void) {
+    TokenTriplet tokens[2] = {
+        rift_token_create(TOKEN_IDENTIFIER, 0, TOKEN_FLAG_NONE),
+        rift_token_create(TOKEN_EOF, 300, TOKEN_FLAG_VALIDATED),
+    };
+
+    size_t length = 0;
+    char* text = dump_to_string(RIFT_OUTPUT_CSV, tokens, 2, 1, &length);
+    TEST_ASSERT(text != NULL, "CSV dump written");
+
+    const char* expected =
+        "Index,Type,MemPtr,Value,Flags\n"
+        "0,IDENTIFIER,0,0,\"NONE\"\n"
+        "1,EOF,300,64,\"VALIDATED\"\n";
+    TEST_ASSERT(strcmp(text, expected) == 0, "CSV layout preserved");
+
+    free(text);
+    TEST_PASS("CSV dump layout");
+}
+
+/**
+ * Test: parallel ranges concatenate to the serial output
+ */
+static bool test_parallel_dump(void) {
+    TokenTriplet* tokens = malloc(DUMP_TOKENS * sizeof(TokenTriplet));
+    TEST_ASSERT(tokens != NULL, "Token fixture allocated");
+    for (size_t i = 0; i < DUMP_TOKENS; i++) {
+        tokens[i] = rift_token_create((uint8_t)(i % 12), (uint16_t)i, (uint8_t)(i % 7));
+    }
+
+    const RiftOutputFormat formats[] = {
+        RIFT_OUTPUT_TOKENS, RIFT_OUTPUT_JSON, RIFT_OUTPUT_CSV, RIFT_OUTPUT_XML
+    };
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        size_t serial_length = 0, parallel_length = 0;
+        char* serial = dump_to_string(formats[f], tokens, DUMP_TOKENS, 1, &serial_length);
+        char* parallel = dump_to_string(formats[f], tokens, DUMP_TOKENS, 4, &parallel_length);
+
+        bool same = serial && parallel && serial_length == parallel_length &&
+                    memcmp(serial, parallel, serial_length) == 0;
+        free(serial);
+        free(parallel);
+        TEST_ASSERT(same, "Parallel output identical to serial");
+    }
+
+    free(tokens);
+    TEST_PASS("Parallel dump");
+}
+
+int main(void) {
+    printf("RIFT-0 Token Output Tests\n");
+    printf("=========================\n");
+
+    run_test("Formatting Primitives", test_formatting_primitives);
+    run_test("CSV Dump Layout", test_csv_dump_layout);
+    run_test("Parallel Dump", test_parallel_dump);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,206 @@
+/**
+ * =================================================================
+ * test_token_stream.c - RIFT-0 Binary Token Stream Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Stream framing, round trip and random access validation
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/token_stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Spans several stream blocks */
+#define SOURCE_REPEAT 300
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+static TokenizerContext* tokenize_fixture(char** out_source) {
+    static const char line[] = "total = total + value * 42; // step\n";
+    size_t length = (sizeof(line) - 1) * SOURCE_REPEAT;
+    char* source = malloc(length + 1);
+    if (!source) return NULL;
+
+    for (size_t i = 0; i < SOURCE_REPEAT; i++) {
+        memcpy(source + i * (sizeof(line) - 1), line, sizeof(line) - 1);
+    }
+    source[length] = '\0';
+
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    if (!ctx || !rift_tokenizer_set_input(ctx, source, length) || !rift_tokenizer_process(ctx)) {
+        rift_tokenizer_destroy(ctx);
+        free(source);
+        return NULL;
+    }
+
+    *out_source = source;
+    return ctx;
+}
+
+/* Serialize ctx into a heap buffer through a temporary file */
+static uint8_t* write_fixture(const TokenizerContext* ctx, uint32_t flags, size_t* size) {
+    FILE* file = tmpfile();
+    if (!file) return NULL;
+
+    uint8_t* data = NULL;
+    if (rift_tokenizer_write_stream(ctx, file, flags)) {
+        long end = ftell(file);
+        data = malloc((size_t)end);
+        rewind(file);
+        if (data && fread(data, 1, (size_t)end, file) == (size_t)end) {
+            *size = (size_t)end;
+        } else {
+            free(data);
+            data = NULL;
+        }
+    }
+
+    fclose(file);
+    return data;
+}
+
+/**
+ * Test: stream round-trips every token and span
+ */
+static bool test_stream_round_trip(void) {
+    char* source = NULL;
+    TokenizerContext* ctx = tokenize_fixture(&source);
+    TEST_ASSERT(ctx != NULL, "Fixture tokenized");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count > 2 * RIFT_TOKEN_STREAM_BLOCK_TOKENS, "Fixture spans several blocks");
+
+    size_t size = 0;
+    uint8_t* data = write_fixture(ctx, RIFT_TOKEN_STREAM_FLAG_INDEX, &size);
+    TEST_ASSERT(data != NULL, "Stream written");
+    TEST_ASSERT(size < count * (sizeof(TokenTriplet) + sizeof(TokenSpan)) / 2,
+                "Stream is smaller than half the raw arrays");
+
+    TokenStreamView view;
+    TEST_ASSERT(rift_token_stream_open(&view, data, size), "Stream framing validates");
+    TEST_ASSERT(view.token_count == count && view.header.token_count == count,
+                "Header and trailer carry the token count");
+    TEST_ASSERT(view.header.source_hash == rift_token_stream_hash(source, strlen(source)),
+                "Source hash recorded");
+    TEST_ASSERT(view.index != NULL, "Index block present");
+
+    TokenStreamCursor cursor;
+    rift_token_stream_cursor_init(&cursor, &view);
+    TokenTriplet token;
+    TokenSpan span;
+    size_t decoded = 0;
+    while (rift_token_stream_next(&cursor, &token, &span)) {
+        TEST_ASSERT(decoded < count, "No extra tokens decoded");
+        TEST_ASSERT(memcmp(&token, &tokens[decoded], sizeof(token)) == 0, "Token round-trips");
+        TEST_ASSERT(span.offset == spans[decoded].offset && span.length == spans[decoded].length,
+                    "Span round-trips");
+        decoded++;
+    }
+    TEST_ASSERT(!cursor.corrupt && decoded == count, "Whole stream decoded");
+
+    rift_token_stream_close(&view);
+    free(data);
+    rift_tokenizer_destroy(ctx);
+    free(source);
+    TEST_PASS("Stream round trip");
+}
+
+/**
+ * Test: seeking with and without the index lands on the same token
+ */
+static bool test_stream_seek(void) {
+    char* source = NULL;
+    TokenizerContext* ctx = tokenize_fixture(&source);
+    TEST_ASSERT(ctx != NULL, "Fixture tokenized");
+
+    size_t count = 0;
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+
+    size_t indexed_size = 0, plain_size = 0;
+    uint8_t* indexed = write_fixture(ctx, RIFT_TOKEN_STREAM_FLAG_INDEX, &indexed_size);
+    uint8_t* plain = write_fixture(ctx, 0, &plain_size);
+    TEST_ASSERT(indexed && plain, "Both streams written");
+
+    TokenStreamView indexed_view, plain_view;
+    TEST_ASSERT(rift_token_stream_open(&indexed_view, indexed, indexed_size) &&
+                rift_token_stream_open(&plain_view, plain, plain_size),
+                "Both streams validate");
+    TEST_ASSERT(plain_view.index == NULL, "Plain stream has no index");
+
+    const size_t targets[] = { 0, 1, RIFT_TOKEN_STREAM_BLOCK_TOKENS,
+                               RIFT_TOKEN_STREAM_BLOCK_TOKENS * 2 + 17, count - 1 };
+    for (size_t i = 0; i < sizeof(targets) / sizeof(targets[0]); i++) {
+        TokenStreamCursor a, b;
+        TokenSpan span_a, span_b;
+        rift_token_stream_cursor_init(&a, &indexed_view);
+        rift_token_stream_cursor_init(&b, &plain_view);
+
+        TEST_ASSERT(rift_token_stream_seek(&a, targets[i]) && rift_token_stream_seek(&b, targets[i]),
+                    "Seek succeeds");
+        TEST_ASSERT(rift_token_stream_next(&a, NULL, &span_a) &&
+                    rift_token_stream_next(&b, NULL, &span_b),
+                    "Token available after seek");
+        TEST_ASSERT(span_a.offset == spans[targets[i]].offset &&
+                    span_b.offset == spans[targets[i]].offset,
+                    "Seek lands on the requested token");
+    }
+
+    TokenStreamCursor end;
+    rift_token_stream_cursor_init(&end, &indexed_view);
+    TEST_ASSERT(rift_token_stream_seek(&end, count) && !rift_token_stream_next(&end, NULL, NULL),
+                "Seek to end yields nothing");
+    TEST_ASSERT(!rift_token_stream_seek(&end, count + 1), "Seek past end rejected");
+
+    /* Truncation breaks the trailer */
+    TokenStreamView truncated;
+    TEST_ASSERT(!rift_token_stream_open(&truncated, indexed, indexed_size - 1),
+                "Truncated stream rejected");
+
+    free(indexed);
+    free(plain);
+    rift_tokenizer_destroy(ctx);
+    free(source);
+    TEST_PASS("Stream seek");
+}
+
+int main(void) {
+    printf("RIFT-0 Binary Token Stream Tests\n");
+    printf("================================\n");
+
+    run_test("Stream Round Trip", test_stream_round_trip);
+    run_test("Stream Seek", test_stream_seek);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
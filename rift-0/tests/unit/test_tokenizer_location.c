@@ -0,0 +1,91 @@
+/**
+ * =================================================================
+ * test_tokenizer_location.c - RIFT-0 Source Location Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Lazy newline table and offset -> line/column lookup
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/**
+ * Test: token offsets resolve to the expected line and column
+ */
+static bool test_token_locations(void) {
+    /* Second line is longer than a 16-byte scan block */
+    static const char source[] = "a = 1;\nsome_long_identifier_name = b;\n\n  c\n";
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, source, sizeof(source) - 1), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+    TEST_ASSERT(!ctx->newlines_valid, "Processing does not build the line table");
+
+    size_t count = 0;
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 10, "a = 1 ; name = b ; c EOF");
+
+    const size_t expected[][3] = {
+        { 0, 1, 1 }, { 3, 1, 6 }, { 4, 2, 1 }, { 6, 2, 29 }, { 8, 4, 3 }
+    };
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        size_t line = 0, column = 0;
+        TEST_ASSERT(rift_tokenizer_get_location(ctx, spans[expected[i][0]].offset, &line, &column),
+                    "Location resolved");
+        TEST_ASSERT(line == expected[i][1] && column == expected[i][2], "Line and column match");
+    }
+    TEST_ASSERT(ctx->newlines_valid && ctx->newline_count == 4, "Table built once on demand");
+
+    /* New input invalidates the table */
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, "x\ny", 3), "Second input set");
+    size_t line = 0, column = 0;
+    TEST_ASSERT(rift_tokenizer_get_location(ctx, 2, &line, &column) && line == 2 && column == 1,
+                "Rebuilt for new input");
+    TEST_ASSERT(rift_tokenizer_get_location(ctx, 99, &line, &column) && line == 2 && column == 2,
+                "Offsets past the end clamp");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Token locations");
+}
+
+int main(void) {
+    printf("RIFT-0 Source Location Tests\n");
+    printf("============================\n");
+
+    run_test("Token Locations", test_token_locations);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,201 @@
+/**
+ * =================================================================
+ * test_tokenizer_pool.c - RIFT-0 Tokenizer Pool Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Context checkout/return and buffer retention validation
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+static bool tokenize(TokenizerContext* ctx, const char* text) {
+    return rift_tokenizer_set_input(ctx, text, strlen(text)) &&
+           rift_tokenizer_process(ctx);
+}
+
+/**
+ * Test: returned contexts are reused with their buffers intact
+ */
+static bool test_checkout_reuse(void) {
+    TokenizerPoolConfig config = { 4, 8, 8, 3600.0, NULL, NULL };
+    TokenizerPool* pool = rift_tokenizer_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool created");
+
+    TokenizerContext* ctx = rift_tokenizer_pool_checkout(pool);
+    TEST_ASSERT(ctx != NULL, "First checkout allocates");
+    TEST_ASSERT(tokenize(ctx, "a + b * (c - d) / e"), "First request tokenized");
+
+    TokenTriplet* tokens = ctx->tokens;
+    char* input = ctx->input_buffer;
+    size_t high_water = ctx->token_capacity;
+    rift_tokenizer_pool_return(pool, ctx);
+
+    TokenizerContext* again = rift_tokenizer_pool_checkout(pool);
+    TEST_ASSERT(again == ctx, "Second checkout reuses pooled context");
+    TEST_ASSERT(again->token_count == 0 && again->input_length == 0,
+                "Reused context is reset");
+    TEST_ASSERT(again->token_capacity == high_water, "Token buffer kept at high-water mark");
+
+    TEST_ASSERT(tokenize(again, "x = y"), "Smaller request tokenized");
+    TEST_ASSERT(again->tokens == tokens && again->input_buffer == input,
+                "No reallocation for a request within retained capacity");
+    rift_tokenizer_pool_return(pool, again);
+
+    TokenizerPoolStats stats = rift_tokenizer_pool_get_stats(pool);
+    TEST_ASSERT(stats.checkouts == 2 && stats.hits == 1 && stats.misses == 1,
+                "Hit and miss counts recorded");
+    TEST_ASSERT(rift_tokenizer_pool_hit_rate(&stats) == 0.5, "Hit rate is 50%");
+    TEST_ASSERT(stats.retained_bytes == rift_tokenizer_retained_bytes(ctx),
+                "Retained bytes reflect idle buffers");
+    TEST_ASSERT(stats.idle_contexts == 1 && stats.active_contexts == 0,
+                "Context accounted as idle");
+
+    rift_tokenizer_pool_destroy(pool);
+    TEST_PASS("Checkout reuse");
+}
+
+/**
+ * Test: idle policy trims buffers; max_idle bounds the pool
+ */
+static bool test_idle_trim_and_bounds(void) {
+    TokenizerPoolConfig config = { 1, 8, 8, RIFT_POOL_TRIM_IMMEDIATE, NULL, NULL };
+    TokenizerPool* pool = rift_tokenizer_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool created");
+
+    TokenizerContext* a = rift_tokenizer_pool_checkout(pool);
+    TokenizerContext* b = rift_tokenizer_pool_checkout(pool);
+    TEST_ASSERT(a && b && a != b, "Two distinct contexts checked out");
+
+    TEST_ASSERT(tokenize(a, "one two three four five six seven eight nine ten"),
+                "Large request grows buffers");
+    TEST_ASSERT(a->token_capacity > 8, "Token buffer grew past initial capacity");
+
+    rift_tokenizer_pool_return(pool, a);
+    rift_tokenizer_pool_return(pool, b);
+
+    TokenizerPoolStats stats = rift_tokenizer_pool_get_stats(pool);
+    TEST_ASSERT(stats.discards == 1, "Return beyond max_idle discards context");
+    TEST_ASSERT(stats.trims >= 1, "Immediate threshold trims on return");
+    TEST_ASSERT(a->token_capacity == 8 && a->input_buffer == NULL,
+                "Trimmed context released its buffers");
+
+    TokenizerContext* c = rift_tokenizer_pool_checkout(pool);
+    TEST_ASSERT(c == a, "Trimmed context still reusable");
+    TEST_ASSERT(tokenize(c, "still works"), "Trimmed context tokenizes");
+    rift_tokenizer_pool_return(pool, c);
+
+    rift_tokenizer_pool_destroy(pool);
+    TEST_PASS("Idle trim and bounds");
+}
+
+/**
+ * Test: 0 selects the default idle time; RIFT_POOL_TRIM_NEVER keeps buffers
+ */
+static bool test_idle_trim_thresholds(void) {
+    static const double thresholds[] = { 0.0, RIFT_POOL_TRIM_NEVER };
+
+    for (size_t i = 0; i < sizeof(thresholds) / sizeof(thresholds[0]); i++) {
+        TokenizerPoolConfig config = { 1, 8, 8, thresholds[i], NULL, NULL };
+        TokenizerPool* pool = rift_tokenizer_pool_create(&config);
+        TEST_ASSERT(pool != NULL, "Pool created");
+
+        TokenizerContext* ctx = rift_tokenizer_pool_checkout(pool);
+        TEST_ASSERT(ctx && tokenize(ctx, "one two three four five six seven eight nine ten"),
+                    "Large request grows buffers");
+        rift_tokenizer_pool_return(pool, ctx);
+
+        TEST_ASSERT(rift_tokenizer_pool_trim(pool) == 0, "Fresh idle context not trimmed");
+        TEST_ASSERT(rift_tokenizer_pool_get_stats(pool).trims == 0, "No trims recorded");
+        TEST_ASSERT(ctx->token_capacity > 8, "Buffers kept at high water");
+
+        rift_tokenizer_pool_destroy(pool);
+    }
+
+    TEST_PASS("Idle trim thresholds");
+}
+
+/**
+ * Test: checkout binds the lexer slot's current generation
+ */
+static bool test_hot_swap_rebind(void) {
+    RiftLexerSlot* slot = rift_lexer_slot_create(NULL);
+    TEST_ASSERT(slot != NULL, "Slot created");
+
+    TokenizerPoolConfig config = { 4, 8, 8, 3600.0, NULL, slot };
+    TokenizerPool* pool = rift_tokenizer_pool_create(&config);
+    TEST_ASSERT(pool != NULL, "Pool created over slot");
+
+    TokenizerContext* ctx = rift_tokenizer_pool_checkout(pool);
+    TEST_ASSERT(ctx && tokenize(ctx, "let x"), "First generation request");
+    TEST_ASSERT(ctx->tokens[0].type == TOKEN_IDENTIFIER, "Default rules: let is an identifier");
+
+    const LexerRuleSpec rules[] = {
+        { "let", "let", TOKEN_KEYWORD, TOKEN_FLAG_NONE },
+    };
+    const CompiledLexer* keywords = rift_lexer_compile(rules, 1);
+    TEST_ASSERT(rift_lexer_slot_publish(slot, keywords) == 2, "Second generation published");
+    rift_lexer_release(keywords);
+
+    /* The checked-out context finishes on the generation it holds */
+    TEST_ASSERT(tokenize(ctx, "let y"), "In-flight request");
+    TEST_ASSERT(ctx->tokens[0].type == TOKEN_IDENTIFIER, "In-flight request keeps its generation");
+    rift_tokenizer_pool_return(pool, ctx);
+
+    ctx = rift_tokenizer_pool_checkout(pool);
+    TEST_ASSERT(ctx && tokenize(ctx, "let z"), "Next request");
+    TEST_ASSERT(ctx->tokens[0].type == TOKEN_KEYWORD, "Next checkout sees the new rules");
+    rift_tokenizer_pool_return(pool, ctx);
+
+    TokenizerPoolStats stats = rift_tokenizer_pool_get_stats(pool);
+    TEST_ASSERT(stats.rebinds == 1, "Reused context rebound once");
+    TEST_ASSERT(rift_lexer_slot_reclaim(slot) == 0, "Old generation reclaimed");
+
+    rift_tokenizer_pool_destroy(pool);
+    rift_lexer_slot_destroy(slot);
+    TEST_PASS("Hot-swap rebind");
+}
+
+int main(void) {
+    printf("RIFT-0 Tokenizer Pool Tests\n");
+    printf("===========================\n");
+
+    run_test("Checkout Reuse", test_checkout_reuse);
+    run_test("Idle Trim And Bounds", test_idle_trim_and_bounds);
+    run_test("Idle Trim Thresholds", test_idle_trim_thresholds);
+    run_test("Hot-Swap Rebind", test_hot_swap_rebind);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
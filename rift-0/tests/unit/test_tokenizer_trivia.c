@@ -0,0 +1,123 @@
+/**
+ * =================================================================
+ * test_tokenizer_trivia.c - RIFT-0 Trivia Side Table Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Significant-only token stream and trivia lookup
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static const char* g_source = "  a = b; // note\n  c\n";
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/**
+ * Test: the token stream holds significant tokens only
+ */
+static bool test_dense_token_stream(void) {
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, g_source, strlen(g_source)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    TEST_ASSERT(count == 6, "a = b ; c EOF");
+    for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT(tokens[i].type != TOKEN_WHITESPACE && tokens[i].type != TOKEN_COMMENT,
+                    "No trivia in token stream");
+    }
+
+    size_t trivia_count = 0;
+    rift_tokenizer_get_trivia(ctx, &trivia_count);
+    TEST_ASSERT(trivia_count == 0, "Trivia not recorded unless requested");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Dense token stream");
+}
+
+/**
+ * Test: recorded trivia is keyed by the preceding significant token
+ */
+static bool test_trivia_lookup(void) {
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    rift_tokenizer_set_trivia(ctx, true);
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, g_source, strlen(g_source)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 6, "Trivia recording leaves token stream unchanged");
+
+    size_t n = 0;
+    const TriviaEntry* leading = rift_tokenizer_leading_trivia(ctx, &n);
+    TEST_ASSERT(n == 1 && leading[0].offset == 0 && leading[0].length == 2,
+                "Leading indentation recorded");
+
+    /* After ';' (token 3): " ", "// note", "\n  " */
+    const TriviaEntry* after = rift_tokenizer_trivia_after(ctx, 3, &n);
+    TEST_ASSERT(n == 3, "Three trivia entries follow ';'");
+    TEST_ASSERT(after[1].type == TOKEN_COMMENT, "Comment kept as trivia");
+    TEST_ASSERT(after[0].offset == spans[3].offset + spans[3].length,
+                "Trivia starts where the token ends");
+    TEST_ASSERT(after[2].offset + after[2].length == spans[4].offset,
+                "Trivia ends where the next token starts");
+
+    rift_tokenizer_trivia_after(ctx, 0, &n);
+    TEST_ASSERT(n == 1, "Single space after 'a'");
+
+    /* Every byte is covered by exactly one token or trivia entry */
+    size_t trivia_count = 0;
+    const TriviaEntry* trivia = rift_tokenizer_get_trivia(ctx, &trivia_count);
+    size_t covered = 0;
+    for (size_t i = 0; i < count; i++) covered += spans[i].length;
+    for (size_t i = 0; i < trivia_count; i++) covered += trivia[i].length;
+    TEST_ASSERT(covered == strlen(g_source), "Tokens and trivia cover the input");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Trivia lookup");
+}
+
+int main(void) {
+    printf("RIFT-0 Trivia Side Table Tests\n");
+    printf("==============================\n");
+
+    run_test("Dense Token Stream", test_dense_token_stream);
+    run_test("Trivia Lookup", test_trivia_lookup);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
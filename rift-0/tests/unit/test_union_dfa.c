@@ -0,0 +1,300 @@
+/**
+ * =================================================================
+ * test_union_dfa.c - RIFT-0 Incremental Union DFA Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Per-addition re-determinization and local minimization
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/union_dfa.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+#define MAX_PATTERNS    64
+
+typedef struct {
+    const char* text;
+    TokenType type;
+    TokenFlags flags;
+} Pattern;
+
+static Pattern g_added[MAX_PATTERNS];
+static size_t g_added_count = 0;
+
+static unsigned char fold(unsigned char c) {
+    return (c >= 'a' && c <= 'z') ? (unsigned char)(c - 32) : c;
+}
+
+/* Reference matcher: longest added literal, earliest on ties */
+static size_t brute_match(const char* input, TokenType* type) {
+    size_t best = 0;
+    *type = TOKEN_UNKNOWN;
+    for (size_t p = 0; p < g_added_count; p++) {
+        size_t length = strlen(g_added[p].text);
+        if (length <= best || strlen(input) < length) continue;
+
+        bool ignore_case = (g_added[p].flags & TOKEN_FLAG_IGNORECASE) != 0;
+        size_t i = 0;
+        while (i < length) {
+            unsigned char a = (unsigned char)input[i];
+            unsigned char b = (unsigned char)g_added[p].text[i];
+            if (a != b && !(ignore_case && fold(a) == fold(b))) break;
+            i++;
+        }
+        if (i == length) {
+            best = length;
+            *type = g_added[p].type;
+        }
+    }
+    return best;
+}
+
+static bool agrees(const RiftUnionDfa* dfa, const char* input) {
+    TokenType expected_type, actual_type = TOKEN_UNKNOWN;
+    size_t expected = brute_match(input, &expected_type);
+    size_t actual = rift_dfa_table_scan(rift_union_dfa_table(dfa),
+                                        (const unsigned char*)input,
+                                        (const unsigned char*)input + strlen(input),
+                                        &actual_type);
+    return expected == actual && (expected == 0 || expected_type == actual_type);
+}
+
+static bool add(RiftUnionDfa* dfa, const char* text, TokenType type, TokenFlags flags) {
+    g_added[g_added_count++] = (Pattern){ text, type, flags };
+    return rift_union_dfa_add(dfa, text, strlen(text), type, flags);
+}
+
+/**
+ * Test: every prefix of the DFA matches a brute-force union after each addition
+ */
+static bool test_incremental_matches_union(void) {
+    static const Pattern patterns[] = {
+        { "select", TOKEN_KEYWORD, TOKEN_FLAG_IGNORECASE },
+        { "sel", TOKEN_IDENTIFIER, TOKEN_FLAG_NONE },
+        { "SELECTED", TOKEN_LITERAL_STRING, TOKEN_FLAG_NONE },
+        { "from", TOKEN_KEYWORD, TOKEN_FLAG_IGNORECASE },
+        { "fROm", TOKEN_OPERATOR, TOKEN_FLAG_NONE },
+        { "<=>", TOKEN_OPERATOR, TOKEN_FLAG_NONE },
+        { "<=", TOKEN_OPERATOR, TOKEN_FLAG_NONE },
+        { "walking", TOKEN_IDENTIFIER, TOKEN_FLAG_NONE },
+        { "talking", TOKEN_IDENTIFIER, TOKEN_FLAG_NONE },
+        { "select", TOKEN_PUNCTUATION, TOKEN_FLAG_NONE },
+        { "Sel", TOKEN_COMMENT, TOKEN_FLAG_IGNORECASE },
+    };
+    static const char* inputs[] = {
+        "select x", "SELECT", "SeLeCtEd", "SELECTED", "sel", "SEL", "Sel",
+        "from", "FROM", "fROm", "<=>", "<==", "<", "walking", "talkin",
+        "talking!", "balking", "", "s",
+    };
+
+    RiftUnionDfa* dfa = rift_union_dfa_create();
+    TEST_ASSERT(dfa != NULL, "Union DFA created");
+    g_added_count = 0;
+
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+        TEST_ASSERT(add(dfa, patterns[p].text, patterns[p].type, patterns[p].flags),
+                    "Pattern added");
+        for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+            if (!agrees(dfa, inputs[i])) {
+                printf("  after pattern %zu, input \"%s\"\n", p, inputs[i]);
+                TEST_ASSERT(false, "Incremental DFA matches the union");
+            }
+        }
+    }
+
+    TEST_ASSERT(!rift_union_dfa_add(dfa, "", 0, TOKEN_KEYWORD, TOKEN_FLAG_NONE), "Empty rejected");
+    TEST_ASSERT(!rift_union_dfa_add(dfa, "x", 1, TOKEN_UNKNOWN, TOKEN_FLAG_NONE), "Unknown type rejected");
+
+    rift_union_dfa_destroy(dfa);
+    TEST_PASS("Incremental matches union");
+}
+
+/**
+ * Test: additions clone only their own path and stay minimal
+ */
+static bool test_local_work_and_minimality(void) {
+    RiftUnionDfa* dfa = rift_union_dfa_create();
+    TEST_ASSERT(dfa != NULL, "Union DFA created");
+
+    /* Many unrelated words first, so a later addition has a lot to ignore */
+    char words[200][16];
+    for (int i = 0; i < 200; i++) {
+        snprintf(words[i], sizeof(words[i]), "w%03dx", i);
+        TEST_ASSERT(rift_union_dfa_add(dfa, words[i], strlen(words[i]), TOKEN_IDENTIFIER,
+                                       TOKEN_FLAG_NONE), "Word added");
+    }
+
+    RiftUnionDfaStats before = rift_union_dfa_get_stats(dfa);
+    TEST_ASSERT(rift_union_dfa_add(dfa, "w999x", 5, TOKEN_IDENTIFIER, TOKEN_FLAG_NONE),
+                "Late addition");
+    RiftUnionDfaStats after = rift_union_dfa_get_stats(dfa);
+    TEST_ASSERT(after.states_cloned - before.states_cloned == 5, "One clone per literal byte");
+
+    /* Shared suffix "x" + accept: all words end in one state */
+    TEST_ASSERT(after.states_merged > 0, "Clones folded into existing states");
+    TEST_ASSERT(after.live_states < 2 + 1 + 10 + 100 + 10 + 1 + 2,
+                "Common prefixes and suffixes are shared");
+
+    TEST_ASSERT(rift_union_dfa_compact(dfa), "Compaction runs");
+    RiftUnionDfaStats compacted = rift_union_dfa_get_stats(dfa);
+    TEST_ASSERT(compacted.table_states == compacted.live_states, "Compaction removes holes");
+
+    const RiftDfaTable* table = rift_union_dfa_table(dfa);
+    TokenType type = TOKEN_UNKNOWN;
+    const unsigned char* text = (const unsigned char*)"w123x w999x";
+    TEST_ASSERT(rift_dfa_table_scan(table, text, text + 11, &type) == 5 && type == TOKEN_IDENTIFIER,
+                "Compacted table still matches");
+    TEST_ASSERT(rift_dfa_table_scan(table, text + 6, text + 11, &type) == 5, "Late word matches");
+    TEST_ASSERT(rift_dfa_table_scan(table, text, text + 4, &type) == 0, "Prefix alone does not");
+
+    rift_union_dfa_destroy(dfa);
+    TEST_PASS("Local work and minimality");
+}
+
+/**
+ * Test: cached patterns take part in tokenization
+ */
+static bool test_cached_patterns_tokenize(void) {
+    TokenizerContext* ctx = rift_tokenizer_create(16);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_cache_pattern(ctx, "arrow", "=>>", TOKEN_FLAG_NONE), "First pattern");
+    TEST_ASSERT(rift_tokenizer_cache_pattern(ctx, "spread", "...", TOKEN_FLAG_NONE), "Second pattern");
+
+    const char* input = "a =>> ...b";
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, input, strlen(input)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Processed");
+
+    size_t count = 0;
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 5, "a =>> ... b EOF");
+    TEST_ASSERT(spans[1].length == 3 && spans[2].length == 3, "Patterns matched whole");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Cached patterns tokenize");
+}
+
+/**
+ * Test: an equal-length cached pattern beats the base lexer; a longer
+ * base match still wins
+ */
+static bool test_cached_pattern_ties(void) {
+    TokenizerContext* ctx = rift_tokenizer_create(16);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_cache_pattern(ctx, "shift", "<<", TOKEN_FLAG_NONE), "Tie pattern");
+    TEST_ASSERT(rift_tokenizer_cache_pattern(ctx, "less", "<", TOKEN_FLAG_NONE), "Shorter pattern");
+
+    const char* input = "a << b";
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, input, strlen(input)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 4, "a << b EOF");
+    TEST_ASSERT(spans[1].length == 2 && tokens[1].type == TOKEN_IDENTIFIER,
+                "Cached \"<<\" wins the tie with the base OPERATOR rule");
+
+    /* A fresh context has only "<", which the base "<<" outmatches */
+    TokenizerContext* other = rift_tokenizer_create(16);
+    TEST_ASSERT(other != NULL, "Second context created");
+    TEST_ASSERT(rift_tokenizer_cache_pattern(other, "less", "<", TOKEN_FLAG_NONE), "Shorter pattern");
+    TEST_ASSERT(rift_tokenizer_set_input(other, input, strlen(input)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(other), "Processed");
+    tokens = rift_tokenizer_get_tokens(other, &count);
+    spans = rift_tokenizer_get_spans(other, &count);
+    TEST_ASSERT(spans[1].length == 2 && tokens[1].type == TOKEN_OPERATOR, "Longer base match wins");
+
+    rift_tokenizer_destroy(other);
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Cached pattern ties");
+}
+
+/**
+ * Test: patterns are per context, uncapped, and dropped on reset
+ */
+static bool test_pattern_ownership(void) {
+    TokenizerContext* first = rift_tokenizer_create(16);
+    TokenizerContext* second = rift_tokenizer_create(16);
+    TEST_ASSERT(first && second, "Contexts created");
+
+    char name[16];
+    char pattern[16];
+    for (int i = 0; i < 3 * RIFT_TOKENIZER_MAX_PATTERNS; i++) {
+        snprintf(name, sizeof(name), "p%d", i);
+        snprintf(pattern, sizeof(pattern), "@%d@", i);
+        TEST_ASSERT(rift_tokenizer_cache_pattern(first, name, pattern, TOKEN_FLAG_NONE),
+                    "Pattern beyond the initial capacity accepted");
+    }
+    TEST_ASSERT(rift_tokenizer_cache_pattern(second, "arrow", "=>>", TOKEN_FLAG_NONE), "Other context");
+
+    TEST_ASSERT(first->stats.regex_patterns == 3 * RIFT_TOKENIZER_MAX_PATTERNS, "Own count");
+    TEST_ASSERT(second->stats.regex_patterns == 1, "Counts are not shared");
+    TEST_ASSERT(rift_tokenizer_get_cached_pattern(first, "p150") != NULL, "Late pattern found");
+    TEST_ASSERT(rift_tokenizer_get_cached_pattern(second, "p0") == NULL, "Names are not shared");
+
+    /* Pooled contexts are reset on checkin; the next user starts clean */
+    TEST_ASSERT(rift_tokenizer_reset(second), "Reset");
+    TEST_ASSERT(second->pattern_dfa == NULL, "Union DFA dropped");
+    TEST_ASSERT(rift_tokenizer_get_cached_pattern(second, "arrow") == NULL, "Name dropped");
+
+    const char* input = "=>>";
+    TEST_ASSERT(rift_tokenizer_set_input(second, input, strlen(input)), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(second), "Processed");
+    size_t count = 0;
+    const TokenSpan* spans = rift_tokenizer_get_spans(second, &count);
+    TEST_ASSERT(count > 2 && spans[0].length < 3, "Reset pattern no longer matches");
+
+    TEST_ASSERT(rift_tokenizer_cache_pattern(second, "arrow", "=>>", TOKEN_FLAG_NONE), "Re-added");
+    TEST_ASSERT(rift_tokenizer_process(second), "Processed again");
+    spans = rift_tokenizer_get_spans(second, &count);
+    TEST_ASSERT(count == 2 && spans[0].length == 3, "Re-added pattern matches");
+
+    rift_tokenizer_destroy(second);
+    rift_tokenizer_destroy(first);
+    TEST_PASS("Pattern ownership");
+}
+
+int main(void) {
+    printf("RIFT-0 Union DFA Tests\n");
+    printf("======================\n");
+
+    run_test("Incremental Matches Union", test_incremental_matches_union);
+    run_test("Local Work And Minimality", test_local_work_and_minimality);
+    run_test("Cached Patterns Tokenize", test_cached_patterns_tokenize);
+    run_test("Cached Pattern Ties", test_cached_pattern_ties);
+    run_test("Pattern Ownership", test_pattern_ownership);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
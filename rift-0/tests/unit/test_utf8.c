@@ -0,0 +1,174 @@
+/**
+ * =================================================================
+ * test_utf8.c - RIFT-0 UTF-8 Validation Tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Validator edge cases and Unicode identifier scanning
+ * OBINexus Computing Framework - Stage 0 Implementation
+ * =================================================================
+ */
+
+#include "rift-0/core/tokenizer.h"
+#include "rift-0/core/compiled_lexer.h"
+#include "rift-0/core/utf8.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+static int g_tests_run = 0;
+static int g_tests_failed = 0;
+
+static void run_test(const char* name, bool (*test_func)(void)) {
+    printf("--- %s ---\n", name);
+    g_tests_run++;
+    if (!test_func()) {
+        g_tests_failed++;
+    }
+}
+
+/**
+ * Test: well-formed and ill-formed sequences, inside and after ASCII blocks
+ */
+static bool test_utf8_validation(void) {
+    static const struct {
+        const char* bytes;
+        bool valid;
+        size_t offset;
+    } cases[] = {
+        { "plain ascii", true, 0 },
+        { "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", true, 0 },
+        { "\xED\x9F\xBF\xEE\x80\x80\xF4\x8F\xBF\xBF", true, 0 },     /* Around surrogates, max */
+        { "ab\x80", false, 2 },                                       /* Stray continuation */
+        { "\xC0\xAF", false, 0 },                                     /* Overlong '/' */
+        { "x\xE0\x80\x80", false, 1 },                                /* Overlong 3-byte */
+        { "\xED\xA0\x80", false, 0 },                                 /* Surrogate */
+        { "\xF4\x90\x80\x80", false, 0 },                             /* Above U+10FFFF */
+        { "ok\xE2\x82", false, 2 },                                   /* Truncated */
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t offset = SIZE_MAX;
+        bool valid = rift_utf8_validate(cases[i].bytes, strlen(cases[i].bytes), &offset);
+        TEST_ASSERT(valid == cases[i].valid, "Validity matches");
+        TEST_ASSERT(valid || offset == cases[i].offset, "Error offset matches");
+    }
+
+    /* Errors past whole ASCII blocks and straddling a block edge */
+    char buffer[300];
+    memset(buffer, 'a', sizeof(buffer));
+    TEST_ASSERT(rift_utf8_validate(buffer, sizeof(buffer), NULL), "ASCII buffer valid");
+    memcpy(buffer + 62, "\xE2\x82\xAC", 3);
+    TEST_ASSERT(rift_utf8_validate(buffer, sizeof(buffer), NULL), "Sequence across block edge");
+    buffer[64] = 'a';
+    size_t offset = 0;
+    TEST_ASSERT(!rift_utf8_validate(buffer, sizeof(buffer), &offset) && offset == 62,
+                "Broken sequence across block edge");
+    memset(buffer, 'a', sizeof(buffer));
+    buffer[sizeof(buffer) - 1] = (char)0xC3;
+    TEST_ASSERT(!rift_utf8_validate(buffer, sizeof(buffer), &offset) &&
+                offset == sizeof(buffer) - 1, "Truncated at end of input");
+
+    TEST_PASS("UTF-8 validation");
+}
+
+/**
+ * Test: identifiers accept XID code points; invalid input is rejected
+ */
+static bool test_unicode_identifiers(void) {
+    /* café, naïve, 日本, _x1, 𝑥 (U+1D465); '€' is not XID_Start */
+    static const char source[] =
+        "caf\xC3\xA9 = na\xC3\xAFve + \xE6\x97\xA5\xE6\x9C\xAC * _x1 - \xF0\x9D\x91\xA5;";
+
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, source, sizeof(source) - 1), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 11, "Five identifiers, four operators, ';', EOF");
+
+    const size_t identifiers[] = { 0, 2, 4, 6, 8 };
+    const uint32_t lengths[] = { 5, 6, 6, 3, 4 };
+    for (size_t i = 0; i < sizeof(identifiers) / sizeof(identifiers[0]); i++) {
+        TEST_ASSERT(tokens[identifiers[i]].type == TOKEN_IDENTIFIER, "Identifier token");
+        TEST_ASSERT(spans[identifiers[i]].length == lengths[i], "Whole code points consumed");
+    }
+
+    static const char euro[] = "\xE2\x82\xAC";
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, euro, sizeof(euro) - 1), "Symbol input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Symbol input processed");
+    tokens = rift_tokenizer_get_tokens(ctx, &count);
+    TEST_ASSERT(tokens[0].type != TOKEN_IDENTIFIER, "Currency sign is not an identifier");
+
+    static const char broken[] = "ok = \xC3(";
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, broken, sizeof(broken) - 1), "Broken input set");
+    TEST_ASSERT(!rift_tokenizer_process(ctx), "Ill-formed UTF-8 rejected");
+    TEST_ASSERT(rift_tokenizer_has_error(ctx) &&
+                strcmp(rift_tokenizer_get_error(ctx), "Invalid UTF-8 at byte 5") == 0,
+                "Error names the offset");
+
+    rift_tokenizer_destroy(ctx);
+    TEST_PASS("Unicode identifiers");
+}
+
+/**
+ * Test: an unmatched code point is one unknown token, not one per byte
+ */
+static bool test_unknown_code_points(void) {
+    /* a €😀 b: U+20AC (3 bytes) and U+1F600 (4 bytes) match no rule */
+    static const char source[] = "a \xE2\x82\xAC\xF0\x9F\x98\x80 b";
+
+    TokenizerContext* ctx = rift_tokenizer_create(0);
+    TEST_ASSERT(ctx != NULL, "Context created");
+    TEST_ASSERT(rift_tokenizer_set_input(ctx, source, sizeof(source) - 1), "Input set");
+    TEST_ASSERT(rift_tokenizer_process(ctx), "Input processed");
+
+    size_t count = 0;
+    TokenTriplet* tokens = rift_tokenizer_get_tokens(ctx, &count);
+    const TokenSpan* spans = rift_tokenizer_get_spans(ctx, &count);
+    TEST_ASSERT(count == 5, "a, two unknown code points, b, EOF");
+    TEST_ASSERT(tokens[1].type == TOKEN_UNKNOWN && spans[1].offset == 2 && spans[1].length == 3,
+                "Euro sign is one unknown token");
+    TEST_ASSERT(tokens[2].type == TOKEN_UNKNOWN && spans[2].offset == 5 && spans[2].length == 4,
+                "Emoji is one unknown token");
+    TEST_ASSERT(tokens[3].type == TOKEN_IDENTIFIER && spans[3].offset == 10, "Scan resumes after it");
+    rift_tokenizer_destroy(ctx);
+
+    /* Unvalidated callers still advance one byte over malformed input */
+    const unsigned char stray[] = { 0x80, 'x' };
+    const unsigned char truncated[] = { 0xE2, 0x82 };
+    TEST_ASSERT(rift_utf8_sequence_length(stray, stray + 2) == 1, "Stray continuation byte");
+    TEST_ASSERT(rift_utf8_sequence_length(truncated, truncated + 2) == 1, "Truncated sequence");
+    TEST_PASS("Unknown code points");
+}
+
+int main(void) {
+    printf("RIFT-0 UTF-8 Validation Tests\n");
+    printf("=============================\n");
+
+    run_test("UTF-8 Validation", test_utf8_validation);
+    run_test("Unicode Identifiers", test_unicode_identifiers);
+    run_test("Unknown Code Points", test_unknown_code_points);
+
+    printf("\n%d/%d tests passed\n", g_tests_run - g_tests_failed, g_tests_run);
+    return g_tests_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
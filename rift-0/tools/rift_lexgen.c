@@ -0,0 +1,1531 @@
+/*
+ * =================================================================
+ * rift_lexgen.c - RIFT-0 Scanner Generator (Build-Time Tool)
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Rule set -> direct-coded C scanner
+ * OBINexus Computing Framework - Stage 0 Implementation
+ *
+ * R.COMPILE(RuleSet) -> NFA -> DFA -> minimal DFA -> switch/goto C
+ * R.FLAGS(deterministic, build_time, longest_match)
+ *
+ * Rule file format (one rule per line, '#' starts a comment):
+ *
+ *     NAME   TOKEN_TYPE_SYMBOL   pattern
+ *
+ * Patterns support literals, escapes (\n \t \r \f \v \0 \xHH \d \w \s),
+ * '.', character classes ([a-z], [^"\\]), grouping, '|', '*', '+' and
+ * '?'. \p{XID_Start} and \p{XID_Continue} match one UTF-8 encoded code
+ * point of that Unicode property; they are lowered to byte transitions
+ * here, so the scanner never decodes code points. The generated scanner
+ * performs longest-match; on equal length the rule listed first wins.
+ *
+ * Usage: rift_lexgen <rules> <output.c> [--prefix NAME] [--include HDR]
+ *                    [--dfa-profile FILE] [--instrument]
+ *
+ * --instrument emits a twin that counts state entries and transitions
+ * (see rift-0/core/dfa_profile.h); --dfa-profile reads those counts back
+ * and lays states out hottest first, unrolling hot self-loops further
+ * and leaving cold ones as plain switch transitions.
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#include "rift_unicode_tables.h"
+
+#define LEXGEN_MAX_RULES        128
+#define LEXGEN_MAX_LINE         1024
+#define LEXGEN_MAX_NAME         64
+#define LEXGEN_UNROLL_FACTOR    4
+#define LEXGEN_HOT_UNROLL       8
+#define LEXGEN_HOT_LOOP_SHARE   100     /* Hot loop: >= 1/100 of all visits */
+#define LEXGEN_MAX_STATE_ID     65535   /* Instrumented edges use uint16_t */
+#define LEXGEN_NO_RULE          (-1)
+#define LEXGEN_DEAD             (-1)
+
+/* =================================================================
+ * BYTE SETS
+ * =================================================================
+ */
+
+typedef struct {
+    uint8_t bits[32];
+} ByteSet;
+
+static void byteset_add(ByteSet* set, unsigned c) {
+    set->bits[c >> 3] |= (uint8_t)(1u << (c & 7));
+}
+
+static void byteset_add_range(ByteSet* set, unsigned lo, unsigned hi) {
+    for (unsigned c = lo; c <= hi; c++) {
+        byteset_add(set, c);
+    }
+}
+
+static bool byteset_has(const ByteSet* set, unsigned c) {
+    return (set->bits[c >> 3] >> (c & 7)) & 1u;
+}
+
+static void byteset_invert(ByteSet* set) {
+    for (size_t i = 0; i < sizeof(set->bits); i++) {
+        set->bits[i] = (uint8_t)~set->bits[i];
+    }
+}
+
+/* =================================================================
+ * NFA CONSTRUCTION (THOMPSON)
+ * =================================================================
+ */
+
+typedef struct {
+    int eps[2];                 /* Epsilon successors (-1 if unused) */
+    int on_set;                 /* Successor on byte set (-1 if none) */
+    ByteSet set;                /* Byte set labelling on_set edge */
+    int accept_rule;            /* Rule index if accepting */
+} NfaState;
+
+typedef struct {
+    NfaState* states;
+    int count;
+    int capacity;
+} Nfa;
+
+typedef struct {
+    int start;
+    int out;                    /* Dangling end state (no outgoing edges) */
+} Fragment;
+
+typedef struct {
+    const char* src;
+    size_t pos;
+    const char* rule_name;
+    Nfa* nfa;
+    bool failed;
+} RegexParser;
+
+static int nfa_new_state(Nfa* nfa) {
+    if (nfa->count == nfa->capacity) {
+        int new_capacity = nfa->capacity ? nfa->capacity * 2 : 256;
+        NfaState* grown = realloc(nfa->states, (size_t)new_capacity * sizeof(NfaState));
+        if (!grown) {
+            fprintf(stderr, "rift_lexgen: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        nfa->states = grown;
+        nfa->capacity = new_capacity;
+    }
+
+    NfaState* state = &nfa->states[nfa->count];
+    memset(state, 0, sizeof(*state));
+    state->eps[0] = -1;
+    state->eps[1] = -1;
+    state->on_set = -1;
+    state->accept_rule = LEXGEN_NO_RULE;
+    return nfa->count++;
+}
+
+static void nfa_add_eps(Nfa* nfa, int from, int to) {
+    NfaState* state = &nfa->states[from];
+    if (state->eps[0] < 0) {
+        state->eps[0] = to;
+    } else {
+        state->eps[1] = to;
+    }
+}
+
+static Fragment fragment_from_set(Nfa* nfa, const ByteSet* set) {
+    Fragment frag;
+    frag.start = nfa_new_state(nfa);
+    frag.out = nfa_new_state(nfa);
+    nfa->states[frag.start].set = *set;
+    nfa->states[frag.start].on_set = frag.out;
+    return frag;
+}
+
+static Fragment fragment_empty(Nfa* nfa) {
+    Fragment frag;
+    frag.start = nfa_new_state(nfa);
+    frag.out = nfa_new_state(nfa);
+    nfa_add_eps(nfa, frag.start, frag.out);
+    return frag;
+}
+
+static void parser_error(RegexParser* parser, const char* message) {
+    if (!parser->failed) {
+        fprintf(stderr, "rift_lexgen: rule %s: %s at offset %zu\n",
+                parser->rule_name, message, parser->pos);
+    }
+    parser->failed = true;
+}
+
+/* =================================================================
+ * UNICODE CLASSES (UTF-8 LOWERING)
+ * Code point ranges are split into runs that share a UTF-8 byte
+ * shape, inserted into a byte trie, and suffix-shared before being
+ * emitted as NFA states. Every trie edge is a byte set, so the DFA
+ * built from it needs no decoding step at scan time.
+ * =================================================================
+ */
+
+#define UTF8_TRIE_ACCEPT        1       /* Shared node after the last byte */
+#define UTF8_SPLIT_STACK        64
+
+typedef struct {
+    int next[256];              /* Child node, or LEXGEN_DEAD */
+    int canon;                  /* Representative after suffix sharing */
+} Utf8Node;
+
+typedef struct {
+    Utf8Node* nodes;
+    int count;
+    int capacity;
+} Utf8Trie;
+
+static int utf8_trie_new_node(Utf8Trie* trie) {
+    if (trie->count == trie->capacity) {
+        int new_capacity = trie->capacity ? trie->capacity * 2 : 256;
+        Utf8Node* grown = realloc(trie->nodes, (size_t)new_capacity * sizeof(Utf8Node));
+        if (!grown) {
+            fprintf(stderr, "rift_lexgen: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        trie->nodes = grown;
+        trie->capacity = new_capacity;
+    }
+
+    Utf8Node* node = &trie->nodes[trie->count];
+    for (int c = 0; c < 256; c++) node->next[c] = LEXGEN_DEAD;
+    node->canon = trie->count;
+    return trie->count++;
+}
+
+static int utf8_encode(uint32_t cp, uint8_t* out) {
+    if (cp < 0x80) {
+        out[0] = (uint8_t)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (uint8_t)(0xC0 | (cp >> 6));
+        out[1] = (uint8_t)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (uint8_t)(0xE0 | (cp >> 12));
+        out[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (uint8_t)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (uint8_t)(0xF0 | (cp >> 18));
+    out[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (uint8_t)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+/* Insert the byte-range sequence lo[i]..hi[i] below node */
+static void utf8_trie_insert(Utf8Trie* trie, int node, const uint8_t* lo,
+                             const uint8_t* hi, int length) {
+    for (unsigned b = lo[0]; b <= hi[0]; b++) {
+        if (length == 1) {
+            trie->nodes[node].next[b] = UTF8_TRIE_ACCEPT;
+            continue;
+        }
+        int child = trie->nodes[node].next[b];
+        if (child == LEXGEN_DEAD) {
+            child = utf8_trie_new_node(trie);
+            trie->nodes[node].next[b] = child;
+        }
+        utf8_trie_insert(trie, child, lo + 1, hi + 1, length - 1);
+    }
+}
+
+/*
+ * Split [first, last] into ranges whose endpoints encode to the same
+ * length and differ only in trailing bytes that span their full
+ * 0x80-0xBF range; each such range is one byte-range sequence.
+ */
+static void utf8_trie_add_range(Utf8Trie* trie, uint32_t first, uint32_t last) {
+    static const uint32_t length_limits[] = { 0x7F, 0x7FF, 0xFFFF };
+    uint32_t stack[UTF8_SPLIT_STACK][2];
+    int top = 0;
+
+    stack[top][0] = first;
+    stack[top][1] = last;
+    top++;
+
+    while (top > 0) {
+        top--;
+        uint32_t s = stack[top][0];
+        uint32_t e = stack[top][1];
+        bool split = false;
+
+        if (s > e) continue;
+
+        /* Surrogates have no UTF-8 encoding */
+        if (s <= 0xDFFF && e >= 0xD800) {
+            if (e > 0xDFFF) {
+                stack[top][0] = 0xE000;
+                stack[top][1] = e;
+                top++;
+            }
+            if (s < 0xD800) {
+                stack[top][0] = s;
+                stack[top][1] = 0xD7FF;
+                top++;
+            }
+            continue;
+        }
+
+        for (size_t i = 0; i < sizeof(length_limits) / sizeof(length_limits[0]) && !split; i++) {
+            uint32_t limit = length_limits[i];
+            if (s <= limit && limit < e) {
+                stack[top][0] = limit + 1;
+                stack[top][1] = e;
+                stack[top + 1][0] = s;
+                stack[top + 1][1] = limit;
+                top += 2;
+                split = true;
+            }
+        }
+
+        for (int i = 1; i < 4 && !split && e > 0x7F; i++) {
+            uint32_t mask = (1u << (6 * i)) - 1;
+            if ((s & ~mask) == (e & ~mask)) continue;
+            if ((s & mask) != 0) {
+                stack[top][0] = (s | mask) + 1;
+                stack[top][1] = e;
+                stack[top + 1][0] = s;
+                stack[top + 1][1] = s | mask;
+                top += 2;
+                split = true;
+            } else if ((e & mask) != mask) {
+                stack[top][0] = e & ~mask;
+                stack[top][1] = e;
+                stack[top + 1][0] = s;
+                stack[top + 1][1] = (e & ~mask) - 1;
+                top += 2;
+                split = true;
+            }
+        }
+        if (split) continue;
+
+        uint8_t lo[4], hi[4];
+        int length = utf8_encode(s, lo);
+        utf8_encode(e, hi);
+        utf8_trie_insert(trie, 0, lo, hi, length);
+    }
+}
+
+/*
+ * Merge nodes with identical transitions. Children are always created
+ * after their parent, so a reverse index walk visits them first.
+ */
+static void utf8_trie_share_suffixes(Utf8Trie* trie) {
+    int size = 1;
+    while (size < trie->count * 2) size <<= 1;
+    int* slots = malloc((size_t)size * sizeof(int));
+    if (!slots) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < size; i++) slots[i] = -1;
+
+    for (int n = trie->count - 1; n >= 0; n--) {
+        Utf8Node* node = &trie->nodes[n];
+        uint32_t hash = 2166136261u;
+        for (int c = 0; c < 256; c++) {
+            int child = node->next[c];
+            if (child != LEXGEN_DEAD) {
+                child = trie->nodes[child].canon;
+                node->next[c] = child;
+            }
+            hash = (hash ^ (uint32_t)child) * 16777619u;
+        }
+        /* The accept node is its own class */
+        if (n == UTF8_TRIE_ACCEPT) continue;
+
+        int slot = (int)(hash & (uint32_t)(size - 1));
+        while (slots[slot] >= 0) {
+            const Utf8Node* other = &trie->nodes[slots[slot]];
+            if (memcmp(other->next, node->next, sizeof(node->next)) == 0) {
+                node->canon = slots[slot];
+                break;
+            }
+            slot = (slot + 1) & (size - 1);
+        }
+        if (slots[slot] < 0) {
+            slots[slot] = n;
+        }
+    }
+
+    free(slots);
+}
+
+/* Build an NFA fragment for the trie: one entry state per shared node */
+static Fragment utf8_trie_fragment(Nfa* nfa, const Utf8Trie* trie) {
+    int* entry = malloc((size_t)trie->count * sizeof(int));
+    if (!entry) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int n = 0; n < trie->count; n++) {
+        entry[n] = trie->nodes[n].canon == n ? nfa_new_state(nfa) : -1;
+    }
+
+    for (int n = 0; n < trie->count; n++) {
+        const Utf8Node* node = &trie->nodes[n];
+        if (node->canon != n || n == UTF8_TRIE_ACCEPT) continue;
+
+        /* One byte-set edge per distinct child, fanned out by epsilons */
+        bool grouped[256] = { false };
+        int from = entry[n];
+        for (int c = 0; c < 256; c++) {
+            int child = node->next[c];
+            if (child == LEXGEN_DEAD || grouped[c]) continue;
+
+            ByteSet set;
+            memset(&set, 0, sizeof(set));
+            bool more = false;
+            for (int d = c; d < 256; d++) {
+                if (node->next[d] == child) {
+                    byteset_add(&set, (unsigned)d);
+                    grouped[d] = true;
+                } else if (node->next[d] != LEXGEN_DEAD && !grouped[d]) {
+                    more = true;
+                }
+            }
+
+            int edge = nfa_new_state(nfa);
+            nfa->states[edge].set = set;
+            nfa->states[edge].on_set = entry[child];
+            nfa_add_eps(nfa, from, edge);
+            if (more) {
+                int fork = nfa_new_state(nfa);
+                nfa_add_eps(nfa, from, fork);
+                from = fork;
+            }
+        }
+    }
+
+    Fragment frag = { entry[0], entry[UTF8_TRIE_ACCEPT] };
+    free(entry);
+    return frag;
+}
+
+/* Parse the name after '\p' and lower that property to a fragment */
+static Fragment parse_unicode_class(RegexParser* parser) {
+    static const struct {
+        const char* name;
+        const uint32_t (*ranges)[2];
+        size_t count;
+    } properties[] = {
+        { "XID_Start", rift_xid_start_ranges,
+          sizeof(rift_xid_start_ranges) / sizeof(rift_xid_start_ranges[0]) },
+        { "XID_Continue", rift_xid_continue_ranges,
+          sizeof(rift_xid_continue_ranges) / sizeof(rift_xid_continue_ranges[0]) },
+    };
+
+    const char* name = parser->src + parser->pos;
+    const char* close = name[0] == '{' ? strchr(name, '}') : NULL;
+    if (!close) {
+        parser_error(parser, "expected \\p{Property}");
+        return fragment_empty(parser->nfa);
+    }
+    name++;
+    size_t name_length = (size_t)(close - name);
+    parser->pos += name_length + 2;
+
+    for (size_t i = 0; i < sizeof(properties) / sizeof(properties[0]); i++) {
+        if (strlen(properties[i].name) != name_length ||
+            strncmp(properties[i].name, name, name_length) != 0) {
+            continue;
+        }
+
+        Utf8Trie trie = { NULL, 0, 0 };
+        utf8_trie_new_node(&trie);      /* Root */
+        utf8_trie_new_node(&trie);      /* UTF8_TRIE_ACCEPT */
+        for (size_t r = 0; r < properties[i].count; r++) {
+            utf8_trie_add_range(&trie, properties[i].ranges[r][0], properties[i].ranges[r][1]);
+        }
+        utf8_trie_share_suffixes(&trie);
+
+        Fragment frag = utf8_trie_fragment(parser->nfa, &trie);
+        free(trie.nodes);
+        return frag;
+    }
+
+    parser_error(parser, "unknown Unicode property");
+    return fragment_empty(parser->nfa);
+}
+
+static int parse_hex_digit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/* Parse an escape after '\'; adds the matched bytes to set */
+static void parse_escape(RegexParser* parser, ByteSet* set) {
+    char c = parser->src[parser->pos];
+    if (c == '\0') {
+        parser_error(parser, "dangling escape");
+        return;
+    }
+    parser->pos++;
+
+    switch (c) {
+        case 'n': byteset_add(set, '\n'); break;
+        case 't': byteset_add(set, '\t'); break;
+        case 'r': byteset_add(set, '\r'); break;
+        case 'f': byteset_add(set, '\f'); break;
+        case 'v': byteset_add(set, '\v'); break;
+        case '0': byteset_add(set, 0); break;
+        case 'd': byteset_add_range(set, '0', '9'); break;
+        case 's':
+            byteset_add(set, ' ');
+            byteset_add_range(set, '\t', '\r');
+            break;
+        case 'w':
+            byteset_add_range(set, 'a', 'z');
+            byteset_add_range(set, 'A', 'Z');
+            byteset_add_range(set, '0', '9');
+            byteset_add(set, '_');
+            break;
+        case 'x': {
+            int hi = parse_hex_digit(parser->src[parser->pos]);
+            int lo = hi >= 0 ? parse_hex_digit(parser->src[parser->pos + 1]) : -1;
+            if (hi < 0 || lo < 0) {
+                parser_error(parser, "malformed \\x escape");
+                return;
+            }
+            parser->pos += 2;
+            byteset_add(set, (unsigned)(hi * 16 + lo));
+            break;
+        }
+        default:
+            byteset_add(set, (unsigned char)c);
+            break;
+    }
+}
+
+static bool parse_class_char(RegexParser* parser, unsigned* out) {
+    char c = parser->src[parser->pos];
+    if (c == '\0') {
+        parser_error(parser, "unterminated character class");
+        return false;
+    }
+    if (c == '\\') {
+        ByteSet single;
+        memset(&single, 0, sizeof(single));
+        parser->pos++;
+        parse_escape(parser, &single);
+        for (unsigned b = 0; b < 256; b++) {
+            if (byteset_has(&single, b)) {
+                *out = b;
+                return true;
+            }
+        }
+        return false;
+    }
+    parser->pos++;
+    *out = (unsigned char)c;
+    return true;
+}
+
+static void parse_class(RegexParser* parser, ByteSet* set) {
+    bool negate = false;
+    if (parser->src[parser->pos] == '^') {
+        negate = true;
+        parser->pos++;
+    }
+
+    bool first = true;
+    while (!parser->failed) {
+        char c = parser->src[parser->pos];
+        if (c == '\0') {
+            parser_error(parser, "unterminated character class");
+            return;
+        }
+        if (c == ']' && !first) {
+            parser->pos++;
+            break;
+        }
+        first = false;
+
+        if (c == '\\' && parser->src[parser->pos + 1] == 'p') {
+            parser_error(parser, "\\p{} is not supported inside a class; use alternation");
+            return;
+        }
+
+        /* Shorthand classes expand in place */
+        if (c == '\\' && strchr("dsw", parser->src[parser->pos + 1])) {
+            parser->pos++;
+            parse_escape(parser, set);
+            continue;
+        }
+
+        unsigned lo;
+        if (!parse_class_char(parser, &lo)) return;
+
+        if (parser->src[parser->pos] == '-' &&
+            parser->src[parser->pos + 1] != ']' &&
+            parser->src[parser->pos + 1] != '\0') {
+            parser->pos++;
+            unsigned hi;
+            if (!parse_class_char(parser, &hi)) return;
+            if (hi < lo) {
+                parser_error(parser, "inverted class range");
+                return;
+            }
+            byteset_add_range(set, lo, hi);
+        } else {
+            byteset_add(set, lo);
+        }
+    }
+
+    if (negate) {
+        byteset_invert(set);
+    }
+}
+
+static Fragment parse_alternation(RegexParser* parser);
+
+static Fragment parse_atom(RegexParser* parser) {
+    Nfa* nfa = parser->nfa;
+    char c = parser->src[parser->pos];
+    ByteSet set;
+    memset(&set, 0, sizeof(set));
+
+    switch (c) {
+        case '(': {
+            parser->pos++;
+            Fragment inner = parse_alternation(parser);
+            if (parser->src[parser->pos] != ')') {
+                parser_error(parser, "missing ')'");
+                return inner;
+            }
+            parser->pos++;
+            return inner;
+        }
+        case '[':
+            parser->pos++;
+            parse_class(parser, &set);
+            return fragment_from_set(nfa, &set);
+        case '.':
+            parser->pos++;
+            byteset_add_range(&set, 0, 255);
+            set.bits['\n' >> 3] &= (uint8_t)~(1u << ('\n' & 7));
+            return fragment_from_set(nfa, &set);
+        case '\\':
+            parser->pos++;
+            if (parser->src[parser->pos] == 'p') {
+                parser->pos++;
+                return parse_unicode_class(parser);
+            }
+            parse_escape(parser, &set);
+            return fragment_from_set(nfa, &set);
+        default:
+            parser->pos++;
+            byteset_add(&set, (unsigned char)c);
+            return fragment_from_set(nfa, &set);
+    }
+}
+
+static Fragment parse_repeat(RegexParser* parser) {
+    Nfa* nfa = parser->nfa;
+    Fragment frag = parse_atom(parser);
+
+    for (;;) {
+        char op = parser->src[parser->pos];
+        if (op != '*' && op != '+' && op != '?') break;
+        parser->pos++;
+
+        int start = nfa_new_state(nfa);
+        int out = nfa_new_state(nfa);
+        nfa_add_eps(nfa, start, frag.start);
+        nfa_add_eps(nfa, frag.out, out);
+
+        if (op == '*' || op == '+') {
+            nfa_add_eps(nfa, frag.out, frag.start);
+        }
+        if (op == '*' || op == '?') {
+            nfa_add_eps(nfa, start, out);
+        }
+
+        frag.start = start;
+        frag.out = out;
+    }
+
+    return frag;
+}
+
+static Fragment parse_concat(RegexParser* parser) {
+    Nfa* nfa = parser->nfa;
+    Fragment result = { -1, -1 };
+
+    while (!parser->failed) {
+        char c = parser->src[parser->pos];
+        if (c == '\0' || c == '|' || c == ')') break;
+
+        Fragment next = parse_repeat(parser);
+        if (result.start < 0) {
+            result = next;
+        } else {
+            nfa_add_eps(nfa, result.out, next.start);
+            result.out = next.out;
+        }
+    }
+
+    return result.start < 0 ? fragment_empty(nfa) : result;
+}
+
+static Fragment parse_alternation(RegexParser* parser) {
+    Nfa* nfa = parser->nfa;
+    Fragment left = parse_concat(parser);
+
+    while (!parser->failed && parser->src[parser->pos] == '|') {
+        parser->pos++;
+        Fragment right = parse_concat(parser);
+
+        int start = nfa_new_state(nfa);
+        int out = nfa_new_state(nfa);
+        nfa_add_eps(nfa, start, left.start);
+        nfa_add_eps(nfa, start, right.start);
+        nfa_add_eps(nfa, left.out, out);
+        nfa_add_eps(nfa, right.out, out);
+
+        left.start = start;
+        left.out = out;
+    }
+
+    return left;
+}
+
+/* =================================================================
+ * RULE SET LOADING
+ * =================================================================
+ */
+
+typedef struct {
+    char name[LEXGEN_MAX_NAME];
+    char token_type[LEXGEN_MAX_NAME];
+    int nfa_start;
+} LexRule;
+
+typedef struct {
+    LexRule rules[LEXGEN_MAX_RULES];
+    int rule_count;
+    Nfa nfa;
+} RuleSet;
+
+static char* trim(char* s) {
+    while (isspace((unsigned char)*s)) s++;
+    size_t len = strlen(s);
+    while (len > 0 && isspace((unsigned char)s[len - 1])) {
+        s[--len] = '\0';
+    }
+    return s;
+}
+
+static bool read_field(char** cursor, char* out, size_t out_size) {
+    char* s = *cursor;
+    while (isspace((unsigned char)*s)) s++;
+    size_t len = 0;
+    while (s[len] && !isspace((unsigned char)s[len])) len++;
+    if (len == 0 || len >= out_size) return false;
+    memcpy(out, s, len);
+    out[len] = '\0';
+    *cursor = s + len;
+    return true;
+}
+
+static bool load_rules(const char* path, RuleSet* rules) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "rift_lexgen: cannot open rule file %s\n", path);
+        return false;
+    }
+
+    char line[LEXGEN_MAX_LINE];
+    int line_number = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), file)) {
+        line_number++;
+        char* text = trim(line);
+        if (*text == '\0' || *text == '#') continue;
+
+        if (rules->rule_count == LEXGEN_MAX_RULES) {
+            fprintf(stderr, "rift_lexgen: %s:%d: too many rules\n", path, line_number);
+            ok = false;
+            break;
+        }
+
+        LexRule* rule = &rules->rules[rules->rule_count];
+        char* cursor = text;
+        if (!read_field(&cursor, rule->name, sizeof(rule->name)) ||
+            !read_field(&cursor, rule->token_type, sizeof(rule->token_type))) {
+            fprintf(stderr, "rift_lexgen: %s:%d: expected NAME TYPE PATTERN\n",
+                    path, line_number);
+            ok = false;
+            break;
+        }
+
+        char* pattern = trim(cursor);
+        if (*pattern == '\0') {
+            fprintf(stderr, "rift_lexgen: %s:%d: empty pattern\n", path, line_number);
+            ok = false;
+            break;
+        }
+
+        RegexParser parser = { pattern, 0, rule->name, &rules->nfa, false };
+        Fragment frag = parse_alternation(&parser);
+        if (!parser.failed && pattern[parser.pos] != '\0') {
+            parser_error(&parser, "unexpected ')'");
+        }
+        if (parser.failed) {
+            ok = false;
+            break;
+        }
+
+        rules->nfa.states[frag.out].accept_rule = rules->rule_count;
+        rule->nfa_start = frag.start;
+        rules->rule_count++;
+    }
+
+    fclose(file);
+
+    if (ok && rules->rule_count == 0) {
+        fprintf(stderr, "rift_lexgen: %s: no rules defined\n", path);
+        ok = false;
+    }
+    return ok;
+}
+
+/* =================================================================
+ * SUBSET CONSTRUCTION
+ * =================================================================
+ */
+
+typedef struct {
+    int next[256];              /* Successor state or LEXGEN_DEAD */
+    int accept_rule;            /* Winning rule or LEXGEN_NO_RULE */
+} DfaState;
+
+typedef struct {
+    DfaState* states;
+    int count;
+    int capacity;
+} Dfa;
+
+typedef struct {
+    uint64_t* words;            /* Flattened NFA-state bitsets */
+    int words_per_set;
+    int count;
+    int capacity;
+} SetTable;
+
+static int dfa_new_state(Dfa* dfa) {
+    if (dfa->count == dfa->capacity) {
+        int new_capacity = dfa->capacity ? dfa->capacity * 2 : 64;
+        DfaState* grown = realloc(dfa->states, (size_t)new_capacity * sizeof(DfaState));
+        if (!grown) {
+            fprintf(stderr, "rift_lexgen: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        dfa->states = grown;
+        dfa->capacity = new_capacity;
+    }
+
+    DfaState* state = &dfa->states[dfa->count];
+    for (int c = 0; c < 256; c++) state->next[c] = LEXGEN_DEAD;
+    state->accept_rule = LEXGEN_NO_RULE;
+    return dfa->count++;
+}
+
+static void closure_visit(const Nfa* nfa, uint64_t* set, int state, int* stack) {
+    int top = 0;
+    stack[top++] = state;
+    while (top > 0) {
+        int s = stack[--top];
+        uint64_t bit = 1ull << (s & 63);
+        if (set[s >> 6] & bit) continue;
+        set[s >> 6] |= bit;
+        for (int e = 0; e < 2; e++) {
+            int t = nfa->states[s].eps[e];
+            if (t >= 0 && !(set[t >> 6] & (1ull << (t & 63)))) {
+                stack[top++] = t;
+            }
+        }
+    }
+}
+
+static int set_table_find_or_add(SetTable* table, const uint64_t* set, bool* added) {
+    size_t bytes = (size_t)table->words_per_set * sizeof(uint64_t);
+    for (int i = 0; i < table->count; i++) {
+        if (memcmp(table->words + (size_t)i * table->words_per_set, set, bytes) == 0) {
+            *added = false;
+            return i;
+        }
+    }
+
+    if (table->count == table->capacity) {
+        int new_capacity = table->capacity ? table->capacity * 2 : 64;
+        uint64_t* grown = realloc(table->words, (size_t)new_capacity * bytes);
+        if (!grown) {
+            fprintf(stderr, "rift_lexgen: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        table->words = grown;
+        table->capacity = new_capacity;
+    }
+
+    memcpy(table->words + (size_t)table->count * table->words_per_set, set, bytes);
+    *added = true;
+    return table->count++;
+}
+
+static bool set_is_empty(const uint64_t* set, int words) {
+    for (int i = 0; i < words; i++) {
+        if (set[i]) return false;
+    }
+    return true;
+}
+
+static void build_dfa(const RuleSet* rules, Dfa* dfa) {
+    const Nfa* nfa = &rules->nfa;
+    SetTable table = { NULL, (nfa->count + 63) / 64, 0, 0 };
+    size_t bytes = (size_t)table.words_per_set * sizeof(uint64_t);
+    uint64_t* scratch = calloc(1, bytes);
+    uint64_t* moved = calloc(1, bytes);
+    int* stack = malloc((size_t)nfa->count * 2 * sizeof(int) + sizeof(int));
+    if (!scratch || !moved || !stack) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Start state: union of every rule's start closure */
+    for (int r = 0; r < rules->rule_count; r++) {
+        closure_visit(nfa, scratch, rules->rules[r].nfa_start, stack);
+    }
+    bool added;
+    set_table_find_or_add(&table, scratch, &added);
+    dfa_new_state(dfa);
+
+    for (int d = 0; d < dfa->count; d++) {
+        const uint64_t* current = table.words + (size_t)d * table.words_per_set;
+
+        for (int s = 0; s < nfa->count; s++) {
+            if (!(current[s >> 6] & (1ull << (s & 63)))) continue;
+            int rule = nfa->states[s].accept_rule;
+            if (rule != LEXGEN_NO_RULE &&
+                (dfa->states[d].accept_rule == LEXGEN_NO_RULE ||
+                 rule < dfa->states[d].accept_rule)) {
+                dfa->states[d].accept_rule = rule;
+            }
+        }
+
+        for (int c = 0; c < 256; c++) {
+            memset(moved, 0, bytes);
+            current = table.words + (size_t)d * table.words_per_set;
+            for (int s = 0; s < nfa->count; s++) {
+                if (!(current[s >> 6] & (1ull << (s & 63)))) continue;
+                const NfaState* ns = &nfa->states[s];
+                if (ns->on_set >= 0 && byteset_has(&ns->set, (unsigned)c)) {
+                    closure_visit(nfa, moved, ns->on_set, stack);
+                }
+            }
+            if (set_is_empty(moved, table.words_per_set)) continue;
+
+            int target = set_table_find_or_add(&table, moved, &added);
+            if (added) {
+                dfa_new_state(dfa);
+            }
+            dfa->states[d].next[c] = target;
+        }
+    }
+
+    free(table.words);
+    free(scratch);
+    free(moved);
+    free(stack);
+}
+
+/* =================================================================
+ * MINIMIZATION (MOORE PARTITION REFINEMENT)
+ * =================================================================
+ */
+
+static void minimize_dfa(Dfa* dfa) {
+    int n = dfa->count;
+    int* cls = malloc((size_t)n * sizeof(int));
+    int* next_cls = malloc((size_t)n * sizeof(int));
+    if (!cls || !next_cls) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Initial partition: by accepted rule */
+    int class_count = 0;
+    for (int i = 0; i < n; i++) {
+        cls[i] = -1;
+        for (int j = 0; j < i; j++) {
+            if (dfa->states[j].accept_rule == dfa->states[i].accept_rule) {
+                cls[i] = cls[j];
+                break;
+            }
+        }
+        if (cls[i] < 0) cls[i] = class_count++;
+    }
+
+    for (;;) {
+        int new_count = 0;
+        for (int i = 0; i < n; i++) {
+            next_cls[i] = -1;
+            for (int j = 0; j < i && next_cls[i] < 0; j++) {
+                if (cls[j] != cls[i]) continue;
+                bool same = true;
+                for (int c = 0; c < 256 && same; c++) {
+                    int a = dfa->states[i].next[c];
+                    int b = dfa->states[j].next[c];
+                    int ca = a < 0 ? -1 : cls[a];
+                    int cb = b < 0 ? -1 : cls[b];
+                    same = (ca == cb);
+                }
+                if (same) next_cls[i] = next_cls[j];
+            }
+            if (next_cls[i] < 0) next_cls[i] = new_count++;
+        }
+
+        memcpy(cls, next_cls, (size_t)n * sizeof(int));
+        if (new_count == class_count) break;
+        class_count = new_count;
+    }
+
+    /* Collapse; class of the start state stays 0 because state 0 is first */
+    DfaState* merged = malloc((size_t)class_count * sizeof(DfaState));
+    if (!merged) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) {
+        DfaState* target = &merged[cls[i]];
+        target->accept_rule = dfa->states[i].accept_rule;
+        for (int c = 0; c < 256; c++) {
+            int next = dfa->states[i].next[c];
+            target->next[c] = next < 0 ? LEXGEN_DEAD : cls[next];
+        }
+    }
+
+    free(dfa->states);
+    dfa->states = merged;
+    dfa->count = class_count;
+    dfa->capacity = class_count;
+    free(cls);
+    free(next_cls);
+}
+
+/* =================================================================
+ * VISIT PROFILES
+ * Counts written by an --instrument scanner (rift_dfa_profile_save).
+ * State ids are minimized-DFA numbers; the fingerprint ties a profile
+ * to one DFA so a profile from an older rule file is ignored.
+ * =================================================================
+ */
+
+typedef struct {
+    bool present;
+    uint64_t* visits;           /* Per-state entries */
+    uint64_t* self_loops;       /* Per-state s -> s transitions */
+    uint64_t total;             /* Sum of visits */
+} DfaProfile;
+
+/* FNV-1a over accept rules and transitions */
+static uint64_t dfa_fingerprint(const Dfa* dfa) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < dfa->count; i++) {
+        hash = (hash ^ (uint64_t)(uint32_t)dfa->states[i].accept_rule) * 0x100000001b3ULL;
+        for (int c = 0; c < 256; c++) {
+            hash = (hash ^ (uint64_t)(uint32_t)dfa->states[i].next[c]) * 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+static bool load_profile(const char* path, const Dfa* dfa, DfaProfile* profile) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "rift_lexgen: cannot open profile %s\n", path);
+        return false;
+    }
+
+    profile->visits = calloc((size_t)dfa->count, sizeof(uint64_t));
+    profile->self_loops = calloc((size_t)dfa->count, sizeof(uint64_t));
+    if (!profile->visits || !profile->self_loops) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    char line[LEXGEN_MAX_LINE];
+    int line_no = 0;
+    bool matches = false;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), in)) {
+        unsigned long long fingerprint, count;
+        int from, to;
+        line_no++;
+
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (sscanf(line, "fingerprint %llx", &fingerprint) == 1) {
+            matches = fingerprint == dfa_fingerprint(dfa);
+            if (!matches) break;
+        } else if (sscanf(line, "states %d", &from) == 1) {
+            ok = from == dfa->count;
+        } else if (sscanf(line, "state %d %llu", &from, &count) == 2) {
+            ok = from >= 0 && from < dfa->count;
+            if (ok) {
+                profile->visits[from] += count;
+                profile->total += count;
+            }
+        } else if (sscanf(line, "edge %d %d %llu", &from, &to, &count) == 3) {
+            ok = from >= 0 && from < dfa->count && to >= 0 && to < dfa->count;
+            if (ok && from == to) profile->self_loops[from] += count;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            fprintf(stderr, "rift_lexgen: %s:%d: malformed profile line\n", path, line_no);
+        }
+    }
+    fclose(in);
+
+    if (ok && !matches) {
+        /* Rules changed since profiling: fall back to the static layout */
+        fprintf(stderr, "rift_lexgen: warning: %s was recorded for a different DFA; ignored\n",
+                path);
+        memset(profile->visits, 0, (size_t)dfa->count * sizeof(uint64_t));
+        memset(profile->self_loops, 0, (size_t)dfa->count * sizeof(uint64_t));
+        profile->total = 0;
+    }
+    profile->present = ok && matches;
+    return ok;
+}
+
+/* =================================================================
+ * HOT-STATE ORDERING
+ * Start state first. With a profile, visited states follow hottest
+ * first, so the states a corpus spends its time in share cache lines.
+ * Remaining states go by breadth-first depth, ties broken by the
+ * number of input bytes that lead into a state (wider fan-in states
+ * are visited more often and should sit closer to the entry point).
+ * =================================================================
+ */
+
+typedef struct {
+    int state;
+    uint64_t visits;
+    int depth;
+    int fan_in;
+} StateRank;
+
+static int compare_rank(const void* a, const void* b) {
+    const StateRank* ra = a;
+    const StateRank* rb = b;
+    if (ra->visits != rb->visits) return ra->visits < rb->visits ? 1 : -1;
+    if (ra->depth != rb->depth) return ra->depth - rb->depth;
+    if (ra->fan_in != rb->fan_in) return rb->fan_in - ra->fan_in;
+    return ra->state - rb->state;
+}
+
+static int* order_states(const Dfa* dfa, const DfaProfile* profile) {
+    int n = dfa->count;
+    StateRank* ranks = calloc((size_t)n, sizeof(StateRank));
+    int* queue = malloc((size_t)n * sizeof(int));
+    int* order = malloc((size_t)n * sizeof(int));
+    if (!ranks || !queue || !order) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < n; i++) {
+        ranks[i].state = i;
+        ranks[i].visits = profile->present ? profile->visits[i] : 0;
+        ranks[i].depth = -1;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int c = 0; c < 256; c++) {
+            int t = dfa->states[i].next[c];
+            if (t >= 0 && t != i) ranks[t].fan_in++;
+        }
+    }
+
+    int head = 0, tail = 0;
+    ranks[0].depth = 0;
+    queue[tail++] = 0;
+    while (head < tail) {
+        int s = queue[head++];
+        for (int c = 0; c < 256; c++) {
+            int t = dfa->states[s].next[c];
+            if (t >= 0 && ranks[t].depth < 0) {
+                ranks[t].depth = ranks[s].depth + 1;
+                queue[tail++] = t;
+            }
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        if (ranks[i].depth < 0) ranks[i].depth = n;
+    }
+
+    qsort(ranks + 1, (size_t)(n - 1), sizeof(StateRank), compare_rank);
+    for (int i = 0; i < n; i++) {
+        order[i] = ranks[i].state;
+    }
+
+    free(ranks);
+    free(queue);
+    return order;
+}
+
+/* =================================================================
+ * C EMISSION
+ * =================================================================
+ */
+
+static void emit_byte(FILE* out, int c) {
+    if (c == '\'' || c == '\\') {
+        fprintf(out, "'\\%c'", c);
+    } else if (c >= 0x20 && c < 0x7f) {
+        fprintf(out, "'%c'", c);
+    } else {
+        fprintf(out, "0x%02X", c);
+    }
+}
+
+static bool has_self_loop(const DfaState* state, int self) {
+    for (int c = 0; c < 256; c++) {
+        if (state->next[c] == self) return true;
+    }
+    return false;
+}
+
+/*
+ * Unroll factor for a state's self-loop, 0 for none. Instrumented
+ * scanners take every transition through the switch so each is counted;
+ * with a profile, unvisited loops stay plain and hot ones go wider.
+ */
+static int loop_unroll(const Dfa* dfa, int s, const DfaProfile* profile, bool instrument) {
+    if (s == 0 || instrument || !has_self_loop(&dfa->states[s], s)) return 0;
+    if (!profile->present) return LEXGEN_UNROLL_FACTOR;
+    if (profile->self_loops[s] == 0) return 0;
+    if (profile->self_loops[s] >= profile->total / LEXGEN_HOT_LOOP_SHARE) return LEXGEN_HOT_UNROLL;
+    return LEXGEN_UNROLL_FACTOR;
+}
+
+/* Dense (from, to) -> instrumented edge counter index, -1 for none */
+static int* number_edges(const Dfa* dfa, int* out_count) {
+    int n = dfa->count;
+    int* index = malloc((size_t)n * (size_t)n * sizeof(int));
+    if (!index) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n * n; i++) index[i] = -1;
+
+    int count = 0;
+    for (int s = 0; s < n; s++) {
+        for (int c = 0; c < 256; c++) {
+            int t = dfa->states[s].next[c];
+            if (t >= 0) index[s * n + t] = 0;
+        }
+        for (int t = 0; t < n; t++) {
+            if (index[s * n + t] == 0) index[s * n + t] = count++;
+        }
+    }
+    *out_count = count;
+    return index;
+}
+
+static void emit_profile_counters(FILE* out, const Dfa* dfa, const int* edges,
+                                  int edge_count, const char* prefix) {
+    int n = dfa->count;
+
+    fprintf(out, "static uint64_t %s_state_visits[%d];\n", prefix, n);
+    fprintf(out, "static uint64_t %s_edge_visits[%d];\n\n", prefix, edge_count);
+
+    const char* names[2] = {"from", "to"};
+    for (int side = 0; side < 2; side++) {
+        fprintf(out, "static const uint16_t %s_edge_%s[%d] = {", prefix, names[side], edge_count);
+        int emitted = 0;
+        for (int s = 0; s < n; s++) {
+            for (int t = 0; t < n; t++) {
+                if (edges[s * n + t] < 0) continue;
+                if (emitted++ % 16 == 0) fprintf(out, "\n    ");
+                fprintf(out, "%d,", side == 0 ? s : t);
+            }
+        }
+        fprintf(out, "\n};\n\n");
+    }
+
+    fprintf(out,
+        "const RiftDfaProfileCounters %s_counters = {\n"
+        "    0x%016llxULL, %d, %d,\n"
+        "    %s_edge_from, %s_edge_to,\n"
+        "    %s_state_visits, %s_edge_visits\n"
+        "};\n\n",
+        prefix, (unsigned long long)dfa_fingerprint(dfa), n, edge_count,
+        prefix, prefix, prefix, prefix);
+}
+
+static void emit_scanner(FILE* out, const RuleSet* rules, const Dfa* dfa,
+                         const char* prefix, const char* include,
+                         const char* rules_path, const DfaProfile* profile,
+                         const char* profile_path, bool instrument) {
+    int n = dfa->count;
+    int* order = order_states(dfa, profile);
+    int edge_count = 0;
+    int* edges = instrument ? number_edges(dfa, &edge_count) : NULL;
+    bool* targeted = calloc((size_t)n, sizeof(bool));
+    if (!targeted) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) {
+        for (int c = 0; c < 256; c++) {
+            int t = dfa->states[i].next[c];
+            if (t >= 0) targeted[t] = true;
+        }
+    }
+
+    fprintf(out,
+        "/*\n"
+        " * =================================================================\n"
+        " * GENERATED FILE - DO NOT EDIT\n"
+        " * Produced by rift_lexgen from %s\n"
+        " * Scanner: %s_scan (%d rules, %d DFA states)\n", rules_path, prefix,
+        rules->rule_count, n);
+    if (instrument) {
+        fprintf(out, " * Instrumented: counts state and transition visits\n");
+    } else if (profile->present) {
+        fprintf(out, " * Layout: profile %s (%llu state visits)\n",
+                profile_path, (unsigned long long)profile->total);
+    }
+    fprintf(out,
+        " * =================================================================\n"
+        " */\n\n");
+
+    fprintf(out, "#include <stddef.h>\n");
+    fprintf(out, "#include \"rift-0/core/tokenizer_types.h\"\n");
+    if (instrument) {
+        fprintf(out, "#include \"rift-0/core/dfa_profile.h\"\n");
+    }
+    if (include) {
+        fprintf(out, "#include \"%s\"\n", include);
+    }
+    fprintf(out, "\nconst size_t %s_dfa_state_count = %d;\n\n", prefix, n);
+
+    if (instrument) {
+        emit_profile_counters(out, dfa, edges, edge_count, prefix);
+    }
+
+    /* Self-loop membership tables drive the unrolled inner loops */
+    for (int i = 0; i < n; i++) {
+        if (loop_unroll(dfa, i, profile, instrument) == 0) continue;
+        fprintf(out, "static const unsigned char %s_loop_%d[256] = {", prefix, i);
+        for (int c = 0; c < 256; c++) {
+            if (c % 32 == 0) fprintf(out, "\n    ");
+            fprintf(out, "%d,", dfa->states[i].next[c] == i ? 1 : 0);
+        }
+        fprintf(out, "\n};\n\n");
+    }
+
+    fprintf(out,
+        "size_t %s_scan(const unsigned char* cursor, const unsigned char* limit,\n"
+        "               TokenType* out_type) {\n"
+        "    const unsigned char* p = cursor;\n"
+        "    const unsigned char* last_end = cursor;\n"
+        "    TokenType last_type = TOKEN_UNKNOWN;\n\n", prefix);
+
+    for (int k = 0; k < n; k++) {
+        int s = order[k];
+        const DfaState* state = &dfa->states[s];
+
+        if (targeted[s]) {
+            fprintf(out, "%s_s%d:\n", prefix, s);
+        }
+        if (instrument) {
+            fprintf(out, "    %s_state_visits[%d]++;\n", prefix, s);
+        }
+
+        int unroll = loop_unroll(dfa, s, profile, instrument);
+        if (unroll > 0) {
+            fprintf(out,
+                "    while (limit - p >= %d", unroll);
+            for (int u = 0; u < unroll; u++) {
+                fprintf(out, " &&\n           %s_loop_%d[p[%d]]", prefix, s, u);
+            }
+            fprintf(out, ") {\n        p += %d;\n    }\n", unroll);
+        }
+
+        if (state->accept_rule != LEXGEN_NO_RULE) {
+            const LexRule* rule = &rules->rules[state->accept_rule];
+            fprintf(out, "    last_type = %s; /* %s */\n", rule->token_type, rule->name);
+            fprintf(out, "    last_end = p;\n");
+        }
+
+        bool any = false;
+        for (int c = 0; c < 256 && !any; c++) {
+            any = state->next[c] >= 0;
+        }
+        if (!any) {
+            fprintf(out, "    goto %s_done;\n\n", prefix);
+            continue;
+        }
+
+        fprintf(out, "    if (p >= limit) goto %s_done;\n", prefix);
+        fprintf(out, "    switch (*p++) {\n");
+
+        /* Group case labels by target, emitting targets in hot order */
+        for (int kt = 0; kt < n; kt++) {
+            int target = order[kt];
+            int labels = 0;
+            for (int c = 0; c < 256; c++) {
+                if (state->next[c] != target) continue;
+                fprintf(out, labels % 6 == 0 ? "%s        case " : " case ",
+                        labels == 0 ? "" : "\n");
+                emit_byte(out, c);
+                fputc(':', out);
+                labels++;
+            }
+            if (labels > 0 && instrument) {
+                fprintf(out, "\n            %s_edge_visits[%d]++;",
+                        prefix, edges[s * n + target]);
+            }
+            if (labels > 0) {
+                fprintf(out, "\n            goto %s_s%d;\n", prefix, target);
+            }
+        }
+
+        fprintf(out, "        default:\n            goto %s_done;\n    }\n\n", prefix);
+    }
+
+    fprintf(out,
+        "%s_done:\n"
+        "    if (out_type) {\n"
+        "        *out_type = last_type;\n"
+        "    }\n"
+        "    return (size_t)(last_end - cursor);\n"
+        "}\n", prefix);
+
+    free(order);
+    free(targeted);
+    free(edges);
+}
+
+/* =================================================================
+ * ENTRY POINT
+ * =================================================================
+ */
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "Usage: %s <rules> <output.c> [--prefix NAME] [--include HEADER]\n"
+                    "       [--dfa-profile FILE] [--instrument]\n",
+            program);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* rules_path = argv[1];
+    const char* output_path = argv[2];
+    const char* prefix = "rift_generated";
+    const char* include = NULL;
+    const char* profile_path = NULL;
+    bool instrument = false;
+
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--prefix") == 0 && i + 1 < argc) {
+            prefix = argv[++i];
+        } else if (strcmp(argv[i], "--include") == 0 && i + 1 < argc) {
+            include = argv[++i];
+        } else if (strcmp(argv[i], "--dfa-profile") == 0 && i + 1 < argc) {
+            profile_path = argv[++i];
+        } else if (strcmp(argv[i], "--instrument") == 0) {
+            instrument = true;
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    RuleSet* rules = calloc(1, sizeof(RuleSet));
+    if (!rules) {
+        fprintf(stderr, "rift_lexgen: out of memory\n");
+        return EXIT_FAILURE;
+    }
+    if (!load_rules(rules_path, rules)) {
+        free(rules->nfa.states);
+        free(rules);
+        return EXIT_FAILURE;
+    }
+
+    Dfa dfa = { NULL, 0, 0 };
+    build_dfa(rules, &dfa);
+    minimize_dfa(&dfa);
+
+    if (instrument && dfa.count > LEXGEN_MAX_STATE_ID) {
+        fprintf(stderr, "rift_lexgen: %d states is too many to instrument\n", dfa.count);
+        free(dfa.states);
+        free(rules->nfa.states);
+        free(rules);
+        return EXIT_FAILURE;
+    }
+
+    DfaProfile profile = { false, NULL, NULL, 0 };
+    if (profile_path && !load_profile(profile_path, &dfa, &profile)) {
+        free(profile.visits);
+        free(profile.self_loops);
+        free(dfa.states);
+        free(rules->nfa.states);
+        free(rules);
+        return EXIT_FAILURE;
+    }
+
+    FILE* out = fopen(output_path, "w");
+    if (!out) {
+        fprintf(stderr, "rift_lexgen: cannot write %s\n", output_path);
+        free(profile.visits);
+        free(profile.self_loops);
+        free(dfa.states);
+        free(rules->nfa.states);
+        free(rules);
+        return EXIT_FAILURE;
+    }
+
+    emit_scanner(out, rules, &dfa, prefix, include, rules_path,
+                 &profile, profile_path, instrument);
+    bool write_ok = !ferror(out);
+    fclose(out);
+
+    free(profile.visits);
+    free(profile.self_loops);
+    free(dfa.states);
+    free(rules->nfa.states);
+    free(rules);
+
+    if (!write_ok) {
+        fprintf(stderr, "rift_lexgen: write error on %s\n", output_path);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
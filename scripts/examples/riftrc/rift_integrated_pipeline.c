@@ -432,10 +432,10 @@ bool rift_stage_dual_parsing(RIFTToken** tokens, size_t token_count,
     
     // Isomorphism validation for dual mode
     if (input_spec->dual_mode_enabled && config->require_isomorphism) {
-        fprintf(diag->stdout_channel, "[STAGE-1] 🔍 Performing isomorphism validation...\n");
-        // Simulate validation process
-        usleep(50000); // 50ms validation time
-        fprintf(diag->stdout_channel, "[STAGE-1] ✅ Tree isomorphism validated\n");
+        // The simulated workers build no trees, so there are no root hashes
+        // to compare. With real ones this is rift_parser_validate_consistency.
+        fprintf(diag->stdout_channel,
+                "[STAGE-1] ⚠️  Isomorphism validation skipped: simulated workers build no ASTs\n");
     }
     
     free(bottom_up_contexts);
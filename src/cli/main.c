@@ -356,9 +356,16 @@ static int cmd_tokenize(void) {
     } else {
         // Print tokens to stdout
         for (size_t i = 0; i < token_count; i++) {
-            printf("Token[%zu]: type=%d, value='%s', line=%zu, col=%zu\n",
-                   i, tokens[i].type, tokens[i].value, 
-                   tokens[i].line_number, tokens[i].column_number);
+            size_t line = 0, col = 0;
+            rift_tokenizer_get_location(&tokenizer_state, tokens[i].offset, &line, &col);
+            // String tokens are spans; print the source lexeme
+            printf("Token[%zu]: type=%d, value='%.*s', line=%zu, col=%zu\n",
+                   i, tokens[i].type,
+                   tokens[i].type == TOKEN_LITERAL_STRING ? (int)tokens[i].length
+                                                          : (int)strlen(tokens[i].value),
+                   tokens[i].type == TOKEN_LITERAL_STRING ? input_content + tokens[i].offset
+                                                          : tokens[i].value,
+                   line, col);
         }
     }
     
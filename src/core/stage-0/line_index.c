@@ -0,0 +1,141 @@
+/*
+ * rift/src/core/stage-0/line_index.c
+ * RIFT Stage 0: Lazy Line Index
+ * OBINexus Computing Framework - AEGIS Methodology
+ * Technical Lead: Nnamdi Michael Okpala
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "rift/core/stage-0/tokenizer.h"
+#include "rift/core/stage-0/line_index.h"
+
+/*
+ * Tokens carry byte offsets only; lines and columns are derived here when
+ * a diagnostic actually needs them, so the scanner hot loop never counts.
+ */
+
+static int push_newline(rift_line_index_t* index, size_t* capacity, size_t offset) {
+    if (index->newline_count == *capacity) {
+        size_t grown = *capacity ? *capacity * 2 : 256;
+        size_t* table = realloc(index->newlines, grown * sizeof(size_t));
+        if (!table) {
+            return RIFT_ERROR_MEMORY_ALLOCATION;
+        }
+        index->newlines = table;
+        *capacity = grown;
+    }
+    index->newlines[index->newline_count++] = offset;
+    return RIFT_SUCCESS;
+}
+
+static int build_line_index(rift_line_index_t* index) {
+    const unsigned char* input = (const unsigned char*)index->input;
+    size_t capacity = 0;
+    size_t i = 0;
+
+    // A failed earlier build may have left a partial table behind
+    free(index->newlines);
+    index->newlines = NULL;
+    index->newline_count = 0;
+
+#ifdef __SSE2__
+    // 16 bytes per compare; only blocks containing '\n' are walked bitwise
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; i + 16 <= index->length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(input + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+        while (mask) {
+            if (push_newline(index, &capacity, i + (size_t)__builtin_ctz(mask)) != RIFT_SUCCESS) {
+                return RIFT_ERROR_MEMORY_ALLOCATION;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // Scalar tail (or whole input without SSE2)
+    while (i < index->length) {
+        const unsigned char* hit = memchr(input + i, '\n', index->length - i);
+        if (!hit) {
+            break;
+        }
+        if (push_newline(index, &capacity, (size_t)(hit - input)) != RIFT_SUCCESS) {
+            return RIFT_ERROR_MEMORY_ALLOCATION;
+        }
+        i = (size_t)(hit - input) + 1;
+    }
+
+    index->built = true;
+    return RIFT_SUCCESS;
+}
+
+/*
+ * rift_line_index_init - Attach a line index to source text
+ */
+void rift_line_index_init(rift_line_index_t* index, const char* input, size_t length) {
+    if (!index) {
+        return;
+    }
+    index->input = input;
+    index->length = input ? length : 0;
+    index->newlines = NULL;
+    index->newline_count = 0;
+    index->built = false;
+}
+
+/*
+ * rift_line_index_lookup - Resolve a byte offset to line and column
+ */
+int rift_line_index_lookup(rift_line_index_t* index, size_t offset,
+                           size_t* line, size_t* column) {
+    if (!index || !line || !column) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (!index->built) {
+        int result = build_line_index(index);
+        if (result != RIFT_SUCCESS) {
+            return result;
+        }
+    }
+
+    if (offset > index->length) {
+        offset = index->length;
+    }
+
+    // Count newlines strictly before offset
+    size_t lo = 0;
+    size_t hi = index->newline_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (index->newlines[mid] < offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    size_t line_start = lo ? index->newlines[lo - 1] + 1 : 0;
+    *line = lo + 1;
+    *column = offset - line_start + 1;
+    return RIFT_SUCCESS;
+}
+
+/*
+ * rift_line_index_free - Release the newline table
+ */
+void rift_line_index_free(rift_line_index_t* index) {
+    if (index) {
+        free(index->newlines);
+        index->newlines = NULL;
+        index->newline_count = 0;
+        index->built = false;
+    }
+}
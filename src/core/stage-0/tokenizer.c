@@ -12,55 +12,30 @@
 #include <ctype.h>
 #include <assert.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 // Include RIFT core headers
 #include "rift/core/stage-0/tokenizer.h"
+#include "rift/core/stage-0/line_index.h"
 #include "rift/core/common.h"
 #include "rift/governance/policy.h"
 
-// AEGIS Compliance Constants
+// Numeric conversion is shared with rift-0; its types stay private here
+#include "rift-0/core/number_parse.h"
+
+// Token, state and limits are declared in tokenizer.h
 #define RIFT_TOKENIZER_VERSION "1.0.0"
-#define RIFT_MAX_TOKEN_LENGTH 256
-#define RIFT_MAX_TOKENS 4096
-#define RIFT_MEMORY_ALIGNMENT 4096
-
-// Token Type Classification - AEGIS Three-Field Schema
-typedef enum {
-    TOKEN_KEYWORD,
-    TOKEN_IDENTIFIER,
-    TOKEN_LITERAL_INTEGER,
-    TOKEN_LITERAL_FLOAT,
-    TOKEN_LITERAL_STRING,
-    TOKEN_OPERATOR,
-    TOKEN_PUNCTUATION,
-    TOKEN_WHITESPACE,
-    TOKEN_NEWLINE,
-    TOKEN_EOF,
-    TOKEN_ERROR,
-    TOKEN_UNKNOWN
-} rift_token_type_t;
-
-// RIFT Token Structure - Three-Field AEGIS Compliance
-typedef struct {
-    rift_token_type_t type;           // Token classification
-    char value[RIFT_MAX_TOKEN_LENGTH]; // Token lexical content
-    size_t matched_state;             // AST minimization preservation field
-    size_t line_number;               // Source location tracking
-    size_t column_number;             // Column position tracking
-    size_t complexity_cost;           // Computational complexity metric
-} rift_token_t;
-
-// Tokenizer State Management
-typedef struct {
-    const char* input;                // Source text input
-    size_t position;                  // Current position in input
-    size_t length;                    // Total input length
-    size_t line;                      // Current line number
-    size_t column;                    // Current column number
-    rift_token_t* tokens;             // Token array buffer
-    size_t token_count;               // Number of tokens generated
-    size_t token_capacity;            // Maximum token capacity
-    bool aegis_validation_enabled;    // AEGIS governance flag
-} rift_tokenizer_state_t;
+#define RIFT_STRING_ARENA_BLOCK 4096
+
+// String Arena Block - decoded literals are bump-allocated here
+struct rift_string_block {
+    struct rift_string_block* next;
+    size_t used;
+    size_t capacity;
+    char data[];
+};
 
 // AEGIS Keywords Registry
 static const char* rift_keywords[] = {
@@ -72,8 +47,17 @@ static const char* rift_keywords[] = {
 
 static const size_t rift_keywords_count = sizeof(rift_keywords) / sizeof(rift_keywords[0]);
 
+// Multi-character operators, longest first; any other operator is one character
+static const char* rift_compound_operators[] = {
+    "<<=", ">>=",
+    "**", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=",
+    "||", "&&", "==", "!=", "<=", ">=", "<<", ">>"
+};
+
+static const size_t rift_compound_operators_count =
+    sizeof(rift_compound_operators) / sizeof(rift_compound_operators[0]);
+
 // Forward Declarations
-static rift_token_type_t classify_token(const char* lexeme);
 static bool is_keyword(const char* lexeme);
 static bool is_operator_char(char c);
 static bool is_punctuation_char(char c);
@@ -90,15 +74,18 @@ static char peek_next(const rift_tokenizer_state_t* state);
  */
 int rift_tokenizer_init(const char* input, rift_tokenizer_state_t* state) {
     if (!input || !state) {
-        return -RIFT_ERROR_INVALID_ARGUMENT;
+        return RIFT_ERROR_INVALID_ARGUMENT;
     }
 
     // Initialize state with AEGIS compliance
     state->input = input;
     state->position = 0;
     state->length = strlen(input);
-    state->line = 1;
-    state->column = 1;
+    rift_line_index_init(&state->line_index, input, state->length);
+    state->strings.blocks = NULL;
+    state->constants = NULL;
+    state->constant_count = 0;
+    state->constant_capacity = 0;
     state->token_count = 0;
     state->token_capacity = RIFT_MAX_TOKENS;
     state->aegis_validation_enabled = true;
@@ -107,7 +94,7 @@ int rift_tokenizer_init(const char* input, rift_tokenizer_state_t* state) {
     state->tokens = aligned_alloc(RIFT_MEMORY_ALIGNMENT, 
                                   sizeof(rift_token_t) * RIFT_MAX_TOKENS);
     if (!state->tokens) {
-        return -RIFT_ERROR_MEMORY_ALLOCATION;
+        return RIFT_ERROR_MEMORY_ALLOCATION;
     }
 
     // Zero-initialize token buffer for security
@@ -123,58 +110,55 @@ int rift_tokenizer_init(const char* input, rift_tokenizer_state_t* state) {
  */
 int rift_tokenizer_process(rift_tokenizer_state_t* state) {
     if (!state || !state->input || !state->tokens) {
-        return -RIFT_ERROR_INVALID_STATE;
+        return RIFT_ERROR_INVALID_STATE;
     }
 
     while (state->position < state->length) {
         char current = peek_current(state);
         
-        // Skip whitespace with position tracking
+        // Skip whitespace; lines are resolved later from the offset
         if (isspace(current)) {
-            if (current == '\n') {
-                state->line++;
-                state->column = 1;
-            } else {
-                state->column++;
-            }
             advance_tokenizer(state);
             continue;
         }
 
         // Check token capacity
         if (state->token_count >= state->token_capacity) {
-            return -RIFT_ERROR_TOKEN_BUFFER_OVERFLOW;
+            return RIFT_ERROR_TOKEN_BUFFER_OVERFLOW;
         }
 
         rift_token_t* token = &state->tokens[state->token_count];
-        token->line_number = state->line;
-        token->column_number = state->column;
+        token->offset = state->position;
+        token->flags = 0;
+        token->decoded = NULL;
+        token->decoded_length = 0;
+        token->constant_index = RIFT_NO_CONSTANT;
         
         // Tokenize based on character classification
         if (isalpha(current) || current == '_') {
             // Identifier or keyword
             if (tokenize_identifier(state, token) != RIFT_SUCCESS) {
-                return -RIFT_ERROR_TOKENIZATION_FAILED;
+                return RIFT_ERROR_TOKENIZATION_FAILED;
             }
         } else if (isdigit(current)) {
             // Numeric literal
             if (tokenize_number(state, token) != RIFT_SUCCESS) {
-                return -RIFT_ERROR_TOKENIZATION_FAILED;
+                return RIFT_ERROR_TOKENIZATION_FAILED;
             }
         } else if (current == '"' || current == '\'') {
             // String literal
             if (tokenize_string(state, token) != RIFT_SUCCESS) {
-                return -RIFT_ERROR_TOKENIZATION_FAILED;
+                return RIFT_ERROR_TOKENIZATION_FAILED;
             }
         } else if (is_operator_char(current)) {
             // Operator
             if (tokenize_operator(state, token) != RIFT_SUCCESS) {
-                return -RIFT_ERROR_TOKENIZATION_FAILED;
+                return RIFT_ERROR_TOKENIZATION_FAILED;
             }
         } else if (is_punctuation_char(current)) {
             // Punctuation
             if (tokenize_punctuation(state, token) != RIFT_SUCCESS) {
-                return -RIFT_ERROR_TOKENIZATION_FAILED;
+                return RIFT_ERROR_TOKENIZATION_FAILED;
             }
         } else {
             // Unknown character - error token
@@ -185,11 +169,12 @@ int rift_tokenizer_process(rift_tokenizer_state_t* state) {
             token->complexity_cost = 1;
             advance_tokenizer(state);
         }
+        token->length = state->position - token->offset;
 
         // AEGIS governance validation
         if (state->aegis_validation_enabled) {
             if (rift_governance_validate_token(token) != RIFT_SUCCESS) {
-                return -RIFT_ERROR_GOVERNANCE_VIOLATION;
+                return RIFT_ERROR_GOVERNANCE_VIOLATION;
             }
         }
 
@@ -202,8 +187,12 @@ int rift_tokenizer_process(rift_tokenizer_state_t* state) {
         eof_token->type = TOKEN_EOF;
         eof_token->value[0] = '\0';
         eof_token->matched_state = 0;
-        eof_token->line_number = state->line;
-        eof_token->column_number = state->column;
+        eof_token->offset = state->length;
+        eof_token->length = 0;
+        eof_token->flags = 0;
+        eof_token->decoded = NULL;
+        eof_token->constant_index = RIFT_NO_CONSTANT;
+        eof_token->decoded_length = 0;
         eof_token->complexity_cost = 0;
         state->token_count++;
     }
@@ -214,7 +203,7 @@ int rift_tokenizer_process(rift_tokenizer_state_t* state) {
 /*
  * tokenize_identifier - Process identifier or keyword tokens
  */
-static int tokenize_identifier(rift_tokenizer_state_t* state, rift_token_t* token) {
+int tokenize_identifier(rift_tokenizer_state_t* state, rift_token_t* token) {
     size_t start_pos = state->position;
     size_t value_index = 0;
 
@@ -239,78 +228,312 @@ static int tokenize_identifier(rift_tokenizer_state_t* state, rift_token_t* toke
 /*
  * tokenize_number - Process numeric literal tokens
  */
-static int tokenize_number(rift_tokenizer_state_t* state, rift_token_t* token) {
-    size_t start_pos = state->position;
-    size_t value_index = 0;
-    bool has_decimal = false;
-
-    while (state->position < state->length && value_index < RIFT_MAX_TOKEN_LENGTH - 1) {
-        char current = peek_current(state);
-        if (isdigit(current)) {
-            token->value[value_index++] = current;
-            advance_tokenizer(state);
-        } else if (current == '.' && !has_decimal) {
-            has_decimal = true;
-            token->value[value_index++] = current;
-            advance_tokenizer(state);
-        } else {
+static int push_constant(rift_tokenizer_state_t* state, const RiftNumber* number) {
+    if (state->constant_count == state->constant_capacity) {
+        size_t grown = state->constant_capacity ? state->constant_capacity * 2 : 64;
+        rift_constant_t* table = realloc(state->constants, grown * sizeof(rift_constant_t));
+        if (!table) {
+            return RIFT_ERROR_MEMORY_ALLOCATION;
+        }
+        state->constants = table;
+        state->constant_capacity = grown;
+    }
+    rift_constant_t* constant = &state->constants[state->constant_count++];
+    switch (number->kind) {
+        case RIFT_NUMBER_INTEGER:
+            constant->kind = RIFT_CONSTANT_INTEGER;
+            constant->as.integer = number->as.integer;
+            break;
+        case RIFT_NUMBER_FLOAT:
+            constant->kind = RIFT_CONSTANT_FLOAT;
+            constant->as.real = number->as.real;
             break;
+        default:
+            constant->kind = RIFT_CONSTANT_INVALID;
+            constant->as.integer = 0;
+            break;
+    }
+    return RIFT_SUCCESS;
+}
+
+int tokenize_number(rift_tokenizer_state_t* state, rift_token_t* token) {
+    size_t start_pos = state->position;
+    const char* input = state->input;
+    size_t end = start_pos;
+    bool is_float = false;
+
+    // Scan the lexeme; conversion below reads the input span, not value[]
+    char prefix = (char)(peek_next(state) | 0x20);
+    if (input[end] == '0' && (prefix == 'x' || prefix == 'b')) {
+        end += 2;
+        while (end < state->length &&
+               (input[end] == '_' || (prefix == 'x' ? isxdigit((unsigned char)input[end])
+                                                    : (input[end] == '0' || input[end] == '1')))) {
+            end++;
+        }
+    } else {
+        while (end < state->length && (isdigit((unsigned char)input[end]) || input[end] == '_')) {
+            end++;
+        }
+        if (end + 1 < state->length && input[end] == '.' && isdigit((unsigned char)input[end + 1])) {
+            is_float = true;
+            end++;
+            while (end < state->length && (isdigit((unsigned char)input[end]) || input[end] == '_')) {
+                end++;
+            }
+        }
+        if (end < state->length && (input[end] == 'e' || input[end] == 'E')) {
+            size_t digits = end + 1;
+            if (digits < state->length && (input[digits] == '+' || input[digits] == '-')) {
+                digits++;
+            }
+            if (digits < state->length && isdigit((unsigned char)input[digits])) {
+                is_float = true;
+                end = digits;
+                while (end < state->length && isdigit((unsigned char)input[end])) {
+                    end++;
+                }
+            }
         }
     }
 
-    token->value[value_index] = '\0';
-    token->type = has_decimal ? TOKEN_LITERAL_FLOAT : TOKEN_LITERAL_INTEGER;
+    size_t length = end - start_pos;
+    size_t copied = length < RIFT_MAX_TOKEN_LENGTH - 1 ? length : RIFT_MAX_TOKEN_LENGTH - 1;
+    memcpy(token->value, input + start_pos, copied);
+    token->value[copied] = '\0';
+    state->position = end;
+
+    // Convert once; consumers read the typed value via constant_index
+    RiftNumber number;
+    if (!rift_number_parse(input + start_pos, length, &number)) {
+        number.kind = RIFT_NUMBER_INVALID;
+        number.as.integer = 0;
+        token->flags |= RIFT_TOKEN_FLAG_BAD_NUMBER;
+    }
+    if (push_constant(state, &number) != RIFT_SUCCESS) {
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+    token->constant_index = state->constant_count - 1;
+
+    // Decimal integers past uint64_t convert as floats
+    token->type = (is_float || number.kind == RIFT_NUMBER_FLOAT) ? TOKEN_LITERAL_FLOAT
+                                                                 : TOKEN_LITERAL_INTEGER;
     token->matched_state = start_pos;
     token->complexity_cost = calculate_complexity_cost(token->type, token->value);
 
     return RIFT_SUCCESS;
 }
 
+/*
+ * find_quote_or_escape - Offset of the first quote or backslash in text
+ * Returns length when neither occurs.
+ */
+static size_t find_quote_or_escape(const char* text, size_t length, char quote) {
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i quote_v = _mm_set1_epi8(quote);
+    const __m128i escape_v = _mm_set1_epi8('\\');
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + i));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(block, quote_v),
+                                    _mm_cmpeq_epi8(block, escape_v));
+        int mask = _mm_movemask_epi8(hits);
+        if (mask) {
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+        }
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (text[i] == quote || text[i] == '\\') {
+            return i;
+        }
+    }
+    return length;
+}
+
 /*
  * tokenize_string - Process string literal tokens
+ *
+ * Zero-copy: the token records its span and whether escapes occur;
+ * rift_tokenizer_string_value decodes on demand.
  */
-static int tokenize_string(rift_tokenizer_state_t* state, rift_token_t* token) {
+int tokenize_string(rift_tokenizer_state_t* state, rift_token_t* token) {
     size_t start_pos = state->position;
     char quote_char = peek_current(state);
-    size_t value_index = 0;
+    size_t cursor = start_pos + 1; // Skip opening quote
 
-    advance_tokenizer(state); // Skip opening quote
-
-    while (state->position < state->length && value_index < RIFT_MAX_TOKEN_LENGTH - 1) {
-        char current = peek_current(state);
-        if (current == quote_char) {
-            advance_tokenizer(state); // Skip closing quote
+    token->flags |= RIFT_TOKEN_FLAG_UNTERMINATED;
+    while (cursor < state->length) {
+        cursor += find_quote_or_escape(state->input + cursor, state->length - cursor, quote_char);
+        if (cursor >= state->length) {
+            break;
+        }
+        if (state->input[cursor] == quote_char) {
+            cursor++; // Closing quote
+            token->flags &= ~RIFT_TOKEN_FLAG_UNTERMINATED;
             break;
-        } else if (current == '\\') {
-            // Handle escape sequences
-            advance_tokenizer(state);
-            if (state->position < state->length) {
-                char escaped = peek_current(state);
-                switch (escaped) {
-                    case 'n': token->value[value_index++] = '\n'; break;
-                    case 't': token->value[value_index++] = '\t'; break;
-                    case 'r': token->value[value_index++] = '\r'; break;
-                    case '\\': token->value[value_index++] = '\\'; break;
-                    case '"': token->value[value_index++] = '"'; break;
-                    case '\'': token->value[value_index++] = '\''; break;
-                    default: token->value[value_index++] = escaped; break;
-                }
-                advance_tokenizer(state);
-            }
-        } else {
-            token->value[value_index++] = current;
-            advance_tokenizer(state);
         }
+        // Backslash: the escaped byte can never close the literal
+        token->flags |= RIFT_TOKEN_FLAG_HAS_ESCAPES;
+        cursor += 2;
     }
+    state->position = cursor < state->length ? cursor : state->length;
 
-    token->value[value_index] = '\0';
+    token->value[0] = '\0';
     token->type = TOKEN_LITERAL_STRING;
     token->matched_state = start_pos;
+    // Cost scales with the raw span; nothing has been copied
+    token->complexity_cost = 1 + (state->position - start_pos);
+
+    return RIFT_SUCCESS;
+}
+
+/*
+ * tokenize_operator - Process operator tokens
+ */
+int tokenize_operator(rift_tokenizer_state_t* state, rift_token_t* token) {
+    size_t start_pos = state->position;
+    const char* input = state->input + start_pos;
+    size_t remaining = state->length - start_pos;
+    size_t length = 1;
+
+    for (size_t i = 0; i < rift_compound_operators_count; i++) {
+        size_t candidate = strlen(rift_compound_operators[i]);
+        if (candidate <= remaining && memcmp(input, rift_compound_operators[i], candidate) == 0) {
+            length = candidate;
+            break;
+        }
+    }
+
+    memcpy(token->value, input, length);
+    token->value[length] = '\0';
+    state->position += length;
+    token->type = TOKEN_OPERATOR;
+    token->matched_state = start_pos;
     token->complexity_cost = calculate_complexity_cost(token->type, token->value);
 
     return RIFT_SUCCESS;
 }
 
+/*
+ * tokenize_punctuation - Process punctuation tokens
+ */
+int tokenize_punctuation(rift_tokenizer_state_t* state, rift_token_t* token) {
+    token->value[0] = peek_current(state);
+    token->value[1] = '\0';
+    token->type = TOKEN_PUNCTUATION;
+    token->matched_state = state->position;
+    token->complexity_cost = 1;
+    advance_tokenizer(state);
+
+    return RIFT_SUCCESS;
+}
+
+/*
+ * string_arena_alloc - Bump allocation for decoded literals
+ */
+static char* string_arena_alloc(rift_string_arena_t* arena, size_t size) {
+    rift_string_block_t* block = arena->blocks;
+    if (!block || block->capacity - block->used < size) {
+        size_t capacity = size > RIFT_STRING_ARENA_BLOCK ? size : RIFT_STRING_ARENA_BLOCK;
+        block = malloc(sizeof(rift_string_block_t) + capacity);
+        if (!block) {
+            return NULL;
+        }
+        block->used = 0;
+        block->capacity = capacity;
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+
+    char* memory = block->data + block->used;
+    block->used += size;
+    return memory;
+}
+
+/*
+ * decode_string_escapes - Unescape body into out; returns decoded length
+ */
+static size_t decode_string_escapes(const char* body, size_t length, char* out) {
+    size_t written = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        char current = body[i];
+        if (current != '\\' || i + 1 >= length) {
+            out[written++] = current;
+            continue;
+        }
+
+        char escaped = body[++i];
+        switch (escaped) {
+            case 'n': out[written++] = '\n'; break;
+            case 't': out[written++] = '\t'; break;
+            case 'r': out[written++] = '\r'; break;
+            default: out[written++] = escaped; break; // \\ \" \' and unknown
+        }
+    }
+
+    out[written] = '\0';
+    return written;
+}
+
+/*
+ * rift_tokenizer_string_value - Contents of a string literal token
+ */
+const char* rift_tokenizer_string_value(rift_tokenizer_state_t* state, size_t index,
+                                        size_t* length) {
+    if (!state || !length || index >= state->token_count) {
+        return NULL;
+    }
+
+    rift_token_t* token = &state->tokens[index];
+    if (token->type != TOKEN_LITERAL_STRING) {
+        return NULL;
+    }
+
+    // Strip the quotes from the span
+    const char* body = state->input + token->offset + 1;
+    size_t body_length = token->length - 1;
+    if (!(token->flags & RIFT_TOKEN_FLAG_UNTERMINATED) && body_length > 0) {
+        body_length--;
+    }
+
+    if (!(token->flags & RIFT_TOKEN_FLAG_HAS_ESCAPES)) {
+        *length = body_length;
+        return body;
+    }
+
+    if (!token->decoded) {
+        char* decoded = string_arena_alloc(&state->strings, body_length + 1);
+        if (!decoded) {
+            return NULL;
+        }
+        token->decoded_length = decode_string_escapes(body, body_length, decoded);
+        token->decoded = decoded;
+    }
+
+    *length = token->decoded_length;
+    return token->decoded;
+}
+
+/*
+ * rift_tokenizer_number_value - Converted value of a numeric literal token
+ */
+const rift_constant_t* rift_tokenizer_number_value(const rift_tokenizer_state_t* state,
+                                                   size_t index) {
+    if (!state || index >= state->token_count) {
+        return NULL;
+    }
+
+    size_t constant = state->tokens[index].constant_index;
+    if (constant == RIFT_NO_CONSTANT || constant >= state->constant_count) {
+        return NULL;
+    }
+    return &state->constants[constant];
+}
+
 /*
  * Helper Functions
  */
@@ -347,10 +570,9 @@ static size_t calculate_complexity_cost(rift_token_type_t type, const char* valu
 static int advance_tokenizer(rift_tokenizer_state_t* state) {
     if (state->position < state->length) {
         state->position++;
-        state->column++;
         return RIFT_SUCCESS;
     }
-    return -RIFT_ERROR_END_OF_INPUT;
+    return RIFT_ERROR_END_OF_INPUT;
 }
 
 static char peek_current(const rift_tokenizer_state_t* state) {
@@ -371,6 +593,18 @@ static char peek_next(const rift_tokenizer_state_t* state) {
  * rift_tokenizer_cleanup - Resource cleanup with AEGIS compliance
  */
 void rift_tokenizer_cleanup(rift_tokenizer_state_t* state) {
+    if (state) {
+        rift_line_index_free(&state->line_index);
+        while (state->strings.blocks) {
+            rift_string_block_t* next = state->strings.blocks->next;
+            free(state->strings.blocks);
+            state->strings.blocks = next;
+        }
+        free(state->constants);
+        state->constants = NULL;
+        state->constant_count = 0;
+        state->constant_capacity = 0;
+    }
     if (state && state->tokens) {
         free(state->tokens);
         state->tokens = NULL;
@@ -379,6 +613,17 @@ void rift_tokenizer_cleanup(rift_tokenizer_state_t* state) {
     }
 }
 
+/*
+ * rift_tokenizer_get_location - Resolve a token offset to line and column
+ */
+int rift_tokenizer_get_location(rift_tokenizer_state_t* state, size_t offset,
+                                size_t* line, size_t* column) {
+    if (!state) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+    return rift_line_index_lookup(&state->line_index, offset, line, column);
+}
+
 /*
  * rift_tokenizer_get_tokens - Access token array
  */
@@ -0,0 +1,763 @@
+/*
+ * rift/src/core/stage-1/ast.c
+ * RIFT Stage 1: Flat AST Implementation
+ * OBINexus Computing Framework - AEGIS Methodology
+ * Technical Lead: Nnamdi Michael Okpala
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "rift/core/stage-1/ast.h"
+
+// AST Storage Constants
+#define RIFT_AST_ARENA_BLOCK 16384
+#define RIFT_AST_ARENA_ALIGN 8
+#define RIFT_AST_INITIAL_SLOTS 256
+#define RIFT_AST_INITIAL_NODES 64
+#define RIFT_AST_HASH_SEED 0x9e3779b97f4a7c15ull
+
+// AST Arena Block - interned values are bump-allocated here
+struct rift_ast_block {
+    struct rift_ast_block* next;
+    size_t used;
+    size_t capacity;
+    _Alignas(RIFT_AST_ARENA_ALIGN) unsigned char data[];
+};
+
+/*
+ * AST Arena Functions
+ */
+
+/*
+ * rift_ast_arena_init - Prepare an empty arena
+ */
+void rift_ast_arena_init(rift_ast_arena_t* arena) {
+    memset(arena, 0, sizeof(*arena));
+}
+
+/*
+ * rift_ast_arena_release - Free every value in one pass over the blocks
+ */
+void rift_ast_arena_release(rift_ast_arena_t* arena) {
+    if (!arena) {
+        return;
+    }
+
+    while (arena->blocks) {
+        rift_ast_block_t* next = arena->blocks->next;
+        free(arena->blocks);
+        arena->blocks = next;
+    }
+    free(arena->symbols);
+    free(arena->slots);
+    rift_ast_arena_init(arena);
+}
+
+/*
+ * ast_arena_alloc - Bump allocation; memory lives until the arena is released
+ */
+static void* ast_arena_alloc(rift_ast_arena_t* arena, size_t size) {
+    size = (size + RIFT_AST_ARENA_ALIGN - 1) & ~(size_t)(RIFT_AST_ARENA_ALIGN - 1);
+
+    rift_ast_block_t* block = arena->blocks;
+    if (!block || block->capacity - block->used < size) {
+        size_t capacity = size > RIFT_AST_ARENA_BLOCK ? size : RIFT_AST_ARENA_BLOCK;
+        block = malloc(sizeof(rift_ast_block_t) + capacity);
+        if (!block) {
+            return NULL;
+        }
+        block->used = 0;
+        block->capacity = capacity;
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+
+    void* memory = block->data + block->used;
+    block->used += size;
+    return memory;
+}
+
+static uint64_t ast_symbol_hash(const char* text, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)text[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Structural hashing: a 64-bit finalizer keeps the fold order-sensitive
+static uint64_t ast_hash_mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+static uint64_t ast_hash_fold(uint64_t parent, uint64_t child) {
+    return ast_hash_mix(parent + child * RIFT_AST_HASH_SEED);
+}
+
+/*
+ * ast_intern_grow - Double the intern table and reinsert every symbol
+ */
+static bool ast_intern_grow(rift_ast_arena_t* arena) {
+    size_t capacity = arena->slot_capacity ? arena->slot_capacity * 2 : RIFT_AST_INITIAL_SLOTS;
+    rift_ast_symbol_t* slots = calloc(capacity, sizeof(rift_ast_symbol_t));
+    if (!slots) {
+        return false;
+    }
+
+    for (size_t i = 0; i < arena->symbol_count; i++) {
+        size_t slot = arena->symbols[i].hash & (capacity - 1);
+        while (slots[slot] != RIFT_AST_NO_SYMBOL) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        slots[slot] = (rift_ast_symbol_t)(i + 1);
+    }
+
+    free(arena->slots);
+    arena->slots = slots;
+    arena->slot_capacity = capacity;
+    return true;
+}
+
+/*
+ * rift_ast_intern - Intern a value, copying it into the arena once
+ */
+rift_ast_symbol_t rift_ast_intern(rift_ast_arena_t* arena, const char* text, size_t length) {
+    if (!arena || (!text && length > 0) || length > UINT32_MAX) {
+        return RIFT_AST_NO_SYMBOL;
+    }
+
+    // Keep the table at most half full
+    if ((arena->symbol_count + 1) * 2 > arena->slot_capacity && !ast_intern_grow(arena)) {
+        return RIFT_AST_NO_SYMBOL;
+    }
+
+    uint64_t hash = ast_symbol_hash(text, length);
+    size_t slot = hash & (arena->slot_capacity - 1);
+    while (arena->slots[slot] != RIFT_AST_NO_SYMBOL) {
+        const rift_ast_symbol_entry_t* entry = &arena->symbols[arena->slots[slot] - 1];
+        if (entry->hash == hash && entry->length == length &&
+            (length == 0 || memcmp(entry->text, text, length) == 0)) {
+            return arena->slots[slot];
+        }
+        slot = (slot + 1) & (arena->slot_capacity - 1);
+    }
+
+    if (arena->symbol_count == arena->symbol_capacity) {
+        size_t capacity = arena->symbol_capacity ? arena->symbol_capacity * 2
+                                                 : RIFT_AST_INITIAL_SLOTS / 2;
+        rift_ast_symbol_entry_t* grown = realloc(arena->symbols,
+                                                 capacity * sizeof(rift_ast_symbol_entry_t));
+        if (!grown) {
+            return RIFT_AST_NO_SYMBOL;
+        }
+        arena->symbols = grown;
+        arena->symbol_capacity = capacity;
+    }
+
+    char* copy = ast_arena_alloc(arena, length + 1);
+    if (!copy) {
+        return RIFT_AST_NO_SYMBOL;
+    }
+    if (length > 0) {
+        memcpy(copy, text, length);
+    }
+    copy[length] = '\0';
+
+    rift_ast_symbol_entry_t* entry = &arena->symbols[arena->symbol_count++];
+    entry->text = copy;
+    entry->length = (uint32_t)length;
+    entry->hash = hash;
+    arena->slots[slot] = (rift_ast_symbol_t)arena->symbol_count;
+    return arena->slots[slot];
+}
+
+/*
+ * rift_ast_symbol_text - Text of an interned value
+ */
+const char* rift_ast_symbol_text(const rift_ast_arena_t* arena, rift_ast_symbol_t symbol,
+                                 size_t* length) {
+    if (!arena || symbol == RIFT_AST_NO_SYMBOL || symbol > arena->symbol_count) {
+        if (length) {
+            *length = 0;
+        }
+        return "";
+    }
+
+    const rift_ast_symbol_entry_t* entry = &arena->symbols[symbol - 1];
+    if (length) {
+        *length = entry->length;
+    }
+    return entry->text;
+}
+
+
+/*
+ * Flat AST Functions
+ */
+
+/*
+ * rift_ast_init - Prepare an empty AST
+ */
+void rift_ast_init(rift_ast_t* ast) {
+    memset(ast, 0, sizeof(*ast));
+    rift_ast_arena_init(&ast->arena);
+}
+
+static void ast_free_arrays(rift_ast_t* ast) {
+    free(ast->kinds);
+    free(ast->values);
+    free(ast->offsets);
+    free(ast->first_child);
+    free(ast->last_child);
+    free(ast->next_sibling);
+    free(ast->child_counts);
+    free(ast->subtree_end);
+    free(ast->hashes);
+}
+
+/*
+ * rift_ast_release - Free all nodes and values
+ */
+void rift_ast_release(rift_ast_t* ast) {
+    if (!ast) {
+        return;
+    }
+
+    ast_free_arrays(ast);
+    rift_ast_arena_release(&ast->arena);
+    rift_ast_init(ast);
+}
+
+/*
+ * ast_grow_array - Resize one field array; *array is left intact on failure
+ */
+static bool ast_grow_array(void** array, size_t capacity, size_t element_size) {
+    void* grown = realloc(*array, capacity * element_size);
+    if (!grown) {
+        return false;
+    }
+    *array = grown;
+    return true;
+}
+
+static bool ast_reserve(rift_ast_t* ast, size_t needed) {
+    if (needed <= ast->capacity) {
+        return true;
+    }
+    if (needed > RIFT_AST_NONE) {
+        return false;
+    }
+
+    size_t capacity = ast->capacity ? ast->capacity * 2 : RIFT_AST_INITIAL_NODES;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    if (capacity > RIFT_AST_NONE) {
+        capacity = RIFT_AST_NONE;
+    }
+
+    if (!ast_grow_array((void**)&ast->kinds, capacity, sizeof(uint8_t)) ||
+        !ast_grow_array((void**)&ast->values, capacity, sizeof(rift_ast_symbol_t)) ||
+        !ast_grow_array((void**)&ast->offsets, capacity, sizeof(uint32_t)) ||
+        !ast_grow_array((void**)&ast->first_child, capacity, sizeof(rift_ast_id_t)) ||
+        !ast_grow_array((void**)&ast->last_child, capacity, sizeof(rift_ast_id_t)) ||
+        !ast_grow_array((void**)&ast->next_sibling, capacity, sizeof(rift_ast_id_t)) ||
+        !ast_grow_array((void**)&ast->child_counts, capacity, sizeof(uint32_t)) ||
+        !ast_grow_array((void**)&ast->subtree_end, capacity, sizeof(uint32_t)) ||
+        !ast_grow_array((void**)&ast->hashes, capacity, sizeof(uint64_t))) {
+        return false;
+    }
+
+    ast->capacity = capacity;
+    return true;
+}
+
+/*
+ * rift_ast_add_node - Append a detached node
+ */
+rift_ast_id_t rift_ast_add_node(rift_ast_t* ast, rift_ast_node_type_t type,
+                                const char* value, size_t length, size_t offset) {
+    if (!ast || !ast_reserve(ast, ast->count + 1)) {
+        return RIFT_AST_NONE;
+    }
+
+    rift_ast_symbol_t symbol = RIFT_AST_NO_SYMBOL;
+    if (value) {
+        symbol = rift_ast_intern(&ast->arena, value, length);
+        if (symbol == RIFT_AST_NO_SYMBOL) {
+            return RIFT_AST_NONE;
+        }
+    }
+
+    rift_ast_id_t id = (rift_ast_id_t)ast->count++;
+    ast->kinds[id] = (uint8_t)type;
+    ast->values[id] = symbol;
+    ast->offsets[id] = offset > UINT32_MAX ? UINT32_MAX : (uint32_t)offset;
+    ast->first_child[id] = RIFT_AST_NONE;
+    ast->last_child[id] = RIFT_AST_NONE;
+    ast->next_sibling[id] = RIFT_AST_NONE;
+    ast->child_counts[id] = 0;
+    ast->subtree_end[id] = id + 1;
+
+    // Leaf hash; add_child folds each child in
+    uint64_t value_hash = symbol != RIFT_AST_NO_SYMBOL
+                          ? ast->arena.symbols[symbol - 1].hash : 0;
+    ast->hashes[id] = ast_hash_mix(value_hash ^ ((uint64_t)type << 56) ^ RIFT_AST_HASH_SEED);
+
+    // Appending after finalize may land outside the preorder ranges
+    ast->preorder = false;
+    return id;
+}
+
+/*
+ * rift_ast_add_child - Append child as the last child of parent
+ */
+int rift_ast_add_child(rift_ast_t* ast, rift_ast_id_t parent, rift_ast_id_t child) {
+    if (!ast || parent >= ast->count || child >= ast->count || parent == child) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (ast->last_child[parent] == RIFT_AST_NONE) {
+        ast->first_child[parent] = child;
+    } else {
+        ast->next_sibling[ast->last_child[parent]] = child;
+    }
+    ast->last_child[parent] = child;
+    ast->child_counts[parent]++;
+    ast->hashes[parent] = ast_hash_fold(ast->hashes[parent], ast->hashes[child]);
+    ast->preorder = false;
+
+    return RIFT_SUCCESS;
+}
+
+/*
+ * rift_ast_finalize - Renumber the tree under root into preorder
+ *
+ * One iterative walk records the preorder sequence and each subtree's
+ * end; a second pass scatters every field into fresh arrays. In
+ * preorder a node's first child is the next id and its next sibling
+ * starts where its own subtree ends.
+ */
+int rift_ast_finalize(rift_ast_t* ast, rift_ast_id_t root) {
+    if (!ast || root >= ast->count) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    size_t count = ast->count;
+    rift_ast_id_t* order = malloc(count * sizeof(rift_ast_id_t));
+    rift_ast_id_t* renumber = malloc(count * sizeof(rift_ast_id_t));
+    rift_ast_id_t* ancestors = malloc(count * sizeof(rift_ast_id_t));
+    uint32_t* ends = malloc(count * sizeof(uint32_t));
+    if (!order || !renumber || !ancestors || !ends) {
+        free(order);
+        free(renumber);
+        free(ancestors);
+        free(ends);
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        renumber[i] = RIFT_AST_NONE;
+    }
+
+    // Preorder walk with an explicit ancestor stack
+    uint32_t emitted = 0;
+    size_t depth = 0;
+    rift_ast_id_t node = root;
+    while (node != RIFT_AST_NONE) {
+        renumber[node] = emitted;
+        order[emitted++] = node;
+
+        if (ast->first_child[node] != RIFT_AST_NONE) {
+            ancestors[depth++] = node;
+            node = ast->first_child[node];
+            continue;
+        }
+
+        // Leaf: close it and every ancestor whose last child just ended
+        ends[renumber[node]] = emitted;
+        while (node != root && ast->next_sibling[node] == RIFT_AST_NONE && depth > 0) {
+            node = ancestors[--depth];
+            ends[renumber[node]] = emitted;
+        }
+        node = (node == root) ? RIFT_AST_NONE : ast->next_sibling[node];
+    }
+    free(ancestors);
+
+    rift_ast_t sorted;
+    rift_ast_init(&sorted);
+    if (!ast_reserve(&sorted, emitted)) {
+        ast_free_arrays(&sorted);
+        free(order);
+        free(renumber);
+        free(ends);
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    for (uint32_t id = 0; id < emitted; id++) {
+        rift_ast_id_t old = order[id];
+        sorted.kinds[id] = ast->kinds[old];
+        sorted.values[id] = ast->values[old];
+        sorted.offsets[id] = ast->offsets[old];
+        sorted.child_counts[id] = ast->child_counts[old];
+        sorted.subtree_end[id] = ends[id];
+        sorted.hashes[id] = ast->hashes[old];
+        sorted.first_child[id] = ast->first_child[old] != RIFT_AST_NONE ? id + 1 : RIFT_AST_NONE;
+        sorted.last_child[id] = ast->last_child[old] != RIFT_AST_NONE
+                                ? renumber[ast->last_child[old]] : RIFT_AST_NONE;
+        sorted.next_sibling[id] = (old != root && ast->next_sibling[old] != RIFT_AST_NONE)
+                                  ? ends[id] : RIFT_AST_NONE;
+    }
+    free(order);
+    free(renumber);
+    free(ends);
+
+    // Values stay in the same arena; only the node arrays are replaced
+    ast_free_arrays(ast);
+    sorted.count = emitted;
+    sorted.preorder = true;
+    sorted.arena = ast->arena;
+    *ast = sorted;
+
+    return RIFT_SUCCESS;
+}
+
+/*
+ * ast_map_symbols - Re-intern every src symbol in dst; indexed by src id
+ */
+static rift_ast_symbol_t* ast_map_symbols(rift_ast_arena_t* dst, const rift_ast_arena_t* src) {
+    // Symbol ids are per arena
+    rift_ast_symbol_t* symbols = malloc((src->symbol_count + 1) * sizeof(rift_ast_symbol_t));
+    if (!symbols) {
+        return NULL;
+    }
+    symbols[RIFT_AST_NO_SYMBOL] = RIFT_AST_NO_SYMBOL;
+    for (size_t i = 0; i < src->symbol_count; i++) {
+        const rift_ast_symbol_entry_t* entry = &src->symbols[i];
+        symbols[i + 1] = rift_ast_intern(dst, entry->text, entry->length);
+        if (symbols[i + 1] == RIFT_AST_NO_SYMBOL) {
+            free(symbols);
+            return NULL;
+        }
+    }
+    return symbols;
+}
+
+/*
+ * rift_ast_append_children - Move another tree's top level under root
+ */
+int rift_ast_append_children(rift_ast_t* dst, const rift_ast_t* src) {
+    if (!dst || !src || !dst->preorder || !src->preorder || dst->count == 0 || src->count == 0) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    size_t added = src->count - 1;
+    if (added == 0) {
+        return RIFT_SUCCESS;
+    }
+    if (!ast_reserve(dst, dst->count + added)) {
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    rift_ast_symbol_t* symbols = ast_map_symbols(&dst->arena, &src->arena);
+    if (!symbols) {
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    // src node i becomes dst node i + shift; src's root is not copied
+    uint32_t shift = (uint32_t)dst->count - 1;
+    for (uint32_t i = 1; i < src->count; i++) {
+        uint32_t id = i + shift;
+        dst->kinds[id] = src->kinds[i];
+        dst->values[id] = symbols[src->values[i]];
+        dst->offsets[id] = src->offsets[i];
+        dst->child_counts[id] = src->child_counts[i];
+        dst->subtree_end[id] = src->subtree_end[i] + shift;
+        dst->hashes[id] = src->hashes[i];
+        dst->first_child[id] = src->first_child[i] != RIFT_AST_NONE
+                               ? src->first_child[i] + shift : RIFT_AST_NONE;
+        dst->last_child[id] = src->last_child[i] != RIFT_AST_NONE
+                              ? src->last_child[i] + shift : RIFT_AST_NONE;
+        dst->next_sibling[id] = src->next_sibling[i] != RIFT_AST_NONE
+                                ? src->next_sibling[i] + shift : RIFT_AST_NONE;
+    }
+    free(symbols);
+
+    // Chain the first copied top-level node after dst's last one
+    rift_ast_id_t first = src->first_child[RIFT_AST_ROOT] + shift;
+    if (dst->last_child[RIFT_AST_ROOT] == RIFT_AST_NONE) {
+        dst->first_child[RIFT_AST_ROOT] = first;
+    } else {
+        dst->next_sibling[dst->last_child[RIFT_AST_ROOT]] = first;
+    }
+    dst->last_child[RIFT_AST_ROOT] = src->last_child[RIFT_AST_ROOT] + shift;
+    dst->child_counts[RIFT_AST_ROOT] += src->child_counts[RIFT_AST_ROOT];
+    for (rift_ast_id_t child = first; child != RIFT_AST_NONE; child = dst->next_sibling[child]) {
+        dst->hashes[RIFT_AST_ROOT] = ast_hash_fold(dst->hashes[RIFT_AST_ROOT],
+                                                   dst->hashes[child]);
+    }
+
+    dst->count += added;
+    dst->subtree_end[RIFT_AST_ROOT] = (uint32_t)dst->count;
+    return RIFT_SUCCESS;
+}
+
+/*
+ * rift_ast_value - Text of a node's value
+ */
+const char* rift_ast_value(const rift_ast_t* ast, rift_ast_id_t node, size_t* length) {
+    if (!ast || node >= ast->count) {
+        if (length) {
+            *length = 0;
+        }
+        return "";
+    }
+    return rift_ast_symbol_text(&ast->arena, ast->values[node], length);
+}
+
+/*
+ * ast_same_node - Kind, value and child count match; children not compared
+ */
+static bool ast_same_node(const rift_ast_t* a, rift_ast_id_t x,
+                          const rift_ast_t* b, rift_ast_id_t y) {
+    if (a->kinds[x] != b->kinds[y] || a->child_counts[x] != b->child_counts[y]) {
+        return false;
+    }
+
+    size_t length_a;
+    size_t length_b;
+    const char* value_a = rift_ast_value(a, x, &length_a);
+    const char* value_b = rift_ast_value(b, y, &length_b);
+    return length_a == length_b && memcmp(value_a, value_b, length_a) == 0;
+}
+
+/*
+ * rift_ast_find_difference - Compare two finalized trees
+ */
+int rift_ast_find_difference(const rift_ast_t* a, const rift_ast_t* b,
+                             rift_ast_id_t* node_a, rift_ast_id_t* node_b) {
+    if (!a || !b || !a->preorder || !b->preorder || a->count == 0 || b->count == 0) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    rift_ast_id_t x = RIFT_AST_ROOT;
+    rift_ast_id_t y = RIFT_AST_ROOT;
+    int result = RIFT_SUCCESS;
+
+    if (a->hashes[x] != b->hashes[y] || a->count != b->count) {
+        result = RIFT_ERROR_VALIDATION_FAILED;
+
+        // Follow the first differing child until the nodes themselves differ
+        while (ast_same_node(a, x, b, y)) {
+            rift_ast_id_t child_a = a->first_child[x];
+            rift_ast_id_t child_b = b->first_child[y];
+            while (child_a != RIFT_AST_NONE && a->hashes[child_a] == b->hashes[child_b]) {
+                child_a = a->next_sibling[child_a];
+                child_b = b->next_sibling[child_b];
+            }
+            if (child_a == RIFT_AST_NONE) {
+                break;
+            }
+            x = child_a;
+            y = child_b;
+        }
+    }
+
+    if (node_a) {
+        *node_a = result == RIFT_SUCCESS ? RIFT_AST_NONE : x;
+    }
+    if (node_b) {
+        *node_b = result == RIFT_SUCCESS ? RIFT_AST_NONE : y;
+    }
+    return result;
+}
+
+
+/*
+ * Shared AST Functions
+ */
+
+/*
+ * rift_ast_dag_init - Prepare an empty shared AST
+ */
+void rift_ast_dag_init(rift_ast_dag_t* dag) {
+    memset(dag, 0, sizeof(*dag));
+    rift_ast_arena_init(&dag->arena);
+}
+
+/*
+ * rift_ast_dag_release - Free all shared nodes and values
+ */
+void rift_ast_dag_release(rift_ast_dag_t* dag) {
+    if (!dag) {
+        return;
+    }
+
+    free(dag->kinds);
+    free(dag->values);
+    free(dag->offsets);
+    free(dag->child_counts);
+    free(dag->first_edge);
+    free(dag->hashes);
+    free(dag->edges);
+    free(dag->slots);
+    rift_ast_arena_release(&dag->arena);
+    rift_ast_dag_init(dag);
+}
+
+static bool dag_reserve(rift_ast_dag_t* dag, size_t edges) {
+    if (dag->count == dag->capacity) {
+        if (dag->count >= RIFT_AST_NONE) {
+            return false;
+        }
+        size_t capacity = dag->capacity ? dag->capacity * 2 : RIFT_AST_INITIAL_NODES;
+        if (capacity > RIFT_AST_NONE) {
+            capacity = RIFT_AST_NONE;
+        }
+        if (!ast_grow_array((void**)&dag->kinds, capacity, sizeof(uint8_t)) ||
+            !ast_grow_array((void**)&dag->values, capacity, sizeof(rift_ast_symbol_t)) ||
+            !ast_grow_array((void**)&dag->offsets, capacity, sizeof(uint32_t)) ||
+            !ast_grow_array((void**)&dag->child_counts, capacity, sizeof(uint32_t)) ||
+            !ast_grow_array((void**)&dag->first_edge, capacity, sizeof(uint32_t)) ||
+            !ast_grow_array((void**)&dag->hashes, capacity, sizeof(uint64_t))) {
+            return false;
+        }
+        dag->capacity = capacity;
+    }
+
+    size_t needed = dag->edge_count + edges;
+    if (needed > dag->edge_capacity) {
+        if (needed > UINT32_MAX) {
+            return false;
+        }
+        size_t capacity = dag->edge_capacity ? dag->edge_capacity * 2 : RIFT_AST_INITIAL_NODES;
+        while (capacity < needed) {
+            capacity *= 2;
+        }
+        if (!ast_grow_array((void**)&dag->edges, capacity, sizeof(rift_ast_id_t))) {
+            return false;
+        }
+        dag->edge_capacity = capacity;
+    }
+    return true;
+}
+
+/*
+ * dag_slots_grow - Double the intern table and reinsert every node
+ */
+static bool dag_slots_grow(rift_ast_dag_t* dag) {
+    size_t capacity = dag->slot_capacity ? dag->slot_capacity * 2 : RIFT_AST_INITIAL_SLOTS;
+    rift_ast_id_t* slots = calloc(capacity, sizeof(rift_ast_id_t));
+    if (!slots) {
+        return false;
+    }
+
+    for (size_t id = 0; id < dag->count; id++) {
+        size_t slot = dag->hashes[id] & (capacity - 1);
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        slots[slot] = (rift_ast_id_t)(id + 1);
+    }
+
+    free(dag->slots);
+    dag->slots = slots;
+    dag->slot_capacity = capacity;
+    return true;
+}
+
+/*
+ * rift_ast_dag_intern - Add a finalized tree, sharing repeated subtrees
+ *
+ * In preorder every child has a larger id than its parent, so walking
+ * the ids downwards meets each node after its children have been
+ * shared. Two nodes are then the same subtree exactly when kind,
+ * value and the list of shared child ids match; the Merkle hash only
+ * picks the bucket.
+ */
+int rift_ast_dag_intern(rift_ast_dag_t* dag, const rift_ast_t* tree, rift_ast_id_t* root) {
+    if (!dag || !tree || !root || !tree->preorder || tree->count == 0) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    rift_ast_symbol_t* symbols = ast_map_symbols(&dag->arena, &tree->arena);
+    rift_ast_id_t* shared = malloc(tree->count * sizeof(rift_ast_id_t));
+    rift_ast_id_t* children = malloc(tree->count * sizeof(rift_ast_id_t));
+    if (!symbols || !shared || !children) {
+        free(symbols);
+        free(shared);
+        free(children);
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    size_t first_added = dag->count;
+    int result = RIFT_SUCCESS;
+    for (size_t i = tree->count; i-- > 0;) {
+        uint32_t child_count = 0;
+        for (rift_ast_id_t child = tree->first_child[i]; child != RIFT_AST_NONE;
+             child = tree->next_sibling[child]) {
+            children[child_count++] = shared[child];
+        }
+        rift_ast_symbol_t value = symbols[tree->values[i]];
+        uint64_t hash = tree->hashes[i];
+
+        // Keep the table at most half full
+        if ((dag->count + 1) * 2 > dag->slot_capacity && !dag_slots_grow(dag)) {
+            result = RIFT_ERROR_MEMORY_ALLOCATION;
+            break;
+        }
+
+        size_t slot = hash & (dag->slot_capacity - 1);
+        rift_ast_id_t node = RIFT_AST_NONE;
+        while (dag->slots[slot] != 0) {
+            rift_ast_id_t candidate = dag->slots[slot] - 1;
+            if (dag->hashes[candidate] == hash && dag->kinds[candidate] == tree->kinds[i] &&
+                dag->values[candidate] == value && dag->child_counts[candidate] == child_count &&
+                (child_count == 0 || memcmp(&dag->edges[dag->first_edge[candidate]], children,
+                                            child_count * sizeof(rift_ast_id_t)) == 0)) {
+                node = candidate;
+                break;
+            }
+            slot = (slot + 1) & (dag->slot_capacity - 1);
+        }
+
+        if (node == RIFT_AST_NONE) {
+            if (!dag_reserve(dag, child_count)) {
+                result = RIFT_ERROR_MEMORY_ALLOCATION;
+                break;
+            }
+            node = (rift_ast_id_t)dag->count++;
+            dag->kinds[node] = tree->kinds[i];
+            dag->values[node] = value;
+            dag->child_counts[node] = child_count;
+            dag->first_edge[node] = (uint32_t)dag->edge_count;
+            dag->hashes[node] = hash;
+            if (child_count > 0) {
+                memcpy(&dag->edges[dag->edge_count], children, child_count * sizeof(rift_ast_id_t));
+            }
+            dag->edge_count += child_count;
+            dag->slots[slot] = node + 1;
+        }
+
+        // Walking downwards, a later repeat is earlier in the source
+        if (node >= first_added) {
+            dag->offsets[node] = tree->offsets[i];
+        }
+        shared[i] = node;
+    }
+
+    if (result == RIFT_SUCCESS) {
+        *root = shared[RIFT_AST_ROOT];
+    }
+    free(symbols);
+    free(shared);
+    free(children);
+    return result;
+}
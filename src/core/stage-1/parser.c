@@ -15,12 +15,24 @@
 #include "rift/governance/policy.h"
 
 // AEGIS Parser Constants
-#define RIFT_MAX_AST_CHILDREN 32
 #define RIFT_MAX_PARSE_DEPTH 64
+#define RIFT_EXPRESSION_STACK_INITIAL 32
+#define RIFT_OPEN_PAREN RIFT_OP_COUNT
+
+#define RIFT_OPERATOR_KEY(c0, c1, c2) \
+    ((uint32_t)(unsigned char)(c0) | ((uint32_t)(unsigned char)(c1) << 8) | \
+     ((uint32_t)(unsigned char)(c2) << 16))
+
+// Operator table, generated from operators.def
+const rift_operator_info_t rift_operator_table[RIFT_OP_COUNT] = {
+#define RIFT_OPERATOR(name, text, c0, c1, c2, binary, assoc, prefix) \
+    [RIFT_OP_##name] = { text, binary, RIFT_ASSOC_##assoc, prefix },
+#include "rift/core/stage-1/operators.def"
+#undef RIFT_OPERATOR
+};
 
 // Forward declarations
-static rift_token_t current_token(const rift_parser_state_t* state);
-static rift_token_t peek_token(const rift_parser_state_t* state, size_t offset);
+static rift_token_type_t current_type(const rift_parser_state_t* state);
 static int advance_parser(rift_parser_state_t* state);
 static bool match_token_type(const rift_parser_state_t* state, rift_token_type_t type);
 static int expect_token_type(rift_parser_state_t* state, rift_token_type_t type);
@@ -34,11 +46,28 @@ int rift_parser_init(const rift_token_t* tokens, size_t token_count,
         return RIFT_ERROR_INVALID_ARGUMENT;
     }
 
+    // Token types once, one byte each; the descent parser dispatches on
+    // these and reads a token record only to build a node from it
+    uint8_t* token_types = malloc(token_count);
+    if (!token_types) {
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+    for (size_t i = 0; i < token_count; i++) {
+        token_types[i] = (uint8_t)tokens[i].type;
+    }
+
     // Initialize parser state
     state->tokens = tokens;
+    state->token_types = token_types;
     state->token_count = token_count;
     state->current_position = 0;
-    state->root = NULL;
+    rift_ast_init(&state->ast);
+    memset(&state->expression, 0, sizeof(state->expression));
+    state->thread_count = 1;
+    state->bottom_up = false;
+    state->dag = NULL;
+    state->dag_root = RIFT_AST_NONE;
+    state->tokenizer = NULL;
     state->aegis_validation_enabled = true;
 
     // Initialize error context
@@ -49,6 +78,44 @@ int rift_parser_init(const rift_token_t* tokens, size_t token_count,
     return RIFT_SUCCESS;
 }
 
+/*
+ * rift_parser_set_tokenizer - Attach the tokenizer that produced the tokens
+ */
+void rift_parser_set_tokenizer(rift_parser_state_t* state,
+                               rift_tokenizer_state_t* tokenizer) {
+    if (state) {
+        state->tokenizer = tokenizer;
+    }
+}
+
+/*
+ * rift_parser_set_threads - Parse top-level statements in parallel
+ */
+void rift_parser_set_threads(rift_parser_state_t* state, size_t thread_count) {
+    if (state) {
+        state->thread_count = thread_count > RIFT_MAX_PARSER_THREADS
+                              ? RIFT_MAX_PARSER_THREADS : thread_count;
+    }
+}
+
+/*
+ * rift_parser_set_bottom_up - Select the table-driven LALR(1) parser
+ */
+void rift_parser_set_bottom_up(rift_parser_state_t* state, bool enabled) {
+    if (state) {
+        state->bottom_up = enabled;
+    }
+}
+
+/*
+ * rift_parser_set_shared_output - Hash-cons parse results into a DAG
+ */
+void rift_parser_set_shared_output(rift_parser_state_t* state, rift_ast_dag_t* dag) {
+    if (state) {
+        state->dag = dag;
+    }
+}
+
 /*
  * rift_parser_process - Main parsing processing function
  */
@@ -57,120 +124,153 @@ int rift_parser_process(rift_parser_state_t* state) {
         return RIFT_ERROR_INVALID_STATE;
     }
 
-    // Create root program node
-    state->root = rift_ast_node_create(AST_NODE_PROGRAM, "program");
-    if (!state->root) {
-        return RIFT_ERROR_MEMORY_ALLOCATION;
+    // A previous tree is dropped as a whole
+    rift_ast_release(&state->ast);
+    state->current_position = 0;
+    state->dag_root = RIFT_AST_NONE;
+
+    int result;
+    if (state->bottom_up) {
+        result = rift_parser_process_bottom_up(state);
+    } else if (state->thread_count > 1 && state->token_count >= RIFT_PARALLEL_MIN_TOKENS) {
+        result = rift_parser_process_parallel(state);
+    } else if (rift_ast_add_node(&state->ast, AST_NODE_PROGRAM, "program", 7, 0)
+               == RIFT_AST_NONE) {
+        // The program node is the first node, RIFT_AST_ROOT
+        result = RIFT_ERROR_MEMORY_ALLOCATION;
+    } else {
+        // Parse program, then lay the tree out in preorder
+        result = rift_parse_program(state);
+        if (result == RIFT_SUCCESS) {
+            result = rift_ast_finalize(&state->ast, RIFT_AST_ROOT);
+        }
     }
-
-    // Parse program
-    int result = rift_parse_program(state);
     if (result != RIFT_SUCCESS) {
-        rift_ast_node_destroy(state->root);
-        state->root = NULL;
+        rift_ast_release(&state->ast);
         return result;
     }
 
     // AEGIS governance validation
     if (state->aegis_validation_enabled) {
-        result = rift_governance_validate_ast_tree(state->root);
+        result = rift_governance_validate_ast_tree(&state->ast);
         if (result != RIFT_SUCCESS) {
             return RIFT_ERROR_GOVERNANCE_VIOLATION;
         }
     }
 
-    return RIFT_SUCCESS;
+    // Only the shared form is kept
+    if (state->dag) {
+        result = rift_ast_dag_intern(state->dag, &state->ast, &state->dag_root);
+        rift_ast_release(&state->ast);
+    }
+
+    return result;
 }
 
 /*
  * rift_parser_cleanup - Resource cleanup
  */
 void rift_parser_cleanup(rift_parser_state_t* state) {
-    if (state && state->root) {
-        rift_ast_node_destroy(state->root);
-        state->root = NULL;
+    if (state) {
+        rift_ast_release(&state->ast);
+        free(state->token_types);
+        state->token_types = NULL;
+        free(state->expression.operands);
+        free(state->expression.operators);
+        memset(&state->expression, 0, sizeof(state->expression));
     }
 }
 
 /*
- * rift_parser_get_ast - Get parsed AST root
- */
-const rift_ast_node_t* rift_parser_get_ast(const rift_parser_state_t* state) {
-    return state ? state->root : NULL;
-}
-
-/*
- * AST Node Management Functions
+ * rift_parser_validate_consistency - Compare with the other parser's tree
  */
+int rift_parser_validate_consistency(rift_parser_state_t* state, rift_ast_id_t* difference) {
+    if (difference) {
+        *difference = RIFT_AST_NONE;
+    }
+    if (!state || !state->ast.preorder) {
+        return RIFT_ERROR_INVALID_STATE;
+    }
 
-/*
- * rift_ast_node_create - Create new AST node
- */
-rift_ast_node_t* rift_ast_node_create(rift_ast_node_type_t type, const char* value) {
-    rift_ast_node_t* node = malloc(sizeof(rift_ast_node_t));
-    if (!node) {
-        return NULL;
-    }
-
-    node->type = type;
-    node->matched_state = 0;
-    node->child_count = 0;
-    node->child_capacity = RIFT_MAX_AST_CHILDREN;
-    node->complexity_score = 1;
-
-    // Initialize value
-    if (value) {
-        strncpy(node->value, value, sizeof(node->value) - 1);
-        node->value[sizeof(node->value) - 1] = '\0';
-    } else {
-        node->value[0] = '\0';
+    // Same tokens, own tree and stacks
+    rift_parser_state_t other = *state;
+    rift_ast_init(&other.ast);
+    memset(&other.expression, 0, sizeof(other.expression));
+    other.bottom_up = !state->bottom_up;
+    other.dag = NULL;
+    other.aegis_validation_enabled = false;
+
+    rift_ast_id_t node = RIFT_AST_NONE;
+    char message[RIFT_MAX_ERROR_MESSAGE_LENGTH];
+    int result = rift_parser_process(&other);
+    if (result == RIFT_SUCCESS) {
+        result = rift_ast_find_difference(&state->ast, &other.ast, &node, NULL);
+        if (result == RIFT_ERROR_VALIDATION_FAILED) {
+            snprintf(message, sizeof(message), "Parsers disagree at offset %u",
+                     (unsigned)state->ast.offsets[node]);
+        }
+    } else if (result == RIFT_ERROR_UNEXPECTED_TOKEN && other.bottom_up) {
+        // The descent parser accepts a superset of stage-1.grammar; input
+        // outside the grammar has no second tree to compare against
+        const rift_token_t* token = other.current_position < state->token_count
+                                    ? &state->tokens[other.current_position] : NULL;
+        snprintf(message, sizeof(message), "Not compared: '%s' at offset %u is outside the grammar",
+                 token ? token->value : "", token ? (unsigned)token->offset : 0u);
+        rift_error_context_init(&state->error_context, RIFT_SUCCESS, message, NULL,
+                                "rift_parser_validate_consistency", "stage-1-parser");
+        result = RIFT_SUCCESS;
+    } else if (result != RIFT_ERROR_MEMORY_ALLOCATION && !other.bottom_up) {
+        // The grammar accepted input the descent parser rejects
+        node = RIFT_AST_ROOT;
+        snprintf(message, sizeof(message), "Descent parser rejects grammar input (error %d)",
+                 result);
+        result = RIFT_ERROR_VALIDATION_FAILED;
     }
 
-    // Allocate children array
-    node->children = malloc(sizeof(rift_ast_node_t*) * RIFT_MAX_AST_CHILDREN);
-    if (!node->children) {
-        free(node);
-        return NULL;
+    if (result == RIFT_ERROR_VALIDATION_FAILED) {
+        rift_error_context_init(&state->error_context, RIFT_ERROR_VALIDATION_FAILED,
+                                message, NULL, "rift_parser_validate_consistency",
+                                "stage-1-parser");
+        if (difference) {
+            *difference = node;
+        }
     }
 
-    return node;
+    other.token_types = NULL;           // Borrowed from state
+    rift_parser_cleanup(&other);
+    return result;
 }
 
 /*
- * rift_ast_node_add_child - Add child node
+ * rift_parser_get_ast - Get parsed AST root
  */
-int rift_ast_node_add_child(rift_ast_node_t* parent, rift_ast_node_t* child) {
-    if (!parent || !child) {
-        return RIFT_ERROR_INVALID_ARGUMENT;
-    }
-
-    if (parent->child_count >= parent->child_capacity) {
-        return RIFT_ERROR_BUFFER_OVERFLOW;
-    }
-
-    parent->children[parent->child_count] = child;
-    parent->child_count++;
-    parent->complexity_score += child->complexity_score;
-
-    return RIFT_SUCCESS;
+const rift_ast_t* rift_parser_get_ast(const rift_parser_state_t* state) {
+    return state && state->ast.preorder ? &state->ast : NULL;
 }
 
 /*
- * rift_ast_node_destroy - Destroy AST node and children
+ * rift_operator_lookup - Classify an operator token
  */
-void rift_ast_node_destroy(rift_ast_node_t* node) {
-    if (!node) {
-        return;
+rift_operator_t rift_operator_lookup(const char* text) {
+    if (!text || text[0] == '\0') {
+        return RIFT_OP_COUNT;
     }
 
-    // Destroy all children recursively
-    for (size_t i = 0; i < node->child_count; i++) {
-        rift_ast_node_destroy(node->children[i]);
+    size_t length = text[1] == '\0' ? 1 : text[2] == '\0' ? 2 : text[3] == '\0' ? 3 : 0;
+    if (length == 0) {
+        return RIFT_OP_COUNT;
     }
 
-    // Free children array and node
-    free(node->children);
-    free(node);
+    uint32_t key = RIFT_OPERATOR_KEY(text[0], length > 1 ? text[1] : 0,
+                                     length > 2 ? text[2] : 0);
+    switch (key) {
+#define RIFT_OPERATOR(name, text, c0, c1, c2, binary, assoc, prefix) \
+        case RIFT_OPERATOR_KEY(c0, c1, c2): return RIFT_OP_##name;
+#include "rift/core/stage-1/operators.def"
+#undef RIFT_OPERATOR
+        default:
+            return RIFT_OP_COUNT;
+    }
 }
 
 /*
@@ -182,23 +282,20 @@ void rift_ast_node_destroy(rift_ast_node_t* node) {
  */
 int rift_parse_program(rift_parser_state_t* state) {
     while (state->current_position < state->token_count) {
-        rift_token_t token = current_token(state);
-        
         // Skip EOF token
-        if (token.type == TOKEN_EOF) {
+        if (current_type(state) == TOKEN_EOF) {
             break;
         }
 
-        rift_ast_node_t* statement = NULL;
+        rift_ast_id_t statement = RIFT_AST_NONE;
         int result = rift_parse_statement(state, &statement);
         if (result != RIFT_SUCCESS) {
             return result;
         }
 
-        if (statement) {
-            result = rift_ast_node_add_child(state->root, statement);
+        if (statement != RIFT_AST_NONE) {
+            result = rift_ast_add_child(&state->ast, RIFT_AST_ROOT, statement);
             if (result != RIFT_SUCCESS) {
-                rift_ast_node_destroy(statement);
                 return result;
             }
         }
@@ -210,75 +307,279 @@ int rift_parse_program(rift_parser_state_t* state) {
 /*
  * rift_parse_statement - Parse statement
  */
-int rift_parse_statement(rift_parser_state_t* state, rift_ast_node_t** result) {
-    rift_token_t token = current_token(state);
+int rift_parse_statement(rift_parser_state_t* state, rift_ast_id_t* result) {
+    rift_token_type_t type = current_type(state);
+    const rift_token_t* token = &state->tokens[state->current_position];
     
-    switch (token.type) {
+    switch (type) {
         case TOKEN_KEYWORD:
-            if (strcmp(token.value, "let") == 0 || strcmp(token.value, "const") == 0) {
+            if (strcmp(token->value, "let") == 0 || strcmp(token->value, "const") == 0) {
                 return rift_parse_declaration(state, result);
             }
             break;
             
         case TOKEN_IDENTIFIER:
+        case TOKEN_LITERAL_INTEGER:
+        case TOKEN_LITERAL_FLOAT:
+        case TOKEN_LITERAL_STRING:
+        case TOKEN_OPERATOR:
             return rift_parse_expression(state, result);
             
+        case TOKEN_PUNCTUATION:
+            if (strcmp(token->value, "(") == 0) {
+                return rift_parse_expression(state, result);
+            }
+            advance_parser(state);
+            *result = RIFT_AST_NONE;
+            return RIFT_SUCCESS;
+            
         default:
             // Skip unknown tokens
             advance_parser(state);
-            *result = NULL;
+            *result = RIFT_AST_NONE;
             return RIFT_SUCCESS;
     }
 
     advance_parser(state);
-    *result = NULL;
+    *result = RIFT_AST_NONE;
+    return RIFT_SUCCESS;
+}
+
+/*
+ * Expression stack helpers
+ */
+
+static bool push_operand(rift_expression_stack_t* stack, rift_ast_id_t node) {
+    if (stack->operand_count == stack->operand_capacity) {
+        size_t capacity = stack->operand_capacity ? stack->operand_capacity * 2
+                                                  : RIFT_EXPRESSION_STACK_INITIAL;
+        rift_ast_id_t* grown = realloc(stack->operands, capacity * sizeof(rift_ast_id_t));
+        if (!grown) {
+            return false;
+        }
+        stack->operands = grown;
+        stack->operand_capacity = capacity;
+    }
+    stack->operands[stack->operand_count++] = node;
+    return true;
+}
+
+static bool push_operator(rift_expression_stack_t* stack, uint8_t op, bool prefix,
+                          size_t offset) {
+    if (stack->operator_count == stack->operator_capacity) {
+        size_t capacity = stack->operator_capacity ? stack->operator_capacity * 2
+                                                   : RIFT_EXPRESSION_STACK_INITIAL;
+        rift_pending_operator_t* grown = realloc(stack->operators,
+                                                 capacity * sizeof(rift_pending_operator_t));
+        if (!grown) {
+            return false;
+        }
+        stack->operators = grown;
+        stack->operator_capacity = capacity;
+    }
+
+    rift_pending_operator_t* entry = &stack->operators[stack->operator_count++];
+    entry->offset = offset > UINT32_MAX ? UINT32_MAX : (uint32_t)offset;
+    entry->op = op;
+    entry->prefix = prefix;
+    return true;
+}
+
+static uint8_t pending_precedence(const rift_pending_operator_t* entry) {
+    const rift_operator_info_t* info = &rift_operator_table[entry->op];
+    return entry->prefix ? info->prefix_precedence : info->binary_precedence;
+}
+
+/*
+ * reduce_operator - Pop the top operator and its operands into one node
+ */
+static int reduce_operator(rift_parser_state_t* state) {
+    rift_expression_stack_t* stack = &state->expression;
+    rift_pending_operator_t entry = stack->operators[--stack->operator_count];
+    const rift_operator_info_t* info = &rift_operator_table[entry.op];
+
+    size_t arity = entry.prefix ? 1 : 2;
+    if (stack->operand_count < arity) {
+        return RIFT_ERROR_INVALID_EXPRESSION;
+    }
+
+    rift_ast_node_type_t type = entry.prefix ? AST_NODE_UNARY_OP
+                              : info->binary_precedence == 1 ? AST_NODE_ASSIGNMENT
+                              : AST_NODE_BINARY_OP;
+    rift_ast_id_t node = rift_ast_add_node(&state->ast, type, info->text,
+                                           strlen(info->text), entry.offset);
+    if (node == RIFT_AST_NONE) {
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    size_t first = stack->operand_count - arity;
+    for (size_t i = first; i < stack->operand_count; i++) {
+        int result = rift_ast_add_child(&state->ast, node, stack->operands[i]);
+        if (result != RIFT_SUCCESS) {
+            return result;
+        }
+    }
+    stack->operand_count = first;
+    stack->operands[stack->operand_count++] = node;
     return RIFT_SUCCESS;
 }
 
+static bool is_punctuation(rift_token_type_t type, const rift_token_t* token, char c) {
+    return type == TOKEN_PUNCTUATION && token->value[0] == c && token->value[1] == '\0';
+}
+
 /*
  * rift_parse_expression - Parse expression
+ *
+ * Operator precedence parsing over explicit operand/operator stacks:
+ * no recursion, so expressions nest as deep as memory allows. Binding
+ * power and associativity come from rift_operator_table. Operands are
+ * identifiers, literals and parenthesized expressions; the expression
+ * ends at the first token that cannot continue it.
  */
-int rift_parse_expression(rift_parser_state_t* state, rift_ast_node_t** result) {
-    rift_token_t token = current_token(state);
-    
-    // Simple expression parsing (identifier or literal)
-    if (token.type == TOKEN_IDENTIFIER || 
-        token.type == TOKEN_LITERAL_INTEGER ||
-        token.type == TOKEN_LITERAL_FLOAT ||
-        token.type == TOKEN_LITERAL_STRING) {
-        
-        rift_ast_node_t* node = rift_ast_node_create(AST_NODE_EXPRESSION, token.value);
-        if (!node) {
+int rift_parse_expression(rift_parser_state_t* state, rift_ast_id_t* result) {
+    rift_expression_stack_t* stack = &state->expression;
+    stack->operand_count = 0;
+    stack->operator_count = 0;
+
+    size_t open_parens = 0;
+    bool expect_operand = true;
+    int status = RIFT_SUCCESS;
+
+    while (status == RIFT_SUCCESS) {
+        rift_token_type_t type = current_type(state);
+        if (type == TOKEN_EOF) {
+            break;
+        }
+        const rift_token_t* token = &state->tokens[state->current_position];
+
+        if (expect_operand) {
+            if (type == TOKEN_IDENTIFIER ||
+                type == TOKEN_LITERAL_INTEGER ||
+                type == TOKEN_LITERAL_FLOAT ||
+                type == TOKEN_LITERAL_STRING) {
+                const char* value = token->value;
+                size_t length = strlen(token->value);
+                
+                // String values are decoded only here, on demand
+                if (type == TOKEN_LITERAL_STRING && state->tokenizer) {
+                    const char* text = rift_tokenizer_string_value(state->tokenizer,
+                                                                   state->current_position,
+                                                                   &length);
+                    if (text) {
+                        value = text;
+                    } else {
+                        length = 0;
+                    }
+                }
+                
+                rift_ast_id_t node = rift_ast_add_node(&state->ast,
+                                                       type == TOKEN_IDENTIFIER
+                                                       ? AST_NODE_IDENTIFIER : AST_NODE_LITERAL,
+                                                       value, length, token->offset);
+                if (node == RIFT_AST_NONE || !push_operand(stack, node)) {
+                    return RIFT_ERROR_MEMORY_ALLOCATION;
+                }
+                expect_operand = false;
+            } else if (is_punctuation(type, token, '(')) {
+                if (!push_operator(stack, RIFT_OPEN_PAREN, false, token->offset)) {
+                    return RIFT_ERROR_MEMORY_ALLOCATION;
+                }
+                open_parens++;
+            } else {
+                rift_operator_t op = type == TOKEN_OPERATOR
+                                     ? rift_operator_lookup(token->value) : RIFT_OP_COUNT;
+                if (op == RIFT_OP_COUNT || rift_operator_table[op].prefix_precedence == 0) {
+                    break;
+                }
+                if (!push_operator(stack, (uint8_t)op, true, token->offset)) {
+                    return RIFT_ERROR_MEMORY_ALLOCATION;
+                }
+            }
+            advance_parser(state);
+            continue;
+        }
+
+        // After an operand: an infix operator, a closing paren, or the end
+        if (is_punctuation(type, token, ')') && open_parens > 0) {
+            while (status == RIFT_SUCCESS &&
+                   stack->operators[stack->operator_count - 1].op != RIFT_OPEN_PAREN) {
+                status = reduce_operator(state);
+            }
+            stack->operator_count--;
+            open_parens--;
+            advance_parser(state);
+            continue;
+        }
+
+        rift_operator_t op = type == TOKEN_OPERATOR
+                             ? rift_operator_lookup(token->value) : RIFT_OP_COUNT;
+        if (op == RIFT_OP_COUNT || rift_operator_table[op].binary_precedence == 0) {
+            break;
+        }
+
+        // Reduce everything that binds at least as tightly
+        uint8_t precedence = rift_operator_table[op].binary_precedence;
+        bool right = rift_operator_table[op].associativity == RIFT_ASSOC_RIGHT;
+        while (status == RIFT_SUCCESS && stack->operator_count > 0) {
+            const rift_pending_operator_t* top = &stack->operators[stack->operator_count - 1];
+            if (top->op == RIFT_OPEN_PAREN) {
+                break;
+            }
+            uint8_t top_precedence = pending_precedence(top);
+            if (top_precedence < precedence || (right && top_precedence == precedence)) {
+                break;
+            }
+            status = reduce_operator(state);
+        }
+        if (status == RIFT_SUCCESS && !push_operator(stack, (uint8_t)op, false, token->offset)) {
             return RIFT_ERROR_MEMORY_ALLOCATION;
         }
-        
-        node->location = (rift_source_location_t){
-            .filename = "",
-            .line_number = token.line_number,
-            .column_number = token.column_number,
-            .character_offset = 0
-        };
-        
+        expect_operand = true;
+        advance_parser(state);
+    }
+
+    if (status != RIFT_SUCCESS) {
+        return status;
+    }
+
+    // Nothing that starts an expression: skip the token as before
+    if (stack->operand_count == 0 && stack->operator_count == 0) {
         advance_parser(state);
-        *result = node;
+        *result = RIFT_AST_NONE;
         return RIFT_SUCCESS;
     }
 
-    // Skip unexpected tokens
-    advance_parser(state);
-    *result = NULL;
+    if (expect_operand) {
+        return RIFT_ERROR_INVALID_EXPRESSION;
+    }
+    if (open_parens > 0) {
+        return RIFT_ERROR_UNMATCHED_PARENTHESES;
+    }
+
+    while (stack->operator_count > 0) {
+        status = reduce_operator(state);
+        if (status != RIFT_SUCCESS) {
+            return status;
+        }
+    }
+
+    *result = stack->operands[0];
     return RIFT_SUCCESS;
 }
 
 /*
  * rift_parse_declaration - Parse declaration
  */
-int rift_parse_declaration(rift_parser_state_t* state, rift_ast_node_t** result) {
-    rift_token_t keyword_token = current_token(state);
+int rift_parse_declaration(rift_parser_state_t* state, rift_ast_id_t* result) {
+    const rift_token_t* keyword_token = &state->tokens[state->current_position];
     
     // Create declaration node
-    rift_ast_node_t* decl_node = rift_ast_node_create(AST_NODE_DECLARATION, keyword_token.value);
-    if (!decl_node) {
+    rift_ast_id_t decl_node = rift_ast_add_node(&state->ast, AST_NODE_DECLARATION,
+                                                keyword_token->value,
+                                                strlen(keyword_token->value),
+                                                keyword_token->offset);
+    if (decl_node == RIFT_AST_NONE) {
         return RIFT_ERROR_MEMORY_ALLOCATION;
     }
     
@@ -286,30 +587,41 @@ int rift_parse_declaration(rift_parser_state_t* state, rift_ast_node_t** result)
     
     // Expect identifier
     if (expect_token_type(state, TOKEN_IDENTIFIER) != RIFT_SUCCESS) {
-        rift_ast_node_destroy(decl_node);
         return RIFT_ERROR_SYNTAX_ERROR;
     }
     
-    rift_token_t id_token = current_token(state);
-    rift_ast_node_t* id_node = rift_ast_node_create(AST_NODE_IDENTIFIER, id_token.value);
-    if (!id_node) {
-        rift_ast_node_destroy(decl_node);
+    const rift_token_t* id_token = &state->tokens[state->current_position];
+    rift_ast_id_t id_node = rift_ast_add_node(&state->ast, AST_NODE_IDENTIFIER,
+                                              id_token->value, strlen(id_token->value),
+                                              id_token->offset);
+    if (id_node == RIFT_AST_NONE) {
         return RIFT_ERROR_MEMORY_ALLOCATION;
     }
     
-    rift_ast_node_add_child(decl_node, id_node);
+    int status = rift_ast_add_child(&state->ast, decl_node, id_node);
+    if (status != RIFT_SUCCESS) {
+        return status;
+    }
     advance_parser(state);
     
     // Optional assignment
     if (match_token_type(state, TOKEN_OPERATOR)) {
-        rift_token_t op_token = current_token(state);
-        if (strcmp(op_token.value, "=") == 0) {
+        const rift_token_t* op_token = &state->tokens[state->current_position];
+        if (strcmp(op_token->value, "=") == 0) {
             advance_parser(state); // Skip '='
             
-            rift_ast_node_t* expr_node = NULL;
-            int result = rift_parse_expression(state, &expr_node);
-            if (result == RIFT_SUCCESS && expr_node) {
-                rift_ast_node_add_child(decl_node, expr_node);
+            rift_ast_id_t expr_node = RIFT_AST_NONE;
+            status = rift_parse_expression(state, &expr_node);
+            if (status != RIFT_SUCCESS) {
+                return status;
+            }
+            // '=' must be followed by an initializer
+            if (expr_node == RIFT_AST_NONE) {
+                return RIFT_ERROR_INVALID_EXPRESSION;
+            }
+            status = rift_ast_add_child(&state->ast, decl_node, expr_node);
+            if (status != RIFT_SUCCESS) {
+                return status;
             }
         }
     }
@@ -322,26 +634,16 @@ int rift_parse_declaration(rift_parser_state_t* state, rift_ast_node_t** result)
  * Helper Functions
  */
 
-static rift_token_t current_token(const rift_parser_state_t* state) {
-    if (state->current_position < state->token_count) {
-        return state->tokens[state->current_position];
-    }
-    
-    // Return EOF token if at end
-    rift_token_t eof_token = {0};
-    eof_token.type = TOKEN_EOF;
-    return eof_token;
+/*
+ * token_type_at - Type of the token at index; lookahead is index + k
+ */
+static inline rift_token_type_t token_type_at(const rift_parser_state_t* state, size_t index) {
+    // Past the end reads as EOF
+    return index < state->token_count ? (rift_token_type_t)state->token_types[index] : TOKEN_EOF;
 }
 
-static rift_token_t peek_token(const rift_parser_state_t* state, size_t offset) {
-    size_t peek_pos = state->current_position + offset;
-    if (peek_pos < state->token_count) {
-        return state->tokens[peek_pos];
-    }
-    
-    rift_token_t eof_token = {0};
-    eof_token.type = TOKEN_EOF;
-    return eof_token;
+static rift_token_type_t current_type(const rift_parser_state_t* state) {
+    return token_type_at(state, state->current_position);
 }
 
 static int advance_parser(rift_parser_state_t* state) {
@@ -353,8 +655,7 @@ static int advance_parser(rift_parser_state_t* state) {
 }
 
 static bool match_token_type(const rift_parser_state_t* state, rift_token_type_t type) {
-    rift_token_t token = current_token(state);
-    return token.type == type;
+    return current_type(state) == type;
 }
 
 static int expect_token_type(rift_parser_state_t* state, rift_token_type_t type) {
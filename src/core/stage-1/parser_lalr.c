@@ -0,0 +1,293 @@
+/*
+ * rift/src/core/stage-1/parser_lalr.c
+ * RIFT Stage 1: Table-Driven LALR(1) Parser
+ * OBINexus Computing Framework - AEGIS Methodology
+ * Technical Lead: Nnamdi Michael Okpala
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rift/core/stage-1/parser.h"
+#include "rift/core/stage-1/parser_tables.h"
+#include "rift/core/common.h"
+
+// LALR Parser Constants
+#define RIFT_LALR_STACK_INITIAL 64
+#define RIFT_LALR_NO_TERMINAL 0xFF
+
+// Operator terminals, generated from operators.def; every operator
+// must have a terminal of the same name in stage-1.grammar
+static const uint8_t operator_terminals[RIFT_OP_COUNT] = {
+#define RIFT_OPERATOR(name, text, c0, c1, c2, binary, assoc, prefix) \
+    [RIFT_OP_##name] = RIFT_LALR_T_##name,
+#include "rift/core/stage-1/operators.def"
+#undef RIFT_OPERATOR
+};
+
+// Parse stack: a state and a value per entry. Values are token indices
+// for terminals and node ids (or RIFT_AST_NONE) for nonterminals.
+typedef struct {
+    uint16_t* states;
+    uint32_t* values;
+    size_t count;
+    size_t capacity;
+} rift_lalr_stack_t;
+
+static bool stack_push(rift_lalr_stack_t* stack, uint16_t parse_state, uint32_t value) {
+    if (stack->count == stack->capacity) {
+        size_t capacity = stack->capacity ? stack->capacity * 2 : RIFT_LALR_STACK_INITIAL;
+        uint16_t* states = realloc(stack->states, capacity * sizeof(uint16_t));
+        if (!states) {
+            return false;
+        }
+        stack->states = states;
+        uint32_t* values = realloc(stack->values, capacity * sizeof(uint32_t));
+        if (!values) {
+            return false;
+        }
+        stack->values = values;
+        stack->capacity = capacity;
+    }
+    stack->states[stack->count] = parse_state;
+    stack->values[stack->count] = value;
+    stack->count++;
+    return true;
+}
+
+/*
+ * classify_token - Grammar terminal of a token
+ */
+static uint8_t classify_token(const rift_token_t* token) {
+    switch (token->type) {
+        case TOKEN_IDENTIFIER:      return RIFT_LALR_T_IDENTIFIER;
+        case TOKEN_LITERAL_INTEGER: return RIFT_LALR_T_INTEGER;
+        case TOKEN_LITERAL_FLOAT:   return RIFT_LALR_T_FLOAT;
+        case TOKEN_LITERAL_STRING:  return RIFT_LALR_T_STRING;
+
+        case TOKEN_KEYWORD:
+            if (strcmp(token->value, "let") == 0) {
+                return RIFT_LALR_T_LET;
+            }
+            if (strcmp(token->value, "const") == 0) {
+                return RIFT_LALR_T_CONST;
+            }
+            return RIFT_LALR_NO_TERMINAL;
+
+        case TOKEN_OPERATOR: {
+            rift_operator_t op = rift_operator_lookup(token->value);
+            return op == RIFT_OP_COUNT ? RIFT_LALR_NO_TERMINAL : operator_terminals[op];
+        }
+
+        case TOKEN_PUNCTUATION:
+            if (token->value[1] == '\0') {
+                switch (token->value[0]) {
+                    case '(': return RIFT_LALR_T_LPAREN;
+                    case ')': return RIFT_LALR_T_RPAREN;
+                    case ';': return RIFT_LALR_T_SEMICOLON;
+                    default: break;
+                }
+            }
+            return RIFT_LALR_NO_TERMINAL;
+
+        default:
+            return RIFT_LALR_NO_TERMINAL;
+    }
+}
+
+/*
+ * add_token_node - Node carrying a token's text and offset
+ */
+static rift_ast_id_t add_token_node(rift_parser_state_t* state, rift_ast_node_type_t type,
+                                    uint32_t index) {
+    const rift_token_t* token = &state->tokens[index];
+    const char* value = token->value;
+    size_t length = strlen(token->value);
+
+    // String values are decoded only here, on demand
+    if (token->type == TOKEN_LITERAL_STRING && state->tokenizer) {
+        const char* text = rift_tokenizer_string_value(state->tokenizer, index, &length);
+        if (text) {
+            value = text;
+        } else {
+            length = 0;
+        }
+    }
+
+    return rift_ast_add_node(&state->ast, type, value, length, token->offset);
+}
+
+/*
+ * reduce_rule - Run a rule's action over the popped values
+ */
+static int reduce_rule(rift_parser_state_t* state, const rift_lalr_rule_t* rule,
+                       const uint32_t* values, rift_ast_id_t* result) {
+    rift_ast_id_t node = RIFT_AST_NONE;
+    int status = RIFT_SUCCESS;
+
+    switch ((rift_lalr_action_t)rule->action) {
+        case RIFT_LALR_ACTION_NONE:
+        case RIFT_LALR_ACTION_ACCEPT:
+            break;
+
+        case RIFT_LALR_ACTION_PASS:
+            node = values[rule->argument - 1];
+            break;
+
+        case RIFT_LALR_ACTION_APPEND:
+            // Statements attach to the program node as soon as they exist
+            if (values[rule->argument - 1] != RIFT_AST_NONE) {
+                status = rift_ast_add_child(&state->ast, RIFT_AST_ROOT,
+                                            values[rule->argument - 1]);
+            }
+            break;
+
+        case RIFT_LALR_ACTION_LEAF:
+            node = add_token_node(state, state->tokens[values[0]].type == TOKEN_IDENTIFIER
+                                         ? AST_NODE_IDENTIFIER : AST_NODE_LITERAL,
+                                  values[0]);
+            if (node == RIFT_AST_NONE) {
+                status = RIFT_ERROR_MEMORY_ALLOCATION;
+            }
+            break;
+
+        case RIFT_LALR_ACTION_UNARY:
+            node = add_token_node(state, AST_NODE_UNARY_OP, values[0]);
+            status = node == RIFT_AST_NONE ? RIFT_ERROR_MEMORY_ALLOCATION
+                                           : rift_ast_add_child(&state->ast, node, values[1]);
+            break;
+
+        case RIFT_LALR_ACTION_BINARY:
+        case RIFT_LALR_ACTION_ASSIGN:
+            node = add_token_node(state, rule->action == RIFT_LALR_ACTION_ASSIGN
+                                         ? AST_NODE_ASSIGNMENT : AST_NODE_BINARY_OP,
+                                  values[1]);
+            status = node == RIFT_AST_NONE ? RIFT_ERROR_MEMORY_ALLOCATION
+                                           : rift_ast_add_child(&state->ast, node, values[0]);
+            if (status == RIFT_SUCCESS) {
+                status = rift_ast_add_child(&state->ast, node, values[2]);
+            }
+            break;
+
+        case RIFT_LALR_ACTION_DECLARE: {
+            // keyword IDENTIFIER [= expression]
+            node = add_token_node(state, AST_NODE_DECLARATION, values[0]);
+            rift_ast_id_t name = add_token_node(state, AST_NODE_IDENTIFIER, values[1]);
+            status = node == RIFT_AST_NONE || name == RIFT_AST_NONE
+                     ? RIFT_ERROR_MEMORY_ALLOCATION
+                     : rift_ast_add_child(&state->ast, node, name);
+            if (status == RIFT_SUCCESS && rule->length == 4) {
+                status = rift_ast_add_child(&state->ast, node, values[3]);
+            }
+            break;
+        }
+    }
+
+    *result = node;
+    return status;
+}
+
+/*
+ * rift_parser_process_bottom_up - Parse with the generated LALR(1) tables
+ */
+int rift_parser_process_bottom_up(rift_parser_state_t* state) {
+    if (!state || !state->tokens || state->token_count > UINT32_MAX) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Classify once; the loop below reads one byte per token
+    size_t count = 0;
+    while (count < state->token_count && state->tokens[count].type != TOKEN_EOF) {
+        count++;
+    }
+    uint8_t* symbols = malloc(count + 1);
+    if (!symbols) {
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+    size_t position = 0;
+    for (; position < count; position++) {
+        symbols[position] = classify_token(&state->tokens[position]);
+        if (symbols[position] == RIFT_LALR_NO_TERMINAL) {
+            break;
+        }
+    }
+    symbols[position] = RIFT_LALR_T_END;
+
+    rift_lalr_stack_t stack = { NULL, NULL, 0, 0 };
+    int result = RIFT_SUCCESS;
+    if (rift_ast_add_node(&state->ast, AST_NODE_PROGRAM, "program", 7, 0) == RIFT_AST_NONE ||
+        !stack_push(&stack, 0, RIFT_AST_NONE)) {
+        result = RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    // Shift-reduce loop; classification stopped at an unknown token, which
+    // is an error only once the parse reaches it
+    position = 0;
+    while (result == RIFT_SUCCESS) {
+        uint16_t top = stack.states[stack.count - 1];
+        uint8_t symbol = symbols[position];
+        if (symbol == RIFT_LALR_T_END && position < count) {
+            result = RIFT_ERROR_UNEXPECTED_TOKEN;
+            break;
+        }
+
+        unsigned index = rift_lalr_action_base[top] + symbol;
+        int action = rift_lalr_action_check[index] == top
+                     ? rift_lalr_action_value[index]
+                     : -(int)rift_lalr_default_reduction[top];
+
+        if (action > 0) {
+            if (!stack_push(&stack, (uint16_t)action, (uint32_t)position)) {
+                result = RIFT_ERROR_MEMORY_ALLOCATION;
+            }
+            position++;
+            continue;
+        }
+        if (action == 0) {
+            result = RIFT_ERROR_UNEXPECTED_TOKEN;
+            break;
+        }
+
+        size_t rule_index = (size_t)(-action - 1);
+        if (rule_index == 0) {
+            break;                          // Accept
+        }
+
+        const rift_lalr_rule_t* rule = &rift_lalr_rules[rule_index];
+        stack.count -= rule->length;
+        rift_ast_id_t node;
+        result = reduce_rule(state, rule, &stack.values[stack.count], &node);
+        if (result != RIFT_SUCCESS) {
+            break;
+        }
+
+        uint16_t from = stack.states[stack.count - 1];
+        unsigned goto_index = rift_lalr_goto_base[rule->lhs] + from;
+        uint16_t next = rift_lalr_goto_check[goto_index] == rule->lhs
+                        ? rift_lalr_goto_value[goto_index]
+                        : rift_lalr_goto_default[rule->lhs];
+        if (!stack_push(&stack, next, node)) {
+            result = RIFT_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+
+    if (result == RIFT_ERROR_UNEXPECTED_TOKEN) {
+        char message[RIFT_MAX_ERROR_MESSAGE_LENGTH];
+        snprintf(message, sizeof(message), "Unexpected %s",
+                 position < count ? state->tokens[position].value : "end of input");
+        rift_error_context_init(&state->error_context, RIFT_ERROR_UNEXPECTED_TOKEN,
+                                message, NULL, "rift_parser_process_bottom_up",
+                                "stage-1-parser");
+    }
+
+    state->current_position = position;
+    free(stack.states);
+    free(stack.values);
+    free(symbols);
+
+    if (result != RIFT_SUCCESS) {
+        return result;
+    }
+    return rift_ast_finalize(&state->ast, RIFT_AST_ROOT);
+}
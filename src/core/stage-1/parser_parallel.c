@@ -0,0 +1,345 @@
+/*
+ * rift/src/core/stage-1/parser_parallel.c
+ * RIFT Stage 1: Parallel Top-Level Parsing
+ * OBINexus Computing Framework - AEGIS Methodology
+ * Technical Lead: Nnamdi Michael Okpala
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "rift/core/stage-1/parser.h"
+#include "rift/core/common.h"
+
+// Parallel Parsing Constants
+#define RIFT_SEGMENTS_PER_THREAD 8    // Spare segments so stealing can balance
+#define RIFT_PARSER_CACHE_LINE 64
+
+// Token classes for the boundary scan
+#define TOKEN_CLASS_OTHER 0
+#define TOKEN_CLASS_OPEN 1
+#define TOKEN_CLASS_CLOSE 2
+#define TOKEN_CLASS_END 3             // ';'
+
+// Segment - a run of whole top-level statements
+typedef struct {
+    size_t begin;
+    size_t end;
+    rift_ast_t ast;
+    int result;
+} rift_parse_segment_t;
+
+// Worker queue: [next, end) of segment indices packed into one word, so
+// the owner popping from the front and thieves halving from the back
+// agree through a single compare-and-swap
+typedef struct {
+    alignas(RIFT_PARSER_CACHE_LINE) _Atomic uint64_t range;
+} rift_segment_queue_t;
+
+typedef struct {
+    const rift_parser_state_t* state;
+    rift_parse_segment_t* segments;
+    rift_segment_queue_t* queues;
+    size_t worker_count;
+} rift_parallel_job_t;
+
+typedef struct {
+    rift_parallel_job_t* job;
+    size_t self;
+} rift_parallel_worker_t;
+
+#define RANGE_PACK(next, end) (((uint64_t)(end) << 32) | (uint32_t)(next))
+#define RANGE_NEXT(range) ((uint32_t)(range))
+#define RANGE_END(range) ((uint32_t)((range) >> 32))
+
+/*
+ * Boundary Pre-pass
+ */
+
+/*
+ * classify_tokens - One byte per token for the scan; classes is zeroed
+ *
+ * This is the only pass over the token records themselves. It also
+ * decodes escaped string literals up front: rift_tokenizer_string_value
+ * caches on first use, and after this every worker call is a read.
+ */
+static void classify_tokens(const rift_parser_state_t* state, uint8_t* classes) {
+    for (size_t i = 0; i < state->token_count; i++) {
+        const rift_token_t* token = &state->tokens[i];
+
+        if (token->type == TOKEN_PUNCTUATION && token->value[1] == '\0') {
+            switch (token->value[0]) {
+                case '(': case '[': case '{': classes[i] = TOKEN_CLASS_OPEN; break;
+                case ')': case ']': case '}': classes[i] = TOKEN_CLASS_CLOSE; break;
+                case ';': classes[i] = TOKEN_CLASS_END; break;
+                default: break;
+            }
+        } else if (token->type == TOKEN_LITERAL_STRING && state->tokenizer &&
+                   (token->flags & RIFT_TOKEN_FLAG_HAS_ESCAPES)) {
+            size_t length;
+            rift_tokenizer_string_value(state->tokenizer, i, &length);
+        }
+    }
+}
+
+static void scan_scalar(const uint8_t* classes, size_t begin, size_t end, size_t* depth,
+                        uint32_t* boundaries, size_t* boundary_count) {
+    for (size_t i = begin; i < end; i++) {
+        switch (classes[i]) {
+            case TOKEN_CLASS_OPEN:
+                (*depth)++;
+                break;
+            case TOKEN_CLASS_CLOSE:
+                // A stray closer is skipped by the parser; do not go negative
+                if (*depth > 0) {
+                    (*depth)--;
+                }
+                break;
+            case TOKEN_CLASS_END:
+                if (*depth == 0) {
+                    boundaries[(*boundary_count)++] = (uint32_t)(i + 1);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/*
+ * find_boundaries - Token index after every ';' at bracket depth 0
+ *
+ * Statements never continue past a top-level ';' (it ends any
+ * expression and is skipped between statements), so each boundary is
+ * a point where a sequential parse also starts a fresh statement.
+ * Bracket-free 16-token blocks at depth 0 are handled with SSE2.
+ */
+static size_t find_boundaries(const uint8_t* classes, size_t count, uint32_t* boundaries) {
+    size_t boundary_count = 0;
+    size_t depth = 0;
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i open = _mm_set1_epi8(TOKEN_CLASS_OPEN);
+    const __m128i close = _mm_set1_epi8(TOKEN_CLASS_CLOSE);
+    const __m128i end = _mm_set1_epi8(TOKEN_CLASS_END);
+
+    for (; i + 16 <= count; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(classes + i));
+        int brackets = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, open),
+                                                      _mm_cmpeq_epi8(block, close)));
+        if (brackets != 0 || depth != 0) {
+            scan_scalar(classes, i, i + 16, &depth, boundaries, &boundary_count);
+            continue;
+        }
+
+        unsigned ends = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(block, end));
+        while (ends) {
+            boundaries[boundary_count++] = (uint32_t)(i + (size_t)__builtin_ctz(ends) + 1);
+            ends &= ends - 1;
+        }
+    }
+#endif
+
+    // Scalar tail (or whole input without SSE2)
+    scan_scalar(classes, i, count, &depth, boundaries, &boundary_count);
+    return boundary_count;
+}
+
+/*
+ * Work-Stealing Pool
+ */
+
+static bool queue_pop(rift_segment_queue_t* queue, size_t* segment) {
+    uint64_t range = atomic_load(&queue->range);
+    while (RANGE_NEXT(range) < RANGE_END(range)) {
+        uint64_t taken = RANGE_PACK(RANGE_NEXT(range) + 1, RANGE_END(range));
+        if (atomic_compare_exchange_weak(&queue->range, &range, taken)) {
+            *segment = RANGE_NEXT(range);
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * steal_segments - Move the back half of another worker's queue to ours
+ *
+ * Our queue is empty here, and nobody modifies an empty queue, so the
+ * stolen range can simply be stored.
+ */
+static bool steal_segments(rift_parallel_job_t* job, size_t self) {
+    for (size_t k = 1; k < job->worker_count; k++) {
+        rift_segment_queue_t* victim = &job->queues[(self + k) % job->worker_count];
+        uint64_t range = atomic_load(&victim->range);
+
+        while (RANGE_NEXT(range) < RANGE_END(range)) {
+            uint32_t available = RANGE_END(range) - RANGE_NEXT(range);
+            uint32_t split = RANGE_END(range) - (available + 1) / 2;
+            if (atomic_compare_exchange_weak(&victim->range, &range,
+                                             RANGE_PACK(RANGE_NEXT(range), split))) {
+                atomic_store(&job->queues[self].range, RANGE_PACK(split, RANGE_END(range)));
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * parse_segment - Parse one segment into its own AST
+ */
+static void parse_segment(const rift_parser_state_t* shared, rift_parse_segment_t* segment) {
+    // Same tokens and tokenizer; absolute positions keep string lookups valid
+    rift_parser_state_t local = *shared;
+    local.token_count = segment->end;
+    local.current_position = segment->begin;
+    local.thread_count = 1;
+    rift_ast_init(&local.ast);
+    memset(&local.expression, 0, sizeof(local.expression));
+
+    segment->result = RIFT_ERROR_MEMORY_ALLOCATION;
+    if (rift_ast_add_node(&local.ast, AST_NODE_PROGRAM, "program", 7, 0) != RIFT_AST_NONE) {
+        segment->result = rift_parse_program(&local);
+        if (segment->result == RIFT_SUCCESS) {
+            segment->result = rift_ast_finalize(&local.ast, RIFT_AST_ROOT);
+        }
+    }
+
+    free(local.expression.operands);
+    free(local.expression.operators);
+    segment->ast = local.ast;
+}
+
+static void* parallel_worker(void* arg) {
+    rift_parallel_worker_t* worker = arg;
+    rift_parallel_job_t* job = worker->job;
+    size_t segment;
+
+    for (;;) {
+        if (queue_pop(&job->queues[worker->self], &segment)) {
+            parse_segment(job->state, &job->segments[segment]);
+        } else if (!steal_segments(job, worker->self)) {
+            // Every queue looked empty; anything in transit has an owner
+            return NULL;
+        }
+    }
+}
+
+/*
+ * rift_parser_process_parallel - Parse with the configured thread count
+ */
+int rift_parser_process_parallel(rift_parser_state_t* state) {
+    if (!state || !state->tokens || state->token_count > UINT32_MAX) {
+        return RIFT_ERROR_INVALID_ARGUMENT;
+    }
+
+    size_t count = state->token_count;
+    size_t worker_count = state->thread_count;
+    if (worker_count < 1) {
+        worker_count = 1;
+    }
+    if (worker_count > RIFT_MAX_PARSER_THREADS) {
+        worker_count = RIFT_MAX_PARSER_THREADS;
+    }
+
+    // Zeroed: every token starts as TOKEN_CLASS_OTHER
+    uint8_t* classes = calloc(count, 1);
+    uint32_t* boundaries = malloc((count + 1) * sizeof(uint32_t));
+    if (!classes || !boundaries) {
+        free(classes);
+        free(boundaries);
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    classify_tokens(state, classes);
+    size_t boundary_count = find_boundaries(classes, count, boundaries);
+    free(classes);
+
+    // Cut at boundaries into segments of roughly equal token counts
+    size_t wanted = worker_count * RIFT_SEGMENTS_PER_THREAD;
+    size_t target = count / wanted > 0 ? count / wanted : 1;
+    size_t segment_count = 0;
+    size_t begin = 0;
+    for (size_t i = 0; i < boundary_count; i++) {
+        if (boundaries[i] - begin >= target && boundaries[i] < count) {
+            boundaries[segment_count++] = boundaries[i];
+            begin = boundaries[i];
+        }
+    }
+    boundaries[segment_count++] = (uint32_t)count;
+
+    rift_parse_segment_t* segments = calloc(segment_count, sizeof(rift_parse_segment_t));
+    rift_segment_queue_t* queues = aligned_alloc(RIFT_PARSER_CACHE_LINE,
+                                                 worker_count * sizeof(rift_segment_queue_t));
+    rift_parallel_worker_t* workers = malloc(worker_count * sizeof(rift_parallel_worker_t));
+    pthread_t* threads = malloc(worker_count * sizeof(pthread_t));
+    if (!segments || !queues || !workers || !threads) {
+        free(boundaries);
+        free(segments);
+        free(queues);
+        free(workers);
+        free(threads);
+        return RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+
+    begin = 0;
+    for (size_t s = 0; s < segment_count; s++) {
+        segments[s].begin = begin;
+        segments[s].end = boundaries[s];
+        begin = boundaries[s];
+    }
+    free(boundaries);
+
+    // Deal contiguous runs of segments to each worker
+    rift_parallel_job_t job = { state, segments, queues, worker_count };
+    for (size_t w = 0; w < worker_count; w++) {
+        size_t first = segment_count * w / worker_count;
+        size_t last = segment_count * (w + 1) / worker_count;
+        atomic_init(&queues[w].range, RANGE_PACK(first, last));
+        workers[w].job = &job;
+        workers[w].self = w;
+    }
+
+    // The calling thread is worker 0
+    size_t started = 1;
+    for (; started < worker_count; started++) {
+        if (pthread_create(&threads[started], NULL, parallel_worker, &workers[started]) != 0) {
+            break;
+        }
+    }
+    parallel_worker(&workers[0]);
+    for (size_t w = 1; w < started; w++) {
+        pthread_join(threads[w], NULL);
+    }
+
+    // Attach subtrees in source order; report the first failure
+    int result = RIFT_SUCCESS;
+    if (rift_ast_add_node(&state->ast, AST_NODE_PROGRAM, "program", 7, 0) == RIFT_AST_NONE ||
+        rift_ast_finalize(&state->ast, RIFT_AST_ROOT) != RIFT_SUCCESS) {
+        result = RIFT_ERROR_MEMORY_ALLOCATION;
+    }
+    for (size_t s = 0; s < segment_count; s++) {
+        if (result == RIFT_SUCCESS) {
+            result = segments[s].result;
+        }
+        if (result == RIFT_SUCCESS) {
+            result = rift_ast_append_children(&state->ast, &segments[s].ast);
+        }
+        rift_ast_release(&segments[s].ast);
+    }
+
+    state->current_position = count;
+    free(segments);
+    free(queues);
+    free(workers);
+    free(threads);
+    return result;
+}
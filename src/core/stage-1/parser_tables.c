@@ -0,0 +1,423 @@
+/*
+ * =================================================================
+ * GENERATED FILE - DO NOT EDIT
+ * Produced by rift_lalrgen from src/core/stage-1/stage-1.grammar
+ * Action table: 976 entries in 1237 slots (dense: 3913)
+ * Goto table: 38 entries in 91 slots (dense: 546)
+ * =================================================================
+ */
+
+#include "rift/core/stage-1/parser_tables.h"
+
+const uint16_t rift_lalr_action_base[91] = {
+       629,     0,     0,     0,     0,     0,     1,   643,   650,   658,
+       698,   705,     0,     0,     0,     0,    33,    29,    30,     0,
+        30,    31,    32,    63,   636,   712,   719,   727,   767,   774,
+       781,   788,   796,   836,   843,   850,   857,   865,   905,   912,
+       919,   926,   934,   974,   981,   988,   995,  1003,  1043,  1050,
+      1057,  1064,  1072,  1112,  1119,  1126,  1133,     0,     0,    66,
+        99,   132,   165,   198,   231,   264,   297,   330,   363,   396,
+       483,   503,   522,   540,   557,   572,   587,  1142,  1153,  1164,
+      1175,  1107,  1184,  1187,  1194,    64,    65,    96,    97,   429,
+       462,
+};
+
+const uint16_t rift_lalr_action_check[1237] = {
+        12,     5,     6, 65535, 65535, 65535, 65535, 65535,    19,    13,
+        19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
+        19,    19,    19,    19,    19,    19,    19,    19,    19,    19,
+        19,    19,    19,    19,    19,    19,    19,    19,    19,    17,
+        18, 65535,    19,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    16,    16,    16,    16,    16,    16,    16,    16,
+        16,    16,    20,    21,    22,    16,    59,    59,    59,    59,
+        59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
+        59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
+        59,    59,    59,    59,    59,    23,    85,    86,    59,    60,
+        60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
+        60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
+        60,    60,    60,    60,    60,    60,    60,    60,    87,    88,
+     65535,    60,    61,    61,    61,    61,    61,    61,    61,    61,
+        61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
+        61,    61,    61,    61,    61,    61,    61,    61,    61,    61,
+        61, 65535, 65535, 65535,    61,    62,    62,    62,    62,    62,
+        62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+        62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+        62,    62,    62,    62, 65535, 65535, 65535,    62,    63,    63,
+        63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+        63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+        63,    63,    63,    63,    63,    63,    63, 65535, 65535, 65535,
+        63,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+        64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+     65535, 65535, 65535,    64,    65,    65,    65,    65,    65,    65,
+        65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
+        65,    65,    65,    65,    65,    65,    65,    65,    65,    65,
+        65,    65,    65, 65535, 65535, 65535,    65,    66,    66,    66,
+        66,    66,    66,    66,    66,    66,    66,    66,    66,    66,
+        66,    66,    66,    66,    66,    66,    66,    66,    66,    66,
+        66,    66,    66,    66,    66,    66, 65535, 65535, 65535,    66,
+        67,    67,    67,    67,    67,    67,    67,    67,    67,    67,
+        67,    67,    67,    67,    67,    67,    67,    67,    67,    67,
+        67,    67,    67,    67,    67,    67,    67,    67,    67, 65535,
+     65535, 65535,    67,    68,    68,    68,    68,    68,    68,    68,
+        68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
+        68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
+        68,    68, 65535, 65535, 65535,    68,    69,    69,    69,    69,
+        69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
+        69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
+        69,    69,    69,    69,    69, 65535, 65535, 65535,    69,    89,
+        89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
+        89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
+        89,    89,    89,    89,    89,    89,    89,    89, 65535, 65535,
+     65535,    89,    90,    90,    90,    90,    90,    90,    90,    90,
+        90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
+        90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
+        90, 65535, 65535, 65535,    90,    70,    70,    70,    70,    70,
+        70,    70,    70,    70,    70,    70,    70,    70,    70,    70,
+        70,    70, 65535, 65535, 65535,    70,    71,    71,    71,    71,
+        71,    71,    71,    71,    71,    71,    71,    71,    71,    71,
+        71,    71, 65535, 65535, 65535,    71,    72,    72,    72,    72,
+        72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
+        72, 65535, 65535, 65535,    72,    73,    73,    73,    73,    73,
+        73,    73,    73,    73,    73,    73,    73,    73,    73, 65535,
+     65535, 65535,    73,    74,    74,    74,    74,    74,    74,    74,
+        74,    74,    74,    74,    74,    74, 65535, 65535, 65535,    74,
+        75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+        75, 65535, 65535, 65535,    75,    76,    76,    76,    76,    76,
+        76,    76,    76,    76,    76,    76, 65535, 65535, 65535,    76,
+         0,     0,     0,     0,     0,     0,     0,    24,    24,    24,
+        24,    24,    24,    24,     7,     7,     7,     7, 65535, 65535,
+         7,     8,     8,     8,     8, 65535, 65535,     8, 65535,     9,
+         9,     9,     9,     0,     0,     9, 65535, 65535,     0,     0,
+        24,    24, 65535, 65535, 65535,    24,    24,     7,     7, 65535,
+     65535, 65535,     7,     7,     8,     8, 65535, 65535, 65535,     8,
+         8, 65535,     9,     9, 65535, 65535, 65535,     9,     9,    10,
+        10,    10,    10, 65535, 65535,    10,    11,    11,    11,    11,
+     65535, 65535,    11,    25,    25,    25,    25, 65535, 65535,    25,
+        26,    26,    26,    26, 65535, 65535,    26, 65535,    27,    27,
+        27,    27,    10,    10,    27, 65535, 65535,    10,    10,    11,
+        11, 65535, 65535, 65535,    11,    11,    25,    25, 65535, 65535,
+     65535,    25,    25,    26,    26, 65535, 65535, 65535,    26,    26,
+     65535,    27,    27, 65535, 65535, 65535,    27,    27,    28,    28,
+        28,    28, 65535, 65535,    28,    29,    29,    29,    29, 65535,
+     65535,    29,    30,    30,    30,    30, 65535, 65535,    30,    31,
+        31,    31,    31, 65535, 65535,    31, 65535,    32,    32,    32,
+        32,    28,    28,    32, 65535, 65535,    28,    28,    29,    29,
+     65535, 65535, 65535,    29,    29,    30,    30, 65535, 65535, 65535,
+        30,    30,    31,    31, 65535, 65535, 65535,    31,    31, 65535,
+        32,    32, 65535, 65535, 65535,    32,    32,    33,    33,    33,
+        33, 65535, 65535,    33,    34,    34,    34,    34, 65535, 65535,
+        34,    35,    35,    35,    35, 65535, 65535,    35,    36,    36,
+        36,    36, 65535, 65535,    36, 65535,    37,    37,    37,    37,
+        33,    33,    37, 65535, 65535,    33,    33,    34,    34, 65535,
+     65535, 65535,    34,    34,    35,    35, 65535, 65535, 65535,    35,
+        35,    36,    36, 65535, 65535, 65535,    36,    36, 65535,    37,
+        37, 65535, 65535, 65535,    37,    37,    38,    38,    38,    38,
+     65535, 65535,    38,    39,    39,    39,    39, 65535, 65535,    39,
+        40,    40,    40,    40, 65535, 65535,    40,    41,    41,    41,
+        41, 65535, 65535,    41, 65535,    42,    42,    42,    42,    38,
+        38,    42, 65535, 65535,    38,    38,    39,    39, 65535, 65535,
+     65535,    39,    39,    40,    40, 65535, 65535, 65535,    40,    40,
+        41,    41, 65535, 65535, 65535,    41,    41, 65535,    42,    42,
+     65535, 65535, 65535,    42,    42,    43,    43,    43,    43, 65535,
+     65535,    43,    44,    44,    44,    44, 65535, 65535,    44,    45,
+        45,    45,    45, 65535, 65535,    45,    46,    46,    46,    46,
+     65535, 65535,    46, 65535,    47,    47,    47,    47,    43,    43,
+        47, 65535, 65535,    43,    43,    44,    44, 65535, 65535, 65535,
+        44,    44,    45,    45, 65535, 65535, 65535,    45,    45,    46,
+        46, 65535, 65535, 65535,    46,    46, 65535,    47,    47, 65535,
+     65535, 65535,    47,    47,    48,    48,    48,    48, 65535, 65535,
+        48,    49,    49,    49,    49, 65535, 65535,    49,    50,    50,
+        50,    50, 65535, 65535,    50,    51,    51,    51,    51, 65535,
+     65535,    51, 65535,    52,    52,    52,    52,    48,    48,    52,
+     65535, 65535,    48,    48,    49,    49, 65535, 65535, 65535,    49,
+        49,    50,    50, 65535, 65535, 65535,    50,    50,    51,    51,
+     65535, 65535, 65535,    51,    51, 65535,    52,    52, 65535, 65535,
+     65535,    52,    52,    53,    53,    53,    53, 65535, 65535,    53,
+        54,    54,    54,    54, 65535, 65535,    54,    55,    55,    55,
+        55, 65535, 65535,    55,    56,    56,    56,    56, 65535, 65535,
+        56,    81,    81,    81,    81,    81,    53,    53, 65535,    81,
+     65535,    53,    53,    54,    54, 65535, 65535, 65535,    54,    54,
+        55,    55, 65535, 65535, 65535,    55,    55,    56,    56, 65535,
+     65535, 65535,    56,    56,    77,    77,    77,    77,    77,    77,
+        77, 65535, 65535, 65535,    77,    78,    78,    78,    78,    78,
+        78,    78, 65535, 65535, 65535,    78,    79,    79,    79,    79,
+        79,    79,    79, 65535, 65535, 65535,    79,    80,    80,    80,
+        80,    80,    80,    80, 65535, 65535, 65535,    80,    82,    82,
+        82,    82,    82,    83,    83,    83,    82, 65535, 65535,    83,
+        84,    84,    84, 65535, 65535, 65535,    84,
+};
+
+const int16_t rift_lalr_action_value[1237] = {
+        -1,    17,    18,     0,     0,     0,     0,     0,    57,    24,
+        25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+        35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+        45,    46,    47,    48,    49,    50,    51,    52,    53,    55,
+        56,     0,    54,    25,    26,    27,    28,    29,    30,    31,
+        32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+        42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+        52,    53,    54,    54,    54,    54,    25,    26,    27,    28,
+        29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+        39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+        49,    50,    51,    52,    53,    54,    54,    54,    54,    25,
+        26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+        36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+        46,    47,    48,    49,    50,    51,    52,    53,    54,    54,
+         0,    54,    25,    26,    27,    28,    29,    30,    31,    32,
+        33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+        43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+        53,     0,     0,     0,    54,    25,    26,    27,    28,    29,
+        30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+        40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+        50,    51,    52,    53,     0,     0,     0,    54,    25,    26,
+        27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+        37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+        47,    48,    49,    50,    51,    52,    53,     0,     0,     0,
+        54,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+        34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+        44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+         0,     0,     0,    54,    25,    26,    27,    28,    29,    30,
+        31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+        41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+        51,    52,    53,     0,     0,     0,    54,    25,    26,    27,
+        28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+        38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+        48,    49,    50,    51,    52,    53,     0,     0,     0,    54,
+        25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+        35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+        45,    46,    47,    48,    49,    50,    51,    52,    53,     0,
+         0,     0,    54,    25,    26,    27,    28,    29,    30,    31,
+        32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+        42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+        52,    53,     0,     0,     0,    54,    25,    26,    27,    28,
+        29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+        39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+        49,    50,    51,    52,    53,     0,     0,     0,    54,    25,
+        26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+        36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+        46,    47,    48,    49,    50,    51,    52,    53,     0,     0,
+         0,    54,    25,    26,    27,    28,    29,    30,    31,    32,
+        33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+        43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+        53,     0,     0,     0,    54,    37,    38,    39,    40,    41,
+        42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+        52,    53,     0,     0,     0,    54,    38,    39,    40,    41,
+        42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+        52,    53,     0,     0,     0,    54,    39,    40,    41,    42,
+        43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+        53,     0,     0,     0,    54,    40,    41,    42,    43,    44,
+        45,    46,    47,    48,    49,    50,    51,    52,    53,     0,
+         0,     0,    54,    41,    42,    43,    44,    45,    46,    47,
+        48,    49,    50,    51,    52,    53,     0,     0,     0,    54,
+        43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+        53,     0,     0,     0,    54,    43,    44,    45,    46,    47,
+        48,    49,    50,    51,    52,    53,     0,     0,     0,    54,
+         1,     2,     3,     4,     5,     6,     7,     1,     2,     3,
+         4,     5,     6,     7,     1,     2,     3,     4,     0,     0,
+         7,     1,     2,     3,     4,     0,     0,     7,     0,     1,
+         2,     3,     4,     8,     9,     7,     0,     0,    10,    11,
+         8,     9,     0,     0,     0,    10,    11,     8,     9,     0,
+         0,     0,    10,    11,     8,     9,     0,     0,     0,    10,
+        11,     0,     8,     9,     0,     0,     0,    10,    11,     1,
+         2,     3,     4,     0,     0,     7,     1,     2,     3,     4,
+         0,     0,     7,     1,     2,     3,     4,     0,     0,     7,
+         1,     2,     3,     4,     0,     0,     7,     0,     1,     2,
+         3,     4,     8,     9,     7,     0,     0,    10,    11,     8,
+         9,     0,     0,     0,    10,    11,     8,     9,     0,     0,
+         0,    10,    11,     8,     9,     0,     0,     0,    10,    11,
+         0,     8,     9,     0,     0,     0,    10,    11,     1,     2,
+         3,     4,     0,     0,     7,     1,     2,     3,     4,     0,
+         0,     7,     1,     2,     3,     4,     0,     0,     7,     1,
+         2,     3,     4,     0,     0,     7,     0,     1,     2,     3,
+         4,     8,     9,     7,     0,     0,    10,    11,     8,     9,
+         0,     0,     0,    10,    11,     8,     9,     0,     0,     0,
+        10,    11,     8,     9,     0,     0,     0,    10,    11,     0,
+         8,     9,     0,     0,     0,    10,    11,     1,     2,     3,
+         4,     0,     0,     7,     1,     2,     3,     4,     0,     0,
+         7,     1,     2,     3,     4,     0,     0,     7,     1,     2,
+         3,     4,     0,     0,     7,     0,     1,     2,     3,     4,
+         8,     9,     7,     0,     0,    10,    11,     8,     9,     0,
+         0,     0,    10,    11,     8,     9,     0,     0,     0,    10,
+        11,     8,     9,     0,     0,     0,    10,    11,     0,     8,
+         9,     0,     0,     0,    10,    11,     1,     2,     3,     4,
+         0,     0,     7,     1,     2,     3,     4,     0,     0,     7,
+         1,     2,     3,     4,     0,     0,     7,     1,     2,     3,
+         4,     0,     0,     7,     0,     1,     2,     3,     4,     8,
+         9,     7,     0,     0,    10,    11,     8,     9,     0,     0,
+         0,    10,    11,     8,     9,     0,     0,     0,    10,    11,
+         8,     9,     0,     0,     0,    10,    11,     0,     8,     9,
+         0,     0,     0,    10,    11,     1,     2,     3,     4,     0,
+         0,     7,     1,     2,     3,     4,     0,     0,     7,     1,
+         2,     3,     4,     0,     0,     7,     1,     2,     3,     4,
+         0,     0,     7,     0,     1,     2,     3,     4,     8,     9,
+         7,     0,     0,    10,    11,     8,     9,     0,     0,     0,
+        10,    11,     8,     9,     0,     0,     0,    10,    11,     8,
+         9,     0,     0,     0,    10,    11,     0,     8,     9,     0,
+         0,     0,    10,    11,     1,     2,     3,     4,     0,     0,
+         7,     1,     2,     3,     4,     0,     0,     7,     1,     2,
+         3,     4,     0,     0,     7,     1,     2,     3,     4,     0,
+         0,     7,     0,     1,     2,     3,     4,     8,     9,     7,
+         0,     0,    10,    11,     8,     9,     0,     0,     0,    10,
+        11,     8,     9,     0,     0,     0,    10,    11,     8,     9,
+         0,     0,     0,    10,    11,     0,     8,     9,     0,     0,
+         0,    10,    11,     1,     2,     3,     4,     0,     0,     7,
+         1,     2,     3,     4,     0,     0,     7,     1,     2,     3,
+         4,     0,     0,     7,     1,     2,     3,     4,     0,     0,
+         7,    49,    50,    51,    52,    53,     8,     9,     0,    54,
+         0,    10,    11,     8,     9,     0,     0,     0,    10,    11,
+         8,     9,     0,     0,     0,    10,    11,     8,     9,     0,
+         0,     0,    10,    11,    47,    48,    49,    50,    51,    52,
+        53,     0,     0,     0,    54,    47,    48,    49,    50,    51,
+        52,    53,     0,     0,     0,    54,    47,    48,    49,    50,
+        51,    52,    53,     0,     0,     0,    54,    47,    48,    49,
+        50,    51,    52,    53,     0,     0,     0,    54,    49,    50,
+        51,    52,    53,    51,    52,    53,    54,     0,     0,    54,
+        51,    52,    53,     0,     0,     0,    54,
+};
+
+const uint16_t rift_lalr_default_reduction[91] = {
+         5,    47,    48,    49,    50,     0,     0,     0,     0,     0,
+         0,     0,     0,     2,     3,     6,     7,     8,     9,     0,
+        42,    43,    44,    45,     5,     0,     0,     0,     0,     0,
+         0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+         0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+         0,     0,     0,     0,     0,     0,     0,    46,     4,    12,
+        13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+        23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+        33,    34,    35,    36,    37,    38,    39,    40,    41,    10,
+        11,
+};
+
+const uint16_t rift_lalr_goto_base[6] = {
+         0,     0,     0,     0,     0,     0,
+};
+
+const uint16_t rift_lalr_goto_check[91] = {
+     65535, 65535, 65535, 65535, 65535, 65535, 65535,     5,     5,     5,
+         5,     5, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+     65535, 65535, 65535, 65535,     3,     5,     5,     5,     5,     5,
+         5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+         5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+         5,     5,     5,     5,     5,     5,     5, 65535, 65535, 65535,
+     65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+     65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+     65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+     65535,
+};
+
+const uint16_t rift_lalr_goto_value[91] = {
+         0,     0,     0,     0,     0,     0,     0,    19,    20,    21,
+        22,    23,     0,     0,     0,     0,     0,     0,     0,     0,
+         0,     0,     0,     0,    58,    59,    60,    61,    62,    63,
+        64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+        74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+        84,    85,    86,    87,    88,    89,    90,     0,     0,     0,
+         0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+         0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+         0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+         0,
+};
+
+const uint16_t rift_lalr_goto_default[6] = {
+         0,    12,    13,    14,    15,    16,
+};
+
+const rift_lalr_rule_t rift_lalr_rules[RIFT_LALR_RULE_COUNT] = {
+    {  0, 1, RIFT_LALR_ACTION_ACCEPT, 0 }, // 0: $accept : program
+    {  1, 1, RIFT_LALR_ACTION_NONE, 0 }, // 1: program : statement_list
+    {  2, 1, RIFT_LALR_ACTION_APPEND, 1 }, // 2: statement_list : statement
+    {  2, 3, RIFT_LALR_ACTION_APPEND, 3 }, // 3: statement_list : statement_list SEMICOLON statement
+    {  3, 0, RIFT_LALR_ACTION_NONE, 0 }, // 4: statement :
+    {  3, 1, RIFT_LALR_ACTION_PASS, 1 }, // 5: statement : declaration
+    {  3, 1, RIFT_LALR_ACTION_PASS, 1 }, // 6: statement : expression
+    {  4, 2, RIFT_LALR_ACTION_DECLARE, 0 }, // 7: declaration : LET IDENTIFIER
+    {  4, 2, RIFT_LALR_ACTION_DECLARE, 0 }, // 8: declaration : CONST IDENTIFIER
+    {  4, 4, RIFT_LALR_ACTION_DECLARE, 0 }, // 9: declaration : LET IDENTIFIER ASSIGN expression
+    {  4, 4, RIFT_LALR_ACTION_DECLARE, 0 }, // 10: declaration : CONST IDENTIFIER ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 11: expression : expression ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 12: expression : expression ADD_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 13: expression : expression SUB_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 14: expression : expression MUL_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 15: expression : expression DIV_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 16: expression : expression MOD_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 17: expression : expression AND_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 18: expression : expression OR_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 19: expression : expression XOR_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 20: expression : expression SHL_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_ASSIGN, 0 }, // 21: expression : expression SHR_ASSIGN expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 22: expression : expression LOGICAL_OR expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 23: expression : expression LOGICAL_AND expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 24: expression : expression BIT_OR expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 25: expression : expression BIT_XOR expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 26: expression : expression BIT_AND expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 27: expression : expression EQ expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 28: expression : expression NE expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 29: expression : expression LT expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 30: expression : expression LE expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 31: expression : expression GT expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 32: expression : expression GE expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 33: expression : expression SHL expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 34: expression : expression SHR expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 35: expression : expression ADD expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 36: expression : expression SUB expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 37: expression : expression MUL expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 38: expression : expression DIV expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 39: expression : expression MOD expression
+    {  5, 3, RIFT_LALR_ACTION_BINARY, 0 }, // 40: expression : expression POW expression
+    {  5, 2, RIFT_LALR_ACTION_UNARY, 0 }, // 41: expression : ADD expression
+    {  5, 2, RIFT_LALR_ACTION_UNARY, 0 }, // 42: expression : SUB expression
+    {  5, 2, RIFT_LALR_ACTION_UNARY, 0 }, // 43: expression : NOT expression
+    {  5, 2, RIFT_LALR_ACTION_UNARY, 0 }, // 44: expression : BIT_NOT expression
+    {  5, 3, RIFT_LALR_ACTION_PASS, 2 }, // 45: expression : LPAREN expression RPAREN
+    {  5, 1, RIFT_LALR_ACTION_LEAF, 0 }, // 46: expression : IDENTIFIER
+    {  5, 1, RIFT_LALR_ACTION_LEAF, 0 }, // 47: expression : INTEGER
+    {  5, 1, RIFT_LALR_ACTION_LEAF, 0 }, // 48: expression : FLOAT
+    {  5, 1, RIFT_LALR_ACTION_LEAF, 0 }, // 49: expression : STRING
+};
+
+const char* const rift_lalr_terminal_names[RIFT_LALR_TERMINAL_COUNT] = {
+    "$end",
+    "IDENTIFIER",
+    "INTEGER",
+    "FLOAT",
+    "STRING",
+    "LET",
+    "CONST",
+    "LPAREN",
+    "RPAREN",
+    "SEMICOLON",
+    "ASSIGN",
+    "ADD_ASSIGN",
+    "SUB_ASSIGN",
+    "MUL_ASSIGN",
+    "DIV_ASSIGN",
+    "MOD_ASSIGN",
+    "AND_ASSIGN",
+    "OR_ASSIGN",
+    "XOR_ASSIGN",
+    "SHL_ASSIGN",
+    "SHR_ASSIGN",
+    "LOGICAL_OR",
+    "LOGICAL_AND",
+    "BIT_OR",
+    "BIT_XOR",
+    "BIT_AND",
+    "EQ",
+    "NE",
+    "LT",
+    "LE",
+    "GT",
+    "GE",
+    "SHL",
+    "SHR",
+    "ADD",
+    "SUB",
+    "MUL",
+    "DIV",
+    "MOD",
+    "NOT",
+    "BIT_NOT",
+    "UNARY",
+    "POW",
+};
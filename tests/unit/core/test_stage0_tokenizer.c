@@ -0,0 +1,385 @@
+/**
+ * =================================================================
+ * test_stage0_tokenizer.c - RIFT Stage 0 Tokenizer Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: src/core/stage-0 token stream and source locations
+ * OBINexus Computing Framework - Aegis Project
+ * Collaborator: Nnamdi Michael Okpala
+ * =================================================================
+ */
+
+#include "rift/core/stage-0/tokenizer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_token_stream(void);
+static bool test_compound_operators(void);
+static bool test_location_lookup(void);
+static bool test_location_edge_cases(void);
+static bool test_string_in_place(void);
+static bool test_string_escapes(void);
+static bool test_string_unterminated(void);
+static bool test_number_constants(void);
+static bool test_number_errors(void);
+
+/* Utility functions */
+static void run_test(const char *test_name, bool (*test_func)(void));
+static void print_test_summary(void);
+
+/**
+ * Main test entry point
+ */
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT Stage 0 Tokenizer Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Token Stream", test_token_stream);
+    run_test("Compound Operators", test_compound_operators);
+    run_test("Location Lookup", test_location_lookup);
+    run_test("Location Edge Cases", test_location_edge_cases);
+    run_test("String In Place", test_string_in_place);
+    run_test("String Escapes", test_string_escapes);
+    run_test("Unterminated String", test_string_unterminated);
+    run_test("Number Constants", test_number_constants);
+    run_test("Number Errors", test_number_errors);
+
+    print_test_summary();
+
+    return (g_test_suite.tests_failed == 0) ? 0 : 1;
+}
+
+/**
+ * Test: Types, values and offsets of a small program
+ */
+static bool test_token_stream(void) {
+    const char *source = "let x = 42;\nfoo(x)";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 10, "Expected 9 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    static const rift_token_type_t types[] = {
+        TOKEN_KEYWORD, TOKEN_IDENTIFIER, TOKEN_OPERATOR, TOKEN_LITERAL_INTEGER,
+        TOKEN_PUNCTUATION, TOKEN_IDENTIFIER, TOKEN_PUNCTUATION, TOKEN_IDENTIFIER,
+        TOKEN_PUNCTUATION, TOKEN_EOF
+    };
+    static const size_t offsets[] = { 0, 4, 6, 8, 10, 12, 15, 16, 17, 18 };
+    for (size_t i = 0; i < 10; i++) {
+        TEST_ASSERT(tokens[i].type == types[i], "Wrong token type");
+        TEST_ASSERT(tokens[i].offset == offsets[i], "Wrong token offset");
+    }
+    TEST_ASSERT(strcmp(tokens[0].value, "let") == 0, "Keyword value");
+    TEST_ASSERT(strcmp(tokens[5].value, "foo") == 0, "Identifier value");
+    TEST_ASSERT(tokens[3].length == 2, "Lexeme length");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Token stream types and offsets");
+}
+
+/**
+ * Test: Longest operator match
+ */
+static bool test_compound_operators(void) {
+    const char *source = "a <<= b ** c != -d";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 9, "Expected 8 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    TEST_ASSERT(strcmp(tokens[1].value, "<<=") == 0, "Three-character operator");
+    TEST_ASSERT(strcmp(tokens[3].value, "**") == 0, "Power operator");
+    TEST_ASSERT(strcmp(tokens[5].value, "!=") == 0, "Comparison operator");
+    TEST_ASSERT(strcmp(tokens[6].value, "-") == 0, "Prefix minus stays separate");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Compound operators");
+}
+
+/**
+ * Test: Offsets resolve to 1-based line and column
+ */
+static bool test_location_lookup(void) {
+    const char *source = "a\nbb\n\n  ccc";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 4, "Expected 3 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    static const size_t lines[] = { 1, 2, 4 };
+    static const size_t columns[] = { 1, 1, 3 };
+    for (size_t i = 0; i < 3; i++) {
+        size_t line = 0;
+        size_t column = 0;
+        TEST_ASSERT(rift_tokenizer_get_location(&state, tokens[i].offset, &line, &column)
+                    == RIFT_SUCCESS, "Lookup failed");
+        TEST_ASSERT(line == lines[i], "Wrong line");
+        TEST_ASSERT(column == columns[i], "Wrong column");
+    }
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Line and column from byte offsets");
+}
+
+/**
+ * Test: Newline positions, end of input and a long source
+ */
+static bool test_location_edge_cases(void) {
+    /* 100 lines of 35 bytes exercise the vectorized newline scan */
+    char source[4000];
+    size_t used = 0;
+    for (int i = 0; i < 100; i++) {
+        used += (size_t)snprintf(source + used, sizeof(source) - used,
+                                 "line_%02d = value + other_value * 2;\n", i);
+    }
+
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+
+    size_t line = 0;
+    size_t column = 0;
+    TEST_ASSERT(rift_tokenizer_get_location(&state, 0, &line, &column) == RIFT_SUCCESS,
+                "Lookup before tokenizing");
+    TEST_ASSERT(line == 1 && column == 1, "Start of input");
+
+    /* A newline belongs to the line it ends */
+    TEST_ASSERT(rift_tokenizer_get_location(&state, 34, &line, &column) == RIFT_SUCCESS,
+                "Lookup at newline");
+    TEST_ASSERT(line == 1 && column == 35, "Newline position");
+
+    TEST_ASSERT(rift_tokenizer_get_location(&state, 35 * 57 + 5, &line, &column)
+                == RIFT_SUCCESS, "Lookup mid-file");
+    TEST_ASSERT(line == 58 && column == 6, "Mid-file position");
+
+    TEST_ASSERT(rift_tokenizer_get_location(&state, used, &line, &column) == RIFT_SUCCESS,
+                "Lookup at end");
+    TEST_ASSERT(line == 101 && column == 1, "End of input after final newline");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Location edge cases");
+}
+
+/**
+ * Test: Literals without escapes point straight into the input
+ */
+static bool test_string_in_place(void) {
+    const char *source = "x = \"a string longer than one sixteen byte block\" + 'q'";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 6, "Expected 5 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    TEST_ASSERT(tokens[2].type == TOKEN_LITERAL_STRING, "Double-quoted literal");
+    TEST_ASSERT(tokens[2].flags == 0, "No escape or unterminated flags");
+    TEST_ASSERT(tokens[2].value[0] == '\0', "Value buffer is not filled");
+
+    size_t length = 0;
+    const char *value = rift_tokenizer_string_value(&state, 2, &length);
+    TEST_ASSERT(value == source + 5, "Value is the span inside the quotes");
+    TEST_ASSERT(length == 43 && memcmp(value, "a string longer", 15) == 0, "Span contents");
+
+    value = rift_tokenizer_string_value(&state, 4, &length);
+    TEST_ASSERT(tokens[4].type == TOKEN_LITERAL_STRING, "Single-quoted literal");
+    TEST_ASSERT(value && length == 1 && value[0] == 'q', "Single-quoted contents");
+
+    TEST_ASSERT(rift_tokenizer_string_value(&state, 0, &length) == NULL,
+                "Non-string tokens have no string value");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("In-place string values");
+}
+
+/**
+ * Test: Escaped literals decode once into the arena
+ */
+static bool test_string_escapes(void) {
+    const char *source = "\"tab\\there \\\"quoted\\\" padding padding\\n\" \"\\\\\"";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 3, "Expected 2 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    TEST_ASSERT(tokens[0].flags == RIFT_TOKEN_FLAG_HAS_ESCAPES, "Escape flag set");
+    TEST_ASSERT(tokens[0].decoded == NULL, "Nothing decoded while tokenizing");
+
+    size_t length = 0;
+    const char *value = rift_tokenizer_string_value(&state, 0, &length);
+    const char *expected = "tab\there \"quoted\" padding padding\n";
+    TEST_ASSERT(value && length == strlen(expected), "Decoded length");
+    TEST_ASSERT(memcmp(value, expected, length) == 0, "Decoded contents");
+    TEST_ASSERT(value < source || value > source + strlen(source), "Decoded into the arena");
+
+    size_t again_length = 0;
+    TEST_ASSERT(rift_tokenizer_string_value(&state, 0, &again_length) == value,
+                "Second lookup reuses the decoded copy");
+    TEST_ASSERT(again_length == length, "Cached length");
+
+    value = rift_tokenizer_string_value(&state, 1, &length);
+    TEST_ASSERT(value && length == 1 && value[0] == '\\', "Escaped backslash");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Escaped string values");
+}
+
+/**
+ * Test: A literal that runs to end of input is flagged, not dropped
+ */
+static bool test_string_unterminated(void) {
+    const char *source = "y = \"never closed \\\"";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 4, "Expected 3 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    TEST_ASSERT(tokens[2].flags & RIFT_TOKEN_FLAG_UNTERMINATED, "Unterminated flag set");
+    TEST_ASSERT(tokens[2].offset + tokens[2].length == strlen(source),
+                "Span runs to end of input");
+
+    size_t length = 0;
+    const char *value = rift_tokenizer_string_value(&state, 2, &length);
+    TEST_ASSERT(value && length == 14 && memcmp(value, "never closed \"", 14) == 0,
+                "Value keeps everything after the quote");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Unterminated string literal");
+}
+
+/**
+ * Test: Numeric literals are converted once while tokenizing
+ */
+static bool test_number_constants(void) {
+    const char *source = "1_000 0xFF_FF 0b1010 6.02e23 2.5 18446744073709551615 "
+                         "18446744073709551616 name";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 9, "Expected 8 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    static const uint64_t integers[] = { 1000, 0xFFFF, 10 };
+    for (size_t i = 0; i < 3; i++) {
+        const rift_constant_t *value = rift_tokenizer_number_value(&state, i);
+        TEST_ASSERT(tokens[i].type == TOKEN_LITERAL_INTEGER, "Integer token type");
+        TEST_ASSERT(value && value->kind == RIFT_CONSTANT_INTEGER, "Integer constant");
+        TEST_ASSERT(value->as.integer == integers[i], "Integer value");
+    }
+
+    const rift_constant_t *value = rift_tokenizer_number_value(&state, 3);
+    TEST_ASSERT(tokens[3].type == TOKEN_LITERAL_FLOAT, "Exponent makes a float");
+    TEST_ASSERT(value && value->kind == RIFT_CONSTANT_FLOAT && value->as.real == 6.02e23,
+                "Correctly rounded float");
+    value = rift_tokenizer_number_value(&state, 4);
+    TEST_ASSERT(value && value->kind == RIFT_CONSTANT_FLOAT && value->as.real == 2.5,
+                "Fractional float");
+
+    value = rift_tokenizer_number_value(&state, 5);
+    TEST_ASSERT(value && value->kind == RIFT_CONSTANT_INTEGER && value->as.integer == UINT64_MAX,
+                "Largest integer stays integral");
+    value = rift_tokenizer_number_value(&state, 6);
+    TEST_ASSERT(tokens[6].type == TOKEN_LITERAL_FLOAT, "Decimal overflow becomes a float");
+    TEST_ASSERT(value && value->kind == RIFT_CONSTANT_FLOAT && value->as.real == 18446744073709551616.0,
+                "Overflowed value");
+
+    TEST_ASSERT(tokens[7].constant_index == RIFT_NO_CONSTANT, "Identifiers carry no constant");
+    TEST_ASSERT(rift_tokenizer_number_value(&state, 7) == NULL, "No value for identifiers");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Numeric literal constants");
+}
+
+/**
+ * Test: Literals that do not convert are flagged and kept
+ */
+static bool test_number_errors(void) {
+    const char *source = "0x1_0000_0000_0000_0000 0x 1_ 0x_1 7";
+    rift_tokenizer_state_t state;
+    TEST_ASSERT(rift_tokenizer_init(source, &state) == RIFT_SUCCESS, "Init failed");
+    TEST_ASSERT(rift_tokenizer_process(&state) == 6, "Expected 5 tokens plus EOF");
+
+    const rift_token_t *tokens = rift_tokenizer_get_tokens(&state);
+    for (size_t i = 0; i < 4; i++) {
+        const rift_constant_t *value = rift_tokenizer_number_value(&state, i);
+        TEST_ASSERT(tokens[i].flags & RIFT_TOKEN_FLAG_BAD_NUMBER, "Bad number flag set");
+        TEST_ASSERT(value && value->kind == RIFT_CONSTANT_INVALID, "Invalid constant");
+    }
+    TEST_ASSERT(strcmp(tokens[0].value, "0x1_0000_0000_0000_0000") == 0, "Lexeme kept");
+    TEST_ASSERT(strcmp(tokens[2].value, "1_") == 0 && strcmp(tokens[3].value, "0x_1") == 0,
+                "Misplaced separators stay in one lexeme");
+
+    const rift_constant_t *value = rift_tokenizer_number_value(&state, 4);
+    TEST_ASSERT(!(tokens[4].flags & RIFT_TOKEN_FLAG_BAD_NUMBER), "Following literal unaffected");
+    TEST_ASSERT(value && value->kind == RIFT_CONSTANT_INTEGER && value->as.integer == 7,
+                "Following literal converts");
+
+    rift_tokenizer_cleanup(&state);
+    TEST_PASS("Numeric literal errors");
+}
+
+/**
+ * Utility: Run individual test and track results
+ */
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
+
+/**
+ * Utility: Print final test summary
+ */
+static void print_test_summary(void) {
+    printf("\n=================================================================\n");
+    printf("RIFT Stage 0 Tokenizer Validation Results\n");
+    printf("=================================================================\n");
+    printf("Tests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+        printf("\nSTATUS: STAGE 0 VALIDATION FAILED\n");
+    } else {
+        printf("\nSTATUS: STAGE 0 VALIDATION PASSED\n");
+    }
+
+    printf("=================================================================\n");
+}
@@ -0,0 +1,621 @@
+/**
+ * =================================================================
+ * test_stage1_ast.c - RIFT Stage 1 AST Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: src/core/stage-1 flat AST, arena and shared DAG
+ * OBINexus Computing Framework - Aegis Project
+ * Collaborator: Nnamdi Michael Okpala
+ * =================================================================
+ */
+
+#include "rift/core/stage-1/ast.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Forward declarations */
+static bool test_arena_interning(void);
+static bool test_arena_growth(void);
+static bool test_node_values(void);
+static bool test_many_children(void);
+static bool test_deep_chain(void);
+static bool test_append_children(void);
+static bool test_merkle_hashes(void);
+static bool test_find_difference(void);
+static bool test_dag_sharing(void);
+static bool test_dag_across_trees(void);
+
+/* Utility functions */
+static bool check_preorder(const rift_ast_t *ast);
+static rift_ast_id_t add_pair(rift_ast_t *ast, const char *op, const char *left,
+                              const char *right, size_t offset);
+static bool build_sample(rift_ast_t *ast, const char *leaf, bool swap, bool extra,
+                         size_t offset);
+static void run_test(const char *test_name, bool (*test_func)(void));
+static void print_test_summary(void);
+
+/**
+ * Main test entry point
+ */
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT Stage 1 AST Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Arena Interning", test_arena_interning);
+    run_test("Arena Growth", test_arena_growth);
+    run_test("Node Values", test_node_values);
+    run_test("Many Children", test_many_children);
+    run_test("Deep Chain", test_deep_chain);
+    run_test("Append Children", test_append_children);
+    run_test("Merkle Hashes", test_merkle_hashes);
+    run_test("Find Difference", test_find_difference);
+    run_test("DAG Sharing", test_dag_sharing);
+    run_test("DAG Across Trees", test_dag_across_trees);
+
+    print_test_summary();
+
+    return (g_test_suite.tests_failed == 0) ? 0 : 1;
+}
+
+/**
+ * Test: Equal text interns to one symbol
+ */
+static bool test_arena_interning(void) {
+    rift_ast_arena_t arena;
+    rift_ast_arena_init(&arena);
+
+    rift_ast_symbol_t plus = rift_ast_intern(&arena, "+=", 1);
+    rift_ast_symbol_t again = rift_ast_intern(&arena, "+", 1);
+    rift_ast_symbol_t compound = rift_ast_intern(&arena, "+=", 2);
+    rift_ast_symbol_t empty = rift_ast_intern(&arena, "", 0);
+
+    TEST_ASSERT(plus != RIFT_AST_NO_SYMBOL, "Symbol allocated");
+    TEST_ASSERT(plus == again, "Same text, same symbol");
+    TEST_ASSERT(compound != plus, "Length is part of the text");
+    TEST_ASSERT(empty != RIFT_AST_NO_SYMBOL && empty != plus, "Empty text is a symbol");
+
+    size_t length = 0;
+    TEST_ASSERT(strcmp(rift_ast_symbol_text(&arena, compound, &length), "+=") == 0 &&
+                length == 2, "Text is NUL-terminated copy");
+    TEST_ASSERT(strcmp(rift_ast_symbol_text(&arena, RIFT_AST_NO_SYMBOL, &length), "") == 0 &&
+                length == 0, "No symbol reads as empty");
+
+    rift_ast_arena_release(&arena);
+    TEST_PASS("Interning");
+}
+
+/**
+ * Test: Text stays put while the table and blocks grow
+ */
+static bool test_arena_growth(void) {
+    rift_ast_arena_t arena;
+    rift_ast_arena_init(&arena);
+
+    /* Larger than one arena block */
+    static char large[40000];
+    memset(large, 'x', sizeof(large));
+    rift_ast_symbol_t big = rift_ast_intern(&arena, large, sizeof(large));
+    const char *big_text = rift_ast_symbol_text(&arena, big, NULL);
+    TEST_ASSERT(big != RIFT_AST_NO_SYMBOL, "Oversized text interned");
+
+    rift_ast_symbol_t first = rift_ast_intern(&arena, "name_0", 6);
+    const char *first_text = rift_ast_symbol_text(&arena, first, NULL);
+    bool stable = true;
+    for (int i = 0; i < 20000; i++) {
+        char name[32];
+        int length = snprintf(name, sizeof(name), "name_%d", i);
+        rift_ast_symbol_t symbol = rift_ast_intern(&arena, name, (size_t)length);
+        stable &= symbol != RIFT_AST_NO_SYMBOL;
+        stable &= strcmp(rift_ast_symbol_text(&arena, symbol, NULL), name) == 0;
+    }
+
+    TEST_ASSERT(stable, "Every symbol reads back");
+    TEST_ASSERT(arena.symbol_count == 20001, "One entry per distinct text");
+    TEST_ASSERT(rift_ast_intern(&arena, "name_0", 6) == first, "Lookup after growth");
+    TEST_ASSERT(rift_ast_symbol_text(&arena, first, NULL) == first_text, "Text never moves");
+    TEST_ASSERT(rift_ast_symbol_text(&arena, big, NULL) == big_text &&
+                memcmp(big_text, large, sizeof(large)) == 0, "Oversized text intact");
+
+    rift_ast_arena_release(&arena);
+    TEST_PASS("Arena growth");
+}
+
+/**
+ * Test: Node values share the tree's arena
+ */
+static bool test_node_values(void) {
+    rift_ast_t ast;
+    rift_ast_init(&ast);
+
+    rift_ast_id_t root = rift_ast_add_node(&ast, AST_NODE_PROGRAM, "program", 7, 0);
+    bool added = root != RIFT_AST_NONE;
+    for (size_t i = 0; i < 1000; i++) {
+        rift_ast_id_t node = rift_ast_add_node(&ast, AST_NODE_IDENTIFIER,
+                                               i % 2 ? "left" : "right", i % 2 ? 4 : 5, i);
+        added &= node != RIFT_AST_NONE;
+    }
+    TEST_ASSERT(added, "Nodes allocated");
+
+    TEST_ASSERT(ast.values[1] == ast.values[3] && ast.values[2] == ast.values[4],
+                "Repeated values share a symbol");
+    TEST_ASSERT(ast.values[1] != ast.values[2], "Distinct values differ");
+    TEST_ASSERT(ast.arena.symbol_count == 3, "Three distinct values");
+    TEST_ASSERT(ast.kinds[5] == AST_NODE_IDENTIFIER && ast.offsets[5] == 4, "Node fields");
+
+    size_t length = 0;
+    TEST_ASSERT(strcmp(rift_ast_value(&ast, 2, &length), "left") == 0 && length == 4,
+                "Value text");
+    TEST_ASSERT(strcmp(rift_ast_value(&ast, 5000, &length), "") == 0 && length == 0,
+                "Out of range reads as empty");
+
+    rift_ast_release(&ast);
+    TEST_ASSERT(ast.count == 0, "Release empties the tree");
+
+    TEST_PASS("Node values");
+}
+
+/**
+ * Test: Child count is unbounded; finalize lays children out in order
+ */
+static bool test_many_children(void) {
+    const size_t children = 1000;
+    rift_ast_t ast;
+    rift_ast_init(&ast);
+
+    /* Children exist before their parent, with a detached node between */
+    rift_ast_id_t first = add_pair(&ast, "+", "a", "b", 0);
+    rift_ast_id_t detached = rift_ast_add_node(&ast, AST_NODE_LITERAL, "lost", 4, 1);
+    rift_ast_id_t root = rift_ast_add_node(&ast, AST_NODE_PROGRAM, "program", 7, 0);
+    TEST_ASSERT(first != RIFT_AST_NONE && detached != RIFT_AST_NONE && root != RIFT_AST_NONE,
+                "Nodes allocated");
+    TEST_ASSERT(rift_ast_add_child(&ast, root, first) == RIFT_SUCCESS, "First child");
+    for (size_t i = 1; i < children; i++) {
+        rift_ast_id_t child = add_pair(&ast, i % 2 ? "*" : "-", "x", "y", i);
+        TEST_ASSERT(child != RIFT_AST_NONE, "Child allocated");
+        TEST_ASSERT(rift_ast_add_child(&ast, root, child) == RIFT_SUCCESS, "Child attached");
+    }
+    TEST_ASSERT(ast.child_counts[root] == children, "Count before finalize");
+
+    TEST_ASSERT(rift_ast_finalize(&ast, root) == RIFT_SUCCESS, "Finalize");
+    TEST_ASSERT(ast.count == 1 + children * 3, "Detached node dropped");
+    TEST_ASSERT(ast.kinds[RIFT_AST_ROOT] == AST_NODE_PROGRAM, "Root is node 0");
+    TEST_ASSERT(ast.child_counts[RIFT_AST_ROOT] == children, "Count after finalize");
+    TEST_ASSERT(rift_ast_complexity(&ast, RIFT_AST_ROOT) == ast.count, "Whole tree");
+    TEST_ASSERT(check_preorder(&ast), "Preorder layout");
+
+    size_t seen = 0;
+    bool ordered = true;
+    for (rift_ast_id_t child = ast.first_child[RIFT_AST_ROOT]; child != RIFT_AST_NONE;
+         child = ast.next_sibling[child]) {
+        ordered &= child == 1 + seen * 3;
+        ordered &= ast.offsets[child] == seen;
+        ordered &= rift_ast_complexity(&ast, child) == 3;
+        seen++;
+    }
+    TEST_ASSERT(seen == children && ordered, "Children in insertion order");
+
+    rift_ast_release(&ast);
+    TEST_PASS("Many children");
+}
+
+/**
+ * Test: Finalize walks a very deep tree without recursion
+ */
+static bool test_deep_chain(void) {
+    const size_t depth = 300000;
+    rift_ast_t ast;
+    rift_ast_init(&ast);
+
+    rift_ast_id_t node = rift_ast_add_node(&ast, AST_NODE_IDENTIFIER, "x", 1, depth);
+    bool built = node != RIFT_AST_NONE;
+    for (size_t i = 0; i < depth && built; i++) {
+        rift_ast_id_t parent = rift_ast_add_node(&ast, AST_NODE_UNARY_OP, "-", 1, depth - 1 - i);
+        built = parent != RIFT_AST_NONE && rift_ast_add_child(&ast, parent, node) == RIFT_SUCCESS;
+        node = parent;
+    }
+    TEST_ASSERT(built, "Chain built");
+
+    TEST_ASSERT(rift_ast_finalize(&ast, node) == RIFT_SUCCESS, "Finalize");
+    TEST_ASSERT(ast.count == depth + 1, "Every level kept");
+    TEST_ASSERT(check_preorder(&ast), "Preorder layout");
+
+    bool chained = true;
+    for (size_t id = 0; id < depth; id++) {
+        chained &= ast.first_child[id] == id + 1;
+        chained &= ast.offsets[id] == id;
+        chained &= ast.subtree_end[id] == depth + 1;
+    }
+    TEST_ASSERT(chained, "Each level's child follows it");
+    TEST_ASSERT(ast.kinds[depth] == AST_NODE_IDENTIFIER, "Leaf last");
+
+    rift_ast_release(&ast);
+    TEST_PASS("Deep chain");
+}
+
+/**
+ * Test: Appending another tree's top level keeps preorder
+ */
+static bool test_append_children(void) {
+    rift_ast_t left;
+    rift_ast_t right;
+    rift_ast_t whole;
+    rift_ast_init(&left);
+    rift_ast_init(&right);
+    rift_ast_init(&whole);
+
+    /* whole = program(+ a b, * c d, - a d); left and right split it */
+    rift_ast_t *trees[] = { &left, &right, &whole };
+    rift_ast_id_t roots[3];
+    for (size_t t = 0; t < 3; t++) {
+        roots[t] = rift_ast_add_node(trees[t], AST_NODE_PROGRAM, "program", 7, 0);
+        TEST_ASSERT(roots[t] != RIFT_AST_NONE, "Root allocated");
+    }
+    static const char *pairs[3][3] = { { "+", "a", "b" }, { "*", "c", "d" }, { "-", "a", "d" } };
+    for (size_t i = 0; i < 3; i++) {
+        rift_ast_t *part = i == 0 ? &left : &right;
+        rift_ast_id_t in_part = add_pair(part, pairs[i][0], pairs[i][1], pairs[i][2], i);
+        rift_ast_id_t in_whole = add_pair(&whole, pairs[i][0], pairs[i][1], pairs[i][2], i);
+        TEST_ASSERT(in_part != RIFT_AST_NONE && in_whole != RIFT_AST_NONE, "Pairs allocated");
+        TEST_ASSERT(rift_ast_add_child(part, roots[i == 0 ? 0 : 1], in_part) == RIFT_SUCCESS &&
+                    rift_ast_add_child(&whole, roots[2], in_whole) == RIFT_SUCCESS,
+                    "Pairs attached");
+    }
+    for (size_t t = 0; t < 3; t++) {
+        TEST_ASSERT(rift_ast_finalize(trees[t], roots[t]) == RIFT_SUCCESS, "Finalize");
+    }
+
+    TEST_ASSERT(rift_ast_append_children(&left, &right) == RIFT_SUCCESS, "Append");
+    TEST_ASSERT(left.count == whole.count, "All nodes copied");
+    TEST_ASSERT(left.child_counts[RIFT_AST_ROOT] == 3, "Top level extended");
+    TEST_ASSERT(check_preorder(&left), "Still preorder");
+    TEST_ASSERT(rift_ast_hash(&left, RIFT_AST_ROOT) == rift_ast_hash(&whole, RIFT_AST_ROOT),
+                "Same hash as the tree built whole");
+    TEST_ASSERT(strcmp(rift_ast_value(&left, 7, NULL), "-") == 0 &&
+                strcmp(rift_ast_value(&left, 9, NULL), "d") == 0, "Values re-interned");
+    TEST_ASSERT(right.count == 7, "Source unchanged");
+
+    rift_ast_release(&left);
+    rift_ast_release(&right);
+    rift_ast_release(&whole);
+    TEST_PASS("Append children");
+}
+
+/**
+ * Test: Hashes follow structure and values, never offsets
+ */
+static bool test_merkle_hashes(void) {
+    rift_ast_t base;
+    rift_ast_t moved;
+    rift_ast_t renamed;
+    rift_ast_t swapped;
+    rift_ast_t *trees[] = { &base, &moved, &renamed, &swapped };
+    for (size_t t = 0; t < 4; t++) {
+        rift_ast_init(trees[t]);
+    }
+
+    TEST_ASSERT(build_sample(&base, "d", false, false, 0) &&
+                build_sample(&moved, "d", false, false, 500) &&
+                build_sample(&renamed, "z", false, false, 0) &&
+                build_sample(&swapped, "d", true, false, 0), "Trees built");
+
+    uint64_t hash = rift_ast_hash(&base, RIFT_AST_ROOT);
+    TEST_ASSERT(hash != 0, "Root hashed");
+    TEST_ASSERT(rift_ast_hash(&moved, RIFT_AST_ROOT) == hash, "Offsets do not count");
+    TEST_ASSERT(rift_ast_hash(&renamed, RIFT_AST_ROOT) != hash, "A leaf value counts");
+    TEST_ASSERT(rift_ast_hash(&swapped, RIFT_AST_ROOT) != hash, "Child order counts");
+
+    /* program(+ a b, * (- c d) e): the renamed tree still has "+ a b" */
+    TEST_ASSERT(rift_ast_hash(&renamed, 1) == rift_ast_hash(&base, 1),
+                "Equal subtrees hash alike across trees");
+    TEST_ASSERT(rift_ast_hash(&renamed, 4) != rift_ast_hash(&base, 4),
+                "A change reaches every ancestor");
+    TEST_ASSERT(rift_ast_hash(&base, 1) != rift_ast_hash(&base, 4), "Distinct subtrees");
+    TEST_ASSERT(rift_ast_hash(&base, 99) == 0, "Out of range");
+
+    for (size_t t = 0; t < 4; t++) {
+        rift_ast_release(trees[t]);
+    }
+    TEST_PASS("Merkle hashes");
+}
+
+/**
+ * Test: The first difference is located down one path
+ */
+static bool test_find_difference(void) {
+    rift_ast_t base;
+    rift_ast_t other;
+    rift_ast_init(&base);
+    rift_ast_init(&other);
+    TEST_ASSERT(build_sample(&base, "d", false, false, 0), "Base built");
+
+    rift_ast_id_t node_a = 0;
+    rift_ast_id_t node_b = 0;
+
+    /* Isomorphic */
+    TEST_ASSERT(build_sample(&other, "d", false, false, 100), "Copy built");
+    TEST_ASSERT(rift_ast_find_difference(&base, &other, &node_a, &node_b) == RIFT_SUCCESS,
+                "Isomorphic trees match");
+    TEST_ASSERT(node_a == RIFT_AST_NONE && node_b == RIFT_AST_NONE, "No node reported");
+    rift_ast_release(&other);
+
+    /* A leaf deep in the second statement */
+    rift_ast_init(&other);
+    TEST_ASSERT(build_sample(&other, "z", false, false, 0), "Renamed built");
+    TEST_ASSERT(rift_ast_find_difference(&base, &other, &node_a, &node_b)
+                == RIFT_ERROR_VALIDATION_FAILED, "Renamed leaf differs");
+    TEST_ASSERT(strcmp(rift_ast_value(&base, node_a, NULL), "d") == 0 &&
+                strcmp(rift_ast_value(&other, node_b, NULL), "z") == 0, "The leaf is reported");
+    rift_ast_release(&other);
+
+    /* Same children in another order */
+    rift_ast_init(&other);
+    TEST_ASSERT(build_sample(&other, "d", true, false, 0), "Swapped built");
+    TEST_ASSERT(rift_ast_find_difference(&base, &other, &node_a, &node_b)
+                == RIFT_ERROR_VALIDATION_FAILED, "Swapped children differ");
+    TEST_ASSERT(node_a == 2 && node_b == 2, "First differing child of '+'");
+    rift_ast_release(&other);
+
+    /* An extra statement: the root's child count differs */
+    rift_ast_init(&other);
+    TEST_ASSERT(build_sample(&other, "d", false, true, 0), "Extended built");
+    TEST_ASSERT(rift_ast_find_difference(&base, &other, &node_a, &node_b)
+                == RIFT_ERROR_VALIDATION_FAILED, "Extra child differs");
+    TEST_ASSERT(node_a == RIFT_AST_ROOT && node_b == RIFT_AST_ROOT, "Root reported");
+    rift_ast_release(&other);
+
+    rift_ast_release(&base);
+    TEST_PASS("Find difference");
+}
+
+/**
+ * Test: Repeated subtrees in one tree are stored once
+ */
+static bool test_dag_sharing(void) {
+    rift_ast_t tree;
+    rift_ast_init(&tree);
+
+    /* program(+ a b, * (+ a b) (+ a b), + a b) */
+    rift_ast_id_t root = rift_ast_add_node(&tree, AST_NODE_PROGRAM, "program", 7, 0);
+    rift_ast_id_t first = add_pair(&tree, "+", "a", "b", 10);
+    rift_ast_id_t left = add_pair(&tree, "+", "a", "b", 20);
+    rift_ast_id_t right = add_pair(&tree, "+", "a", "b", 30);
+    rift_ast_id_t product = rift_ast_add_node(&tree, AST_NODE_BINARY_OP, "*", 1, 25);
+    rift_ast_id_t last = add_pair(&tree, "+", "a", "b", 40);
+    TEST_ASSERT(root != RIFT_AST_NONE && first != RIFT_AST_NONE && left != RIFT_AST_NONE &&
+                right != RIFT_AST_NONE && product != RIFT_AST_NONE && last != RIFT_AST_NONE,
+                "Nodes allocated");
+    TEST_ASSERT(rift_ast_add_child(&tree, product, left) == RIFT_SUCCESS &&
+                rift_ast_add_child(&tree, product, right) == RIFT_SUCCESS &&
+                rift_ast_add_child(&tree, root, first) == RIFT_SUCCESS &&
+                rift_ast_add_child(&tree, root, product) == RIFT_SUCCESS &&
+                rift_ast_add_child(&tree, root, last) == RIFT_SUCCESS, "Children attached");
+    TEST_ASSERT(rift_ast_finalize(&tree, root) == RIFT_SUCCESS, "Finalize");
+
+    rift_ast_dag_t dag;
+    rift_ast_dag_init(&dag);
+    rift_ast_id_t dag_root = RIFT_AST_NONE;
+    TEST_ASSERT(rift_ast_dag_intern(&dag, &tree, &dag_root) == RIFT_SUCCESS, "Intern");
+
+    /* a, b, +, *, program */
+    TEST_ASSERT(tree.count == 14 && dag.count == 5, "One node per distinct subtree");
+    TEST_ASSERT(dag.hashes[dag_root] == rift_ast_hash(&tree, RIFT_AST_ROOT), "Root hash kept");
+    TEST_ASSERT(strcmp(rift_ast_symbol_text(&dag.arena, dag.values[dag_root], NULL),
+                       "program") == 0, "Values re-interned");
+
+    uint32_t count = 0;
+    const rift_ast_id_t *children = rift_ast_dag_children(&dag, dag_root, &count);
+    TEST_ASSERT(count == 3 && children[0] == children[2], "Repeated statements share a node");
+    rift_ast_id_t sum = children[0];
+    TEST_ASSERT(dag.offsets[sum] == 10, "Earliest occurrence's offset");
+
+    const rift_ast_id_t *operands = rift_ast_dag_children(&dag, children[1], &count);
+    TEST_ASSERT(count == 2 && operands[0] == sum && operands[1] == sum,
+                "Nested repeats share the same node");
+    const rift_ast_id_t *leaves = rift_ast_dag_children(&dag, sum, &count);
+    TEST_ASSERT(count == 2 && rift_ast_dag_children(&dag, leaves[0], &count) == NULL &&
+                count == 0, "Leaves have no children");
+
+    bool ordered = true;
+    for (rift_ast_id_t node = 0; node < dag.count; node++) {
+        const rift_ast_id_t *edges = rift_ast_dag_children(&dag, node, &count);
+        for (uint32_t i = 0; i < count; i++) {
+            ordered &= edges[i] < node;
+        }
+    }
+    TEST_ASSERT(ordered, "Children precede their parents");
+
+    rift_ast_dag_release(&dag);
+    TEST_ASSERT(dag.count == 0 && dag.edge_count == 0, "Release empties the DAG");
+    rift_ast_release(&tree);
+    TEST_PASS("DAG sharing");
+}
+
+/**
+ * Test: Later trees reuse what earlier ones added
+ */
+static bool test_dag_across_trees(void) {
+    rift_ast_t base;
+    rift_ast_t renamed;
+    rift_ast_t copy;
+    rift_ast_init(&base);
+    rift_ast_init(&renamed);
+    rift_ast_init(&copy);
+    TEST_ASSERT(build_sample(&base, "d", false, false, 0) &&
+                build_sample(&renamed, "z", false, false, 100) &&
+                build_sample(&copy, "d", false, false, 200), "Trees built");
+
+    rift_ast_dag_t dag;
+    rift_ast_dag_init(&dag);
+    rift_ast_id_t roots[3];
+    TEST_ASSERT(rift_ast_dag_intern(&dag, &base, &roots[0]) == RIFT_SUCCESS, "First tree");
+    TEST_ASSERT(dag.count == 9, "Nine distinct subtrees");
+
+    /* Only z, - c z, * and program are new */
+    TEST_ASSERT(rift_ast_dag_intern(&dag, &renamed, &roots[1]) == RIFT_SUCCESS, "Second tree");
+    TEST_ASSERT(dag.count == 13 && roots[1] != roots[0], "Changed path added");
+
+    uint32_t count = 0;
+    const rift_ast_id_t *first = rift_ast_dag_children(&dag, roots[0], &count);
+    const rift_ast_id_t *second = rift_ast_dag_children(&dag, roots[1], &count);
+    TEST_ASSERT(first[0] == second[0] && first[1] != second[1], "Unchanged statement shared");
+
+    /* An isomorphic tree adds nothing and keeps the first offsets */
+    TEST_ASSERT(rift_ast_dag_intern(&dag, &copy, &roots[2]) == RIFT_SUCCESS, "Third tree");
+    TEST_ASSERT(dag.count == 13 && roots[2] == roots[0], "Whole tree shared");
+    TEST_ASSERT(dag.offsets[roots[2]] == 0, "Offsets of the first occurrence");
+
+    rift_ast_dag_release(&dag);
+    rift_ast_release(&base);
+    rift_ast_release(&renamed);
+    rift_ast_release(&copy);
+    TEST_PASS("DAG across trees");
+}
+
+/**
+ * Utility: Check the finalized layout: first child at id + 1, siblings
+ * at the previous sibling's subtree end, children filling the subtree
+ */
+static bool check_preorder(const rift_ast_t *ast) {
+    if (!ast->preorder || ast->count == 0 || ast->subtree_end[RIFT_AST_ROOT] != ast->count) {
+        return false;
+    }
+
+    for (rift_ast_id_t id = 0; id < ast->count; id++) {
+        uint32_t end = ast->subtree_end[id];
+        if (end <= id || end > ast->count) {
+            return false;
+        }
+        if (ast->first_child[id] == RIFT_AST_NONE) {
+            if (end != id + 1 || ast->child_counts[id] != 0) {
+                return false;
+            }
+            continue;
+        }
+        if (ast->first_child[id] != id + 1) {
+            return false;
+        }
+
+        uint32_t children = 0;
+        rift_ast_id_t last = RIFT_AST_NONE;
+        for (rift_ast_id_t child = id + 1; child < end; child = ast->subtree_end[child]) {
+            rift_ast_id_t next = ast->next_sibling[child];
+            if (next != (ast->subtree_end[child] < end ? ast->subtree_end[child] : RIFT_AST_NONE)) {
+                return false;
+            }
+            last = child;
+            children++;
+        }
+        if (children != ast->child_counts[id] || last != ast->last_child[id]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* op(left, right), children added before the parent is complete */
+static rift_ast_id_t add_pair(rift_ast_t *ast, const char *op, const char *left,
+                              const char *right, size_t offset) {
+    rift_ast_id_t a = rift_ast_add_node(ast, AST_NODE_IDENTIFIER, left, strlen(left), offset);
+    rift_ast_id_t b = rift_ast_add_node(ast, AST_NODE_IDENTIFIER, right, strlen(right), offset);
+    rift_ast_id_t node = rift_ast_add_node(ast, AST_NODE_BINARY_OP, op, strlen(op), offset);
+    if (a == RIFT_AST_NONE || b == RIFT_AST_NONE || node == RIFT_AST_NONE ||
+        rift_ast_add_child(ast, node, a) != RIFT_SUCCESS ||
+        rift_ast_add_child(ast, node, b) != RIFT_SUCCESS) {
+        return RIFT_AST_NONE;
+    }
+    return node;
+}
+
+/* program(+ a b, * (- c <leaf>) e [, extra]); swap gives + b a */
+static bool build_sample(rift_ast_t *ast, const char *leaf, bool swap, bool extra,
+                         size_t offset) {
+    rift_ast_id_t root = rift_ast_add_node(ast, AST_NODE_PROGRAM, "program", 7, offset);
+    rift_ast_id_t sum = add_pair(ast, "+", swap ? "b" : "a", swap ? "a" : "b", offset + 1);
+    rift_ast_id_t diff = add_pair(ast, "-", "c", leaf, offset + 2);
+    rift_ast_id_t e = rift_ast_add_node(ast, AST_NODE_IDENTIFIER, "e", 1, offset + 3);
+    rift_ast_id_t product = rift_ast_add_node(ast, AST_NODE_BINARY_OP, "*", 1, offset + 4);
+    if (root == RIFT_AST_NONE || sum == RIFT_AST_NONE || diff == RIFT_AST_NONE ||
+        e == RIFT_AST_NONE || product == RIFT_AST_NONE ||
+        rift_ast_add_child(ast, product, diff) != RIFT_SUCCESS ||
+        rift_ast_add_child(ast, product, e) != RIFT_SUCCESS ||
+        rift_ast_add_child(ast, root, sum) != RIFT_SUCCESS ||
+        rift_ast_add_child(ast, root, product) != RIFT_SUCCESS) {
+        return false;
+    }
+    if (extra) {
+        rift_ast_id_t more = rift_ast_add_node(ast, AST_NODE_IDENTIFIER, "f", 1, offset + 5);
+        if (more == RIFT_AST_NONE || rift_ast_add_child(ast, root, more) != RIFT_SUCCESS) {
+            return false;
+        }
+    }
+    return rift_ast_finalize(ast, root) == RIFT_SUCCESS;
+}
+
+/**
+ * Utility: Run individual test and track results
+ */
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
+
+/**
+ * Utility: Print final test summary
+ */
+static void print_test_summary(void) {
+    printf("\n=================================================================\n");
+    printf("RIFT Stage 1 AST Validation Results\n");
+    printf("=================================================================\n");
+    printf("Tests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+        printf("\nSTATUS: STAGE 1 VALIDATION FAILED\n");
+    } else {
+        printf("\nSTATUS: STAGE 1 VALIDATION PASSED\n");
+    }
+
+    printf("=================================================================\n");
+}
@@ -0,0 +1,658 @@
+/**
+ * =================================================================
+ * test_stage1_parser.c - RIFT Stage 1 Parser Validation Suite
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: src/core/stage-1 descent, parallel and LALR parsers
+ * OBINexus Computing Framework - Aegis Project
+ * Collaborator: Nnamdi Michael Okpala
+ * =================================================================
+ */
+
+#include "rift/core/stage-1/parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test framework macros */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s\n", message); \
+            printf("  Assertion failed: %s\n", #condition); \
+            printf("  File: %s, Line: %d\n", __FILE__, __LINE__); \
+            return false; \
+        } \
+    } while(0)
+
+#define TEST_PASS(message) \
+    do { \
+        printf("PASS: %s\n", message); \
+        return true; \
+    } while(0)
+
+/* Test result tracking */
+typedef struct {
+    int tests_run;
+    int tests_passed;
+    int tests_failed;
+    char last_failure[256];
+} TestSuite;
+
+static TestSuite g_test_suite = {0};
+
+/* Stage 0 tokens for a source string, fed to a stage 1 parser */
+typedef struct {
+    rift_tokenizer_state_t tokenizer;
+    rift_parser_state_t parser;
+} ParseFixture;
+
+/* Hand-built token stream for inputs past the tokenizer's capacity */
+typedef struct {
+    rift_token_t *tokens;
+    size_t count;
+    size_t capacity;
+} TokenBuffer;
+
+/* Forward declarations */
+static bool test_precedence(void);
+static bool test_declarations(void);
+static bool test_declaration_errors(void);
+static bool test_deep_nesting(void);
+static bool test_parallel_matches_sequential(void);
+static bool test_lalr_matches_descent(void);
+static bool test_consistency_outside_grammar(void);
+static bool test_shared_output(void);
+static bool test_token_index(void);
+
+/* Utility functions */
+static bool fixture_open(ParseFixture *fixture, const char *source);
+static void fixture_close(ParseFixture *fixture);
+static int parse_source(const char *source, char *rendered, size_t size);
+static bool token_push(TokenBuffer *buffer, rift_token_type_t type, const char *value);
+static bool build_program(TokenBuffer *buffer, size_t statements);
+static int parse_tokens(const TokenBuffer *buffer, size_t threads, rift_ast_t *out);
+static void render_tree(const rift_ast_t *ast, rift_ast_id_t node, char *out, size_t size);
+static void run_test(const char *test_name, bool (*test_func)(void));
+static void print_test_summary(void);
+
+/**
+ * Main test entry point
+ */
+int main(void) {
+    printf("=================================================================\n");
+    printf("RIFT Stage 1 Parser Validation Suite\n");
+    printf("=================================================================\n\n");
+
+    run_test("Operator Precedence", test_precedence);
+    run_test("Declarations", test_declarations);
+    run_test("Declaration Errors", test_declaration_errors);
+    run_test("Deep Nesting", test_deep_nesting);
+    run_test("Parallel Matches Sequential", test_parallel_matches_sequential);
+    run_test("LALR Matches Descent", test_lalr_matches_descent);
+    run_test("Consistency Outside Grammar", test_consistency_outside_grammar);
+    run_test("Shared Output", test_shared_output);
+    run_test("Token Index", test_token_index);
+
+    print_test_summary();
+
+    return (g_test_suite.tests_failed == 0) ? 0 : 1;
+}
+
+/**
+ * Test: Binding strength and associativity from operators.def
+ */
+static bool test_precedence(void) {
+    static const struct {
+        const char *source;
+        const char *tree;
+    } cases[] = {
+        { "a + b * c",      "(program (+ a (* b c)))" },
+        { "a - b - c",      "(program (- (- a b) c))" },
+        { "a ** b ** c",    "(program (** a (** b c)))" },
+        { "(a + b) * c",    "(program (* (+ a b) c))" },
+        { "-a * b",         "(program (* (- a) b))" },
+        { "a || b && c == d", "(program (|| a (&& b (== c d))))" },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char rendered[256];
+        TEST_ASSERT(parse_source(cases[i].source, rendered, sizeof(rendered)) == RIFT_SUCCESS,
+                    "Expression parses");
+        if (strcmp(rendered, cases[i].tree) != 0) {
+            printf("  %s -> %s\n", cases[i].source, rendered);
+        }
+        TEST_ASSERT(strcmp(rendered, cases[i].tree) == 0, "Tree shape");
+    }
+
+    TEST_PASS("Precedence and associativity");
+}
+
+/**
+ * Test: Declarations with and without an initializer
+ */
+static bool test_declarations(void) {
+    char rendered[256];
+    TEST_ASSERT(parse_source("let x = a + 1; const y = x", rendered, sizeof(rendered))
+                == RIFT_SUCCESS, "Declarations parse");
+    TEST_ASSERT(strcmp(rendered, "(program (let x (+ a 1)) (const y x))") == 0,
+                "Name then initializer under the keyword");
+
+    TEST_ASSERT(parse_source("let z; z", rendered, sizeof(rendered)) == RIFT_SUCCESS,
+                "Declaration without initializer");
+    TEST_ASSERT(strcmp(rendered, "(program (let z) z)") == 0, "Name only");
+
+    TEST_PASS("Declarations");
+}
+
+/**
+ * Test: A failed initializer fails the parse instead of being dropped
+ */
+static bool test_declaration_errors(void) {
+    static const struct {
+        const char *source;
+        int expected;
+    } cases[] = {
+        { "let x = (a + b",  RIFT_ERROR_UNMATCHED_PARENTHESES },
+        { "let x = a +",     RIFT_ERROR_INVALID_EXPRESSION },
+        { "let x = ;",       RIFT_ERROR_INVALID_EXPRESSION },
+        { "let x =",         RIFT_ERROR_INVALID_EXPRESSION },
+        { "let 1 = a",       RIFT_ERROR_SYNTAX_ERROR },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char rendered[256];
+        int result = parse_source(cases[i].source, rendered, sizeof(rendered));
+        if (result != cases[i].expected) {
+            printf("  %s -> %d\n", cases[i].source, result);
+        }
+        TEST_ASSERT(result == cases[i].expected, "Error code");
+    }
+
+    TEST_PASS("Declaration errors reported");
+}
+
+/**
+ * Test: Nesting depth is bounded by memory, not the C stack
+ */
+static bool test_deep_nesting(void) {
+    const size_t depth = 100000;
+    TokenBuffer buffer = {0};
+    bool pushed = true;
+
+    /* let v = ((((...(-(-(...-x)))...)))) */
+    pushed &= token_push(&buffer, TOKEN_KEYWORD, "let");
+    pushed &= token_push(&buffer, TOKEN_IDENTIFIER, "v");
+    pushed &= token_push(&buffer, TOKEN_OPERATOR, "=");
+    for (size_t i = 0; i < depth; i++) {
+        pushed &= token_push(&buffer, TOKEN_PUNCTUATION, "(");
+    }
+    for (size_t i = 0; i < depth; i++) {
+        pushed &= token_push(&buffer, TOKEN_OPERATOR, "-");
+    }
+    pushed &= token_push(&buffer, TOKEN_IDENTIFIER, "x");
+    for (size_t i = 0; i < depth; i++) {
+        pushed &= token_push(&buffer, TOKEN_PUNCTUATION, ")");
+    }
+    pushed &= token_push(&buffer, TOKEN_EOF, "");
+    TEST_ASSERT(pushed, "Token buffer allocation");
+
+    rift_parser_state_t parser;
+    TEST_ASSERT(rift_parser_init(buffer.tokens, buffer.count, &parser) == RIFT_SUCCESS,
+                "Parser init");
+    int result = rift_parser_process(&parser);
+
+    const rift_ast_t *ast = rift_parser_get_ast(&parser);
+    bool shaped = result == RIFT_SUCCESS && ast &&
+                  ast->count == depth + 4 &&
+                  rift_ast_complexity(ast, RIFT_AST_ROOT) == depth + 4 &&
+                  ast->kinds[1] == AST_NODE_DECLARATION &&
+                  ast->kinds[3] == AST_NODE_UNARY_OP &&
+                  ast->kinds[depth + 3] == AST_NODE_IDENTIFIER;
+
+    rift_parser_cleanup(&parser);
+    free(buffer.tokens);
+    TEST_ASSERT(result == RIFT_SUCCESS, "Deeply nested parse");
+    TEST_ASSERT(shaped, "One unary node per level");
+
+    TEST_PASS("Deep nesting without recursion");
+}
+
+/**
+ * Test: Any thread count yields the tree a sequential parse builds
+ */
+static bool test_parallel_matches_sequential(void) {
+    TokenBuffer buffer = {0};
+    TEST_ASSERT(build_program(&buffer, 3000), "Token buffer allocation");
+    TEST_ASSERT(buffer.count >= RIFT_PARALLEL_MIN_TOKENS, "Large enough to go parallel");
+
+    rift_ast_t sequential;
+    int result = parse_tokens(&buffer, 1, &sequential);
+    if (result != RIFT_SUCCESS) {
+        free(buffer.tokens);
+    }
+    TEST_ASSERT(result == RIFT_SUCCESS, "Sequential parse");
+
+    static const size_t thread_counts[] = { 2, 4, 7, 16 };
+    bool matched = true;
+    for (size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++) {
+        rift_ast_t parallel;
+        if (parse_tokens(&buffer, thread_counts[i], &parallel) != RIFT_SUCCESS) {
+            matched = false;
+            break;
+        }
+        matched &= rift_ast_hash(&parallel, RIFT_AST_ROOT) ==
+                   rift_ast_hash(&sequential, RIFT_AST_ROOT);
+        matched &= parallel.count == sequential.count;
+        matched &= rift_ast_find_difference(&sequential, &parallel, NULL, NULL) == RIFT_SUCCESS;
+        matched &= memcmp(parallel.offsets, sequential.offsets,
+                          sequential.count * sizeof(uint32_t)) == 0;
+        rift_ast_release(&parallel);
+    }
+
+    rift_ast_release(&sequential);
+    free(buffer.tokens);
+    TEST_ASSERT(matched, "Identical root hash, shape and offsets");
+
+    TEST_PASS("Parallel and sequential trees agree");
+}
+
+/**
+ * Test: Both parsers build the same tree for grammar input
+ */
+static bool test_lalr_matches_descent(void) {
+    static const char *sources[] = {
+        "let x = a + b * c; const y = -x ** 2; x = y += 1",
+        "(a || b) && !c; ~d ^ e | f & g; h << 2 >= i >> 1 != j",
+        "let s = \"esc\\taped\"; let f = 1.5e3 % 7; ; ;",
+        "a",
+        "",
+    };
+
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+        ParseFixture descent;
+        ParseFixture lalr;
+        TEST_ASSERT(fixture_open(&descent, sources[i]), "Descent fixture");
+        if (!fixture_open(&lalr, sources[i])) {
+            fixture_close(&descent);
+            TEST_ASSERT(false, "LALR fixture");
+        }
+        rift_parser_set_bottom_up(&lalr.parser, true);
+
+        bool agreed = rift_parser_process(&descent.parser) == RIFT_SUCCESS &&
+                      rift_parser_process(&lalr.parser) == RIFT_SUCCESS;
+        if (agreed) {
+            rift_ast_id_t difference = 0;
+            agreed = rift_ast_hash(&descent.parser.ast, RIFT_AST_ROOT) ==
+                     rift_ast_hash(&lalr.parser.ast, RIFT_AST_ROOT) &&
+                     rift_parser_validate_consistency(&descent.parser, &difference)
+                     == RIFT_SUCCESS && difference == RIFT_AST_NONE &&
+                     rift_parser_validate_consistency(&lalr.parser, &difference)
+                     == RIFT_SUCCESS && difference == RIFT_AST_NONE;
+        }
+
+        fixture_close(&descent);
+        fixture_close(&lalr);
+        if (!agreed) {
+            printf("  %s\n", sources[i]);
+        }
+        TEST_ASSERT(agreed, "Identical root hashes");
+    }
+
+    /* The large generated program, past the tokenizer's capacity */
+    TokenBuffer buffer = {0};
+    TEST_ASSERT(build_program(&buffer, 3000), "Token buffer allocation");
+    rift_parser_state_t parser;
+    TEST_ASSERT(rift_parser_init(buffer.tokens, buffer.count, &parser) == RIFT_SUCCESS,
+                "Parser init");
+    rift_parser_set_bottom_up(&parser, true);
+    rift_ast_id_t difference = 0;
+    int result = rift_parser_process(&parser);
+    if (result == RIFT_SUCCESS) {
+        result = rift_parser_validate_consistency(&parser, &difference);
+    }
+    rift_parser_cleanup(&parser);
+    free(buffer.tokens);
+    TEST_ASSERT(result == RIFT_SUCCESS && difference == RIFT_AST_NONE,
+                "Large program agrees");
+
+    TEST_PASS("LALR and descent trees agree");
+}
+
+/**
+ * Test: Descent-only input is reported as not compared, not as a failure
+ */
+static bool test_consistency_outside_grammar(void) {
+    static const char *sources[] = {
+        "let x = 1 let y = 2",
+        "a b",
+        "{ a + b }",
+        "if a; b",
+        "a ) b",
+    };
+
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+        ParseFixture fixture;
+        TEST_ASSERT(fixture_open(&fixture, sources[i]), "Fixture");
+
+        rift_ast_id_t difference = 0;
+        int processed = rift_parser_process(&fixture.parser);
+        int result = processed == RIFT_SUCCESS
+                     ? rift_parser_validate_consistency(&fixture.parser, &difference)
+                     : processed;
+        bool noted = strncmp(fixture.parser.error_context.message, "Not compared", 12) == 0;
+
+        fixture_close(&fixture);
+        if (result != RIFT_SUCCESS) {
+            printf("  %s -> %d\n", sources[i], result);
+        }
+        TEST_ASSERT(result == RIFT_SUCCESS, "Descent accepts, check passes");
+        TEST_ASSERT(difference == RIFT_AST_NONE, "No difference reported");
+        TEST_ASSERT(noted, "Error context says the input was not compared");
+    }
+
+    TEST_PASS("Consistency check limited to the shared grammar");
+}
+
+/**
+ * Test: Parses into a shared DAG store each repeated subtree once
+ */
+static bool test_shared_output(void) {
+    static const char *sources[] = {
+        "a + b; a + b; (a + b) * (a + b)",
+        "let x = a + b; a + b",
+    };
+
+    rift_ast_dag_t dag;
+    rift_ast_dag_init(&dag);
+    rift_ast_id_t roots[2];
+    size_t counts[2];
+    for (size_t i = 0; i < 2; i++) {
+        ParseFixture fixture;
+        TEST_ASSERT(fixture_open(&fixture, sources[i]), "Fixture");
+        rift_parser_set_shared_output(&fixture.parser, &dag);
+        int result = rift_parser_process(&fixture.parser);
+        bool released = rift_parser_get_ast(&fixture.parser) == NULL;
+        roots[i] = fixture.parser.dag_root;
+        counts[i] = dag.count;
+        fixture_close(&fixture);
+        TEST_ASSERT(result == RIFT_SUCCESS, "Parse into the DAG");
+        TEST_ASSERT(released, "Only the shared form is kept");
+    }
+
+    /* a, b, +, *, program */
+    TEST_ASSERT(counts[0] == 5, "First parse stores distinct subtrees");
+    uint32_t count = 0;
+    const rift_ast_id_t *statements = rift_ast_dag_children(&dag, roots[0], &count);
+    TEST_ASSERT(count == 3 && statements[0] == statements[1], "Repeated statements shared");
+    const rift_ast_id_t *operands = rift_ast_dag_children(&dag, statements[2], &count);
+    TEST_ASSERT(count == 2 && operands[0] == statements[0] && operands[1] == statements[0],
+                "Repeats inside an expression shared");
+
+    /* Second parse adds x, let x (a + b) and its program node */
+    TEST_ASSERT(counts[1] == 8, "Second parse reuses the first's subtrees");
+    statements = rift_ast_dag_children(&dag, roots[1], &count);
+    TEST_ASSERT(count == 2 && statements[1] == operands[0], "Shared across parses");
+
+    rift_ast_dag_release(&dag);
+    TEST_PASS("Shared output");
+}
+
+/**
+ * Test: Token types are read by index, and past the end reads as EOF
+ */
+static bool test_token_index(void) {
+    TokenBuffer buffer = {0};
+    TEST_ASSERT(build_program(&buffer, 40), "Token buffer allocation");
+
+    rift_parser_state_t parser;
+    TEST_ASSERT(rift_parser_init(buffer.tokens, buffer.count, &parser) == RIFT_SUCCESS,
+                "Parser initialization");
+    bool mirrored = parser.token_count == buffer.count;
+    for (size_t i = 0; mirrored && i < buffer.count; i++) {
+        mirrored = parser.token_types[i] == (uint8_t)buffer.tokens[i].type;
+    }
+    rift_parser_cleanup(&parser);
+    TEST_ASSERT(mirrored, "Type array mirrors the tokens");
+
+    /* Without the trailing EOF token the stream must parse the same */
+    rift_ast_t terminated;
+    rift_ast_t unterminated;
+    int result = parse_tokens(&buffer, 1, &terminated);
+    if (result != RIFT_SUCCESS) {
+        free(buffer.tokens);
+    }
+    TEST_ASSERT(result == RIFT_SUCCESS, "Parse with EOF token");
+
+    buffer.count--;
+    result = parse_tokens(&buffer, 1, &unterminated);
+    if (result != RIFT_SUCCESS) {
+        rift_ast_release(&terminated);
+        free(buffer.tokens);
+    }
+    TEST_ASSERT(result == RIFT_SUCCESS, "Parse without EOF token");
+
+    bool matched = rift_ast_hash(&terminated, RIFT_AST_ROOT) ==
+                   rift_ast_hash(&unterminated, RIFT_AST_ROOT);
+    matched &= rift_ast_find_difference(&terminated, &unterminated, NULL, NULL) == RIFT_SUCCESS;
+    rift_ast_release(&unterminated);
+    rift_ast_release(&terminated);
+
+    /* Declarations look ahead for a name and '='; the end stands in for EOF */
+    static const struct {
+        const char *tokens[4];
+        size_t count;
+        const char *tree;
+    } tails[] = {
+        { { "let", "z", "=", "a" }, 4, "(program (let z a))" },
+        { { "let", "z" },           2, "(program (let z))" },
+    };
+    static const rift_token_type_t types[] = {
+        TOKEN_KEYWORD, TOKEN_IDENTIFIER, TOKEN_OPERATOR, TOKEN_IDENTIFIER
+    };
+
+    for (size_t i = 0; matched && i < sizeof(tails) / sizeof(tails[0]); i++) {
+        buffer.count = 0;
+        for (size_t t = 0; t < tails[i].count; t++) {
+            matched &= token_push(&buffer, types[t], tails[i].tokens[t]);
+        }
+
+        rift_ast_t ast;
+        if (!matched || parse_tokens(&buffer, 1, &ast) != RIFT_SUCCESS) {
+            matched = false;
+            break;
+        }
+        char rendered[64] = "";
+        render_tree(&ast, RIFT_AST_ROOT, rendered, sizeof(rendered));
+        matched &= strcmp(rendered, tails[i].tree) == 0;
+        rift_ast_release(&ast);
+    }
+
+    free(buffer.tokens);
+    TEST_ASSERT(matched, "Same tree with or without the EOF token");
+
+    TEST_PASS("Token index access");
+}
+
+/**
+ * Utility: Tokenize source and prepare a parser over its tokens
+ */
+static bool fixture_open(ParseFixture *fixture, const char *source) {
+    if (rift_tokenizer_init(source, &fixture->tokenizer) != RIFT_SUCCESS) {
+        return false;
+    }
+    int count = rift_tokenizer_process(&fixture->tokenizer);
+    if (count <= 0 ||
+        rift_parser_init(rift_tokenizer_get_tokens(&fixture->tokenizer), (size_t)count,
+                         &fixture->parser) != RIFT_SUCCESS) {
+        rift_tokenizer_cleanup(&fixture->tokenizer);
+        return false;
+    }
+    rift_parser_set_tokenizer(&fixture->parser, &fixture->tokenizer);
+    return true;
+}
+
+static void fixture_close(ParseFixture *fixture) {
+    rift_parser_cleanup(&fixture->parser);
+    rift_tokenizer_cleanup(&fixture->tokenizer);
+}
+
+/**
+ * Utility: Parse source and render the tree as an s-expression
+ */
+static int parse_source(const char *source, char *rendered, size_t size) {
+    ParseFixture fixture;
+    if (!fixture_open(&fixture, source)) {
+        return RIFT_ERROR_TOKENIZATION_FAILED;
+    }
+
+    int result = rift_parser_process(&fixture.parser);
+    rendered[0] = '\0';
+    if (result == RIFT_SUCCESS) {
+        render_tree(rift_parser_get_ast(&fixture.parser), RIFT_AST_ROOT, rendered, size);
+    }
+
+    fixture_close(&fixture);
+    return result;
+}
+
+static bool token_push(TokenBuffer *buffer, rift_token_type_t type, const char *value) {
+    if (buffer->count == buffer->capacity) {
+        size_t grown = buffer->capacity ? buffer->capacity * 2 : 1024;
+        rift_token_t *tokens = realloc(buffer->tokens, grown * sizeof(rift_token_t));
+        if (!tokens) {
+            return false;
+        }
+        buffer->tokens = tokens;
+        buffer->capacity = grown;
+    }
+
+    rift_token_t *token = &buffer->tokens[buffer->count];
+    memset(token, 0, offsetof(rift_token_t, value));
+    snprintf(token->value, sizeof(token->value), "%s", value);
+    token->type = type;
+    token->offset = buffer->count;
+    token->length = strlen(value);
+    token->decoded = NULL;
+    token->constant_index = RIFT_NO_CONSTANT;
+    buffer->count++;
+    return true;
+}
+
+/* let v<i> = a * (b + <i % 7>) - c; every third statement also (v<i> + (d)) * -e; */
+static bool build_program(TokenBuffer *buffer, size_t statements) {
+    bool pushed = true;
+    for (size_t i = 0; i < statements; i++) {
+        char name[32];
+        char digit[8];
+        snprintf(name, sizeof(name), "v%zu", i);
+        snprintf(digit, sizeof(digit), "%zu", i % 7);
+
+        pushed &= token_push(buffer, TOKEN_KEYWORD, "let");
+        pushed &= token_push(buffer, TOKEN_IDENTIFIER, name);
+        pushed &= token_push(buffer, TOKEN_OPERATOR, "=");
+        pushed &= token_push(buffer, TOKEN_IDENTIFIER, "a");
+        pushed &= token_push(buffer, TOKEN_OPERATOR, "*");
+        pushed &= token_push(buffer, TOKEN_PUNCTUATION, "(");
+        pushed &= token_push(buffer, TOKEN_IDENTIFIER, "b");
+        pushed &= token_push(buffer, TOKEN_OPERATOR, "+");
+        pushed &= token_push(buffer, TOKEN_LITERAL_INTEGER, digit);
+        pushed &= token_push(buffer, TOKEN_PUNCTUATION, ")");
+        pushed &= token_push(buffer, TOKEN_OPERATOR, "-");
+        pushed &= token_push(buffer, TOKEN_IDENTIFIER, "c");
+        pushed &= token_push(buffer, TOKEN_PUNCTUATION, ";");
+        if (i % 3 == 0) {
+            pushed &= token_push(buffer, TOKEN_PUNCTUATION, "(");
+            pushed &= token_push(buffer, TOKEN_IDENTIFIER, name);
+            pushed &= token_push(buffer, TOKEN_OPERATOR, "+");
+            pushed &= token_push(buffer, TOKEN_PUNCTUATION, "(");
+            pushed &= token_push(buffer, TOKEN_IDENTIFIER, "d");
+            pushed &= token_push(buffer, TOKEN_PUNCTUATION, ")");
+            pushed &= token_push(buffer, TOKEN_PUNCTUATION, ")");
+            pushed &= token_push(buffer, TOKEN_OPERATOR, "*");
+            pushed &= token_push(buffer, TOKEN_OPERATOR, "-");
+            pushed &= token_push(buffer, TOKEN_IDENTIFIER, "e");
+            pushed &= token_push(buffer, TOKEN_PUNCTUATION, ";");
+        }
+    }
+    return pushed && token_push(buffer, TOKEN_EOF, "");
+}
+
+/* Parse hand-built tokens; on success the finalized tree moves to out */
+static int parse_tokens(const TokenBuffer *buffer, size_t threads, rift_ast_t *out) {
+    rift_parser_state_t parser;
+    int result = rift_parser_init(buffer->tokens, buffer->count, &parser);
+    if (result != RIFT_SUCCESS) {
+        return result;
+    }
+
+    rift_parser_set_threads(&parser, threads);
+    result = rift_parser_process(&parser);
+    if (result == RIFT_SUCCESS) {
+        *out = parser.ast;
+        rift_ast_init(&parser.ast);
+    }
+
+    rift_parser_cleanup(&parser);
+    return result;
+}
+
+/* Leaves print bare, interior nodes as (value children...) */
+static void render_tree(const rift_ast_t *ast, rift_ast_id_t node, char *out, size_t size) {
+    size_t used = strlen(out);
+    const char *value = rift_ast_value(ast, node, NULL);
+    if (ast->first_child[node] == RIFT_AST_NONE) {
+        snprintf(out + used, size - used, "%s", value);
+        return;
+    }
+
+    snprintf(out + used, size - used, "(%s", value);
+    for (rift_ast_id_t child = ast->first_child[node]; child != RIFT_AST_NONE;
+         child = ast->next_sibling[child]) {
+        used = strlen(out);
+        snprintf(out + used, size - used, " ");
+        render_tree(ast, child, out, size);
+    }
+    used = strlen(out);
+    snprintf(out + used, size - used, ")");
+}
+
+/**
+ * Utility: Run individual test and track results
+ */
+static void run_test(const char *test_name, bool (*test_func)(void)) {
+    printf("Running: %s... ", test_name);
+    fflush(stdout);
+
+    g_test_suite.tests_run++;
+
+    if (test_func()) {
+        g_test_suite.tests_passed++;
+    } else {
+        g_test_suite.tests_failed++;
+        snprintf(g_test_suite.last_failure, sizeof(g_test_suite.last_failure),
+                "%s", test_name);
+    }
+
+    printf("\n");
+}
+
+/**
+ * Utility: Print final test summary
+ */
+static void print_test_summary(void) {
+    printf("\n=================================================================\n");
+    printf("RIFT Stage 1 Parser Validation Results\n");
+    printf("=================================================================\n");
+    printf("Tests Run:    %d\n", g_test_suite.tests_run);
+    printf("Tests Passed: %d\n", g_test_suite.tests_passed);
+    printf("Tests Failed: %d\n", g_test_suite.tests_failed);
+
+    if (g_test_suite.tests_failed > 0) {
+        printf("Last Failure: %s\n", g_test_suite.last_failure);
+        printf("\nSTATUS: STAGE 1 VALIDATION FAILED\n");
+    } else {
+        printf("\nSTATUS: STAGE 1 VALIDATION PASSED\n");
+    }
+
+    printf("=================================================================\n");
+}
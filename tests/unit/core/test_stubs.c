@@ -0,0 +1,46 @@
+/*
+ * =================================================================
+ * test_stubs.c - Link-time stand-ins for the core unit tests
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Governance and error-context hooks
+ * OBINexus Computing Framework - Aegis Project
+ *
+ * The governance module and the shared error helpers are built
+ * outside this tree. These accept everything and record errors so
+ * the stage tests can link and inspect them.
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "rift/core/common.h"
+#include "rift/core/stage-0/tokenizer.h"
+
+typedef struct rift_ast rift_ast_t;
+
+int rift_governance_validate_token(const rift_token_t* token) {
+    (void)token;
+    return RIFT_SUCCESS;
+}
+
+int rift_governance_validate_ast_tree(const rift_ast_t* ast) {
+    (void)ast;
+    return RIFT_SUCCESS;
+}
+
+void rift_error_context_init(rift_error_context_t* context,
+                            rift_error_code_t error_code,
+                            const char* message,
+                            const rift_source_location_t* location,
+                            const char* function_name,
+                            const char* component_name) {
+    memset(context, 0, sizeof(*context));
+    context->error_code = error_code;
+    snprintf(context->message, sizeof(context->message), "%s", message ? message : "");
+    if (location) {
+        context->location = *location;
+    }
+    context->function_name = function_name;
+    context->component_name = component_name;
+}
@@ -0,0 +1,1510 @@
+/*
+ * =================================================================
+ * rift_lalrgen.c - RIFT Stage 1 Parse Table Generator (Build-Time Tool)
+ * RIFT: RIFT Is a Flexible Translator
+ * Component: Grammar -> LALR(1) action/goto tables as C arrays
+ * OBINexus Computing Framework - Stage 1 Implementation
+ *
+ * R.COMPILE(Grammar) -> LR(0) states -> LALR(1) lookaheads -> packed tables
+ * R.FLAGS(deterministic, build_time, shift_reduce)
+ *
+ * Grammar file format (one directive or rule per line, '#' starts a
+ * comment):
+ *
+ *     %token NAME...                   terminals without precedence
+ *     %left | %right | %nonassoc NAME...
+ *                                      terminals sharing one precedence
+ *                                      level; later lines bind tighter
+ *     %start NAME                      start symbol (default: first rule)
+ *     lhs : symbol... [%prec NAME] [{ action [N] }] [| symbol... ...]
+ *         | symbol... [%prec NAME] [{ action [N] }]
+ *
+ * A '|' starts another alternative for the current lhs, on the same
+ * line or at the start of the next one; an empty right side (or
+ * %empty) is an epsilon rule. Actions name driver operations
+ * and become <PREFIX>_ACTION_<NAME>; N is a 1-based symbol position.
+ * A rule without an action passes symbol 1 through ("none" if empty).
+ *
+ * Lookaheads are computed by the spontaneous-generation/propagation
+ * method over the LR(0) collection. Shift/reduce conflicts are settled
+ * by precedence as in yacc; any left unresolved are reported and the
+ * run fails. Each state's most common reduction becomes its default,
+ * and the remaining action rows and goto columns are packed into comb
+ * vectors by first-fit row displacement:
+ *
+ *     i = action_base[state] + terminal
+ *     action = action_check[i] == state ? action_value[i]
+ *                                       : -default_reduction[state]
+ *
+ * with action > 0 a shift to that state, < 0 a reduction by rule
+ * -action - 1 (rule 0 accepts) and 0 an error.
+ *
+ * Usage: rift_lalrgen <grammar> <output.c> <output.h>
+ *                     [--prefix NAME] [--include HDR]
+ * =================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#define LALRGEN_MAX_SYMBOLS     256
+#define LALRGEN_MAX_RULES       1024
+#define LALRGEN_MAX_RHS         16
+#define LALRGEN_MAX_LINE        1024
+#define LALRGEN_MAX_NAME        64
+#define LALRGEN_MAX_ACTIONS     64
+#define LALRGEN_MAX_STATES      32767   /* Shifts are int16_t action values */
+#define LALRGEN_EMPTY_CHECK     0xFFFF  /* uint16_t check: slot unused */
+
+typedef enum {
+    ASSOC_NONE,
+    ASSOC_LEFT,
+    ASSOC_RIGHT,
+    ASSOC_NONASSOC
+} Assoc;
+
+/* =================================================================
+ * BIT SETS (terminal sets; one extra bit for the '#' propagation marker)
+ * =================================================================
+ */
+
+typedef uint64_t Word;
+
+static int set_words;
+
+static Word* set_new(void) {
+    Word* set = calloc((size_t)set_words, sizeof(Word));
+    if (!set) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    return set;
+}
+
+static void set_add(Word* set, int bit) {
+    set[bit / 64] |= (Word)1 << (bit % 64);
+}
+
+static bool set_has(const Word* set, int bit) {
+    return (set[bit / 64] >> (bit % 64)) & 1;
+}
+
+/* set |= other; true if set grew */
+static bool set_union(Word* set, const Word* other) {
+    bool changed = false;
+    for (int i = 0; i < set_words; i++) {
+        Word merged = set[i] | other[i];
+        changed |= merged != set[i];
+        set[i] = merged;
+    }
+    return changed;
+}
+
+/* =================================================================
+ * GRAMMAR
+ * =================================================================
+ */
+
+typedef struct {
+    char name[LALRGEN_MAX_NAME];
+    bool declared_token;
+    bool has_rules;
+    int precedence;             /* 0: none */
+    Assoc assoc;
+    int number;                 /* Terminal or nonterminal number */
+} Symbol;
+
+typedef struct {
+    int lhs;                    /* Symbol table index, then nonterminal number */
+    int rhs[LALRGEN_MAX_RHS];   /* Symbol table indices, then grammar symbols */
+    int length;
+    int prec_symbol;            /* %prec symbol, -1 if none */
+    int precedence;
+    int action;                 /* Index into Grammar.actions */
+    int argument;
+    int line;
+} Rule;
+
+typedef struct {
+    Symbol symbols[LALRGEN_MAX_SYMBOLS];
+    int symbol_count;
+    Rule rules[LALRGEN_MAX_RULES];
+    int rule_count;
+    char actions[LALRGEN_MAX_ACTIONS][LALRGEN_MAX_NAME];
+    int action_count;
+    int start;                  /* Symbol table index, -1 until known */
+
+    /* After finalize_grammar: terminals are 0..T-1 ($end is 0), and
+     * nonterminal n is grammar symbol T + n ($accept is nonterminal 0) */
+    int terminal_count;
+    int nonterminal_count;
+    int* terminals;             /* Terminal number -> symbol table index */
+    int* nonterminals;          /* Nonterminal number -> symbol table index */
+    int* terminal_precedence;
+    Assoc* terminal_assoc;
+} Grammar;
+
+static int find_symbol(Grammar* grammar, const char* name, const char* path, int line) {
+    for (int i = 0; i < grammar->symbol_count; i++) {
+        if (strcmp(grammar->symbols[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (grammar->symbol_count == LALRGEN_MAX_SYMBOLS) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: too many symbols\n", path, line);
+        exit(EXIT_FAILURE);
+    }
+    if (strlen(name) >= LALRGEN_MAX_NAME) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: symbol name too long\n", path, line);
+        exit(EXIT_FAILURE);
+    }
+
+    Symbol* symbol = &grammar->symbols[grammar->symbol_count];
+    memset(symbol, 0, sizeof(*symbol));
+    strcpy(symbol->name, name);
+    return grammar->symbol_count++;
+}
+
+static int find_action(Grammar* grammar, const char* name, const char* path, int line) {
+    for (int i = 0; i < grammar->action_count; i++) {
+        if (strcmp(grammar->actions[i], name) == 0) {
+            return i;
+        }
+    }
+    if (grammar->action_count == LALRGEN_MAX_ACTIONS || strlen(name) >= LALRGEN_MAX_NAME) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: too many actions\n", path, line);
+        exit(EXIT_FAILURE);
+    }
+    strcpy(grammar->actions[grammar->action_count], name);
+    return grammar->action_count++;
+}
+
+static bool is_name(const char* word) {
+    if (!isalpha((unsigned char)word[0]) && word[0] != '_') {
+        return false;
+    }
+    for (const char* c = word; *c; c++) {
+        if (!isalnum((unsigned char)*c) && *c != '_') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Next whitespace-separated word; '{', '}', ':' and '|' are words of their own */
+static bool next_word(char** cursor, char* out) {
+    char* c = *cursor;
+    while (isspace((unsigned char)*c)) c++;
+    if (*c == '\0') {
+        *cursor = c;
+        return false;
+    }
+
+    size_t n = 0;
+    if (strchr("{}:|", *c)) {
+        out[n++] = *c++;
+    } else {
+        while (*c && !isspace((unsigned char)*c) && !strchr("{}:|", *c)) {
+            if (n + 1 < LALRGEN_MAX_NAME) out[n++] = *c;
+            c++;
+        }
+    }
+    out[n] = '\0';
+    *cursor = c;
+    return true;
+}
+
+static bool parse_declaration(Grammar* grammar, char* cursor, const char* path,
+                              int line, int* precedence_level) {
+    char word[LALRGEN_MAX_NAME];
+    next_word(&cursor, word);
+
+    Assoc assoc = ASSOC_NONE;
+    if (strcmp(word, "%start") == 0) {
+        if (!next_word(&cursor, word) || !is_name(word)) {
+            fprintf(stderr, "rift_lalrgen: %s:%d: expected %%start NAME\n", path, line);
+            return false;
+        }
+        grammar->start = find_symbol(grammar, word, path, line);
+        return true;
+    } else if (strcmp(word, "%left") == 0) {
+        assoc = ASSOC_LEFT;
+    } else if (strcmp(word, "%right") == 0) {
+        assoc = ASSOC_RIGHT;
+    } else if (strcmp(word, "%nonassoc") == 0) {
+        assoc = ASSOC_NONASSOC;
+    } else if (strcmp(word, "%token") != 0) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: unknown directive %s\n", path, line, word);
+        return false;
+    }
+
+    if (assoc != ASSOC_NONE) {
+        (*precedence_level)++;
+    }
+    while (next_word(&cursor, word)) {
+        if (!is_name(word)) {
+            fprintf(stderr, "rift_lalrgen: %s:%d: bad token name %s\n", path, line, word);
+            return false;
+        }
+        Symbol* symbol = &grammar->symbols[find_symbol(grammar, word, path, line)];
+        symbol->declared_token = true;
+        if (assoc != ASSOC_NONE) {
+            if (symbol->precedence != 0) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: %s already has a precedence\n",
+                        path, line, word);
+                return false;
+            }
+            symbol->precedence = *precedence_level;
+            symbol->assoc = assoc;
+        }
+    }
+    return true;
+}
+
+static Rule* new_rule(Grammar* grammar, int lhs, const char* path, int line) {
+    if (grammar->rule_count == LALRGEN_MAX_RULES - 1) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: too many rules\n", path, line);
+        return NULL;
+    }
+
+    /* Rule 0 is reserved for $accept */
+    Rule* rule = &grammar->rules[++grammar->rule_count];
+    memset(rule, 0, sizeof(*rule));
+    rule->lhs = lhs;
+    rule->prec_symbol = -1;
+    rule->action = -1;
+    rule->line = line;
+    grammar->symbols[lhs].has_rules = true;
+    return rule;
+}
+
+static bool finish_rule(Grammar* grammar, Rule* rule, const char* path, int line) {
+    if (rule->action < 0) {
+        rule->action = find_action(grammar, rule->length ? "pass" : "none", path, line);
+        rule->argument = rule->length ? 1 : 0;
+    }
+    if (rule->argument > rule->length) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: action argument past end of rule\n",
+                path, line);
+        return false;
+    }
+    return true;
+}
+
+static bool parse_rule(Grammar* grammar, char* cursor, const char* path, int line,
+                       int* current_lhs) {
+    char word[LALRGEN_MAX_NAME];
+    next_word(&cursor, word);
+
+    if (strcmp(word, "|") != 0) {
+        char colon[LALRGEN_MAX_NAME];
+        if (!is_name(word) || !next_word(&cursor, colon) || strcmp(colon, ":") != 0) {
+            fprintf(stderr, "rift_lalrgen: %s:%d: expected 'lhs : symbols'\n", path, line);
+            return false;
+        }
+        *current_lhs = find_symbol(grammar, word, path, line);
+        if (grammar->start < 0) {
+            grammar->start = *current_lhs;
+        }
+    } else if (*current_lhs < 0) {
+        fprintf(stderr, "rift_lalrgen: %s:%d: '|' without a rule\n", path, line);
+        return false;
+    }
+
+    Rule* rule = new_rule(grammar, *current_lhs, path, line);
+    if (!rule) {
+        return false;
+    }
+
+    while (next_word(&cursor, word)) {
+        if (rule->action >= 0 && strcmp(word, "|") != 0) {
+            fprintf(stderr, "rift_lalrgen: %s:%d: text after action\n", path, line);
+            return false;
+        }
+
+        if (strcmp(word, "|") == 0) {
+            if (!finish_rule(grammar, rule, path, line) ||
+                !(rule = new_rule(grammar, *current_lhs, path, line))) {
+                return false;
+            }
+        } else if (strcmp(word, "{") == 0) {
+            char argument[LALRGEN_MAX_NAME];
+            if (!next_word(&cursor, word) || !is_name(word)) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: expected an action name\n", path, line);
+                return false;
+            }
+            rule->action = find_action(grammar, word, path, line);
+            if (!next_word(&cursor, argument)) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: unterminated action\n", path, line);
+                return false;
+            }
+            if (strcmp(argument, "}") != 0) {
+                char* end;
+                long value = strtol(argument, &end, 10);
+                if (*end || value < 1 || value > LALRGEN_MAX_RHS ||
+                    !next_word(&cursor, word) || strcmp(word, "}") != 0) {
+                    fprintf(stderr, "rift_lalrgen: %s:%d: expected '{ action [N] }'\n",
+                            path, line);
+                    return false;
+                }
+                rule->argument = (int)value;
+            }
+        } else if (strcmp(word, "%prec") == 0) {
+            if (!next_word(&cursor, word) || !is_name(word)) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: expected %%prec NAME\n", path, line);
+                return false;
+            }
+            rule->prec_symbol = find_symbol(grammar, word, path, line);
+        } else if (strcmp(word, "%empty") == 0) {
+            continue;
+        } else if (is_name(word)) {
+            if (rule->length == LALRGEN_MAX_RHS) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: rule too long\n", path, line);
+                return false;
+            }
+            rule->rhs[rule->length++] = find_symbol(grammar, word, path, line);
+        } else {
+            fprintf(stderr, "rift_lalrgen: %s:%d: unexpected '%s'\n", path, line, word);
+            return false;
+        }
+    }
+    return finish_rule(grammar, rule, path, line);
+}
+
+static bool load_grammar(const char* path, Grammar* grammar) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "rift_lalrgen: cannot open grammar %s\n", path);
+        return false;
+    }
+
+    char line[LALRGEN_MAX_LINE];
+    int line_number = 0;
+    int precedence_level = 0;
+    int current_lhs = -1;
+    bool ok = true;
+    grammar->start = -1;
+
+    while (ok && fgets(line, sizeof(line), file)) {
+        line_number++;
+        char* comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+
+        char* cursor = line;
+        while (isspace((unsigned char)*cursor)) cursor++;
+        if (*cursor == '\0') {
+            continue;
+        }
+
+        if (*cursor == '%') {
+            ok = parse_declaration(grammar, cursor, path, line_number, &precedence_level);
+        } else {
+            ok = parse_rule(grammar, cursor, path, line_number, &current_lhs);
+        }
+    }
+    fclose(file);
+
+    if (ok && grammar->rule_count == 0) {
+        fprintf(stderr, "rift_lalrgen: %s: no rules defined\n", path);
+        ok = false;
+    }
+    return ok;
+}
+
+/*
+ * finalize_grammar - Number the symbols and add $accept : start
+ */
+static bool finalize_grammar(Grammar* grammar, const char* path) {
+    int symbol_count = grammar->symbol_count;
+    grammar->terminals = calloc((size_t)symbol_count + 1, sizeof(int));
+    grammar->nonterminals = calloc((size_t)symbol_count + 1, sizeof(int));
+    grammar->terminal_precedence = calloc((size_t)symbol_count + 1, sizeof(int));
+    grammar->terminal_assoc = calloc((size_t)symbol_count + 1, sizeof(Assoc));
+    if (!grammar->terminals || !grammar->nonterminals ||
+        !grammar->terminal_precedence || !grammar->terminal_assoc) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        return false;
+    }
+
+    Symbol* start = &grammar->symbols[grammar->start];
+    if (!start->has_rules) {
+        fprintf(stderr, "rift_lalrgen: %s: start symbol %s has no rules\n", path, start->name);
+        return false;
+    }
+
+    /* $end and $accept have no symbol table entry */
+    grammar->terminal_count = 1;
+    grammar->nonterminal_count = 1;
+    grammar->terminals[0] = -1;
+    grammar->nonterminals[0] = -1;
+    for (int i = 0; i < symbol_count; i++) {
+        Symbol* symbol = &grammar->symbols[i];
+        if (symbol->declared_token && symbol->has_rules) {
+            fprintf(stderr, "rift_lalrgen: %s: token %s has rules\n", path, symbol->name);
+            return false;
+        }
+        if (symbol->declared_token) {
+            symbol->number = grammar->terminal_count;
+            grammar->terminal_precedence[symbol->number] = symbol->precedence;
+            grammar->terminal_assoc[symbol->number] = symbol->assoc;
+            grammar->terminals[grammar->terminal_count++] = i;
+        } else if (symbol->has_rules) {
+            symbol->number = grammar->nonterminal_count;
+            grammar->nonterminals[grammar->nonterminal_count++] = i;
+        }
+    }
+
+    /* Rewrite rules in grammar symbol numbers */
+    int terminal_count = grammar->terminal_count;
+    for (int r = 1; r <= grammar->rule_count; r++) {
+        Rule* rule = &grammar->rules[r];
+        for (int k = 0; k < rule->length; k++) {
+            Symbol* symbol = &grammar->symbols[rule->rhs[k]];
+            if (!symbol->declared_token && !symbol->has_rules) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: undefined symbol %s\n",
+                        path, rule->line, symbol->name);
+                return false;
+            }
+            rule->rhs[k] = symbol->declared_token ? symbol->number
+                                                  : terminal_count + symbol->number;
+            if (symbol->declared_token && symbol->precedence) {
+                rule->precedence = symbol->precedence;
+            }
+        }
+        if (rule->prec_symbol >= 0) {
+            Symbol* symbol = &grammar->symbols[rule->prec_symbol];
+            if (!symbol->declared_token || symbol->precedence == 0) {
+                fprintf(stderr, "rift_lalrgen: %s:%d: %%prec %s has no precedence\n",
+                        path, rule->line, symbol->name);
+                return false;
+            }
+            rule->precedence = symbol->precedence;
+        }
+        rule->lhs = grammar->symbols[rule->lhs].number;
+    }
+
+    Rule* accept = &grammar->rules[0];
+    memset(accept, 0, sizeof(*accept));
+    accept->lhs = 0;
+    accept->rhs[0] = terminal_count + start->number;
+    accept->length = 1;
+    accept->prec_symbol = -1;
+    accept->action = find_action(grammar, "accept", path, 0);
+    grammar->rule_count++;
+
+    set_words = (terminal_count + 1 + 63) / 64;
+    return true;
+}
+
+static const char* symbol_name(const Grammar* grammar, int symbol) {
+    if (symbol < grammar->terminal_count) {
+        return symbol == 0 ? "$end" : grammar->symbols[grammar->terminals[symbol]].name;
+    }
+    int nonterminal = symbol - grammar->terminal_count;
+    return nonterminal == 0 ? "$accept"
+                            : grammar->symbols[grammar->nonterminals[nonterminal]].name;
+}
+
+/* =================================================================
+ * FIRST SETS
+ * =================================================================
+ */
+
+typedef struct {
+    Word** first;               /* Per nonterminal */
+    bool* nullable;
+} FirstSets;
+
+static void compute_first(const Grammar* grammar, FirstSets* sets) {
+    int count = grammar->nonterminal_count;
+    sets->first = malloc((size_t)count * sizeof(Word*));
+    sets->nullable = calloc((size_t)count, sizeof(bool));
+    if (!sets->first || !sets->nullable) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int n = 0; n < count; n++) {
+        sets->first[n] = set_new();
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int r = 0; r < grammar->rule_count; r++) {
+            const Rule* rule = &grammar->rules[r];
+            bool all_nullable = true;
+            for (int k = 0; k < rule->length && all_nullable; k++) {
+                int symbol = rule->rhs[k];
+                if (symbol < grammar->terminal_count) {
+                    if (!set_has(sets->first[rule->lhs], symbol)) {
+                        set_add(sets->first[rule->lhs], symbol);
+                        changed = true;
+                    }
+                    all_nullable = false;
+                } else {
+                    int n = symbol - grammar->terminal_count;
+                    changed |= set_union(sets->first[rule->lhs], sets->first[n]);
+                    all_nullable = sets->nullable[n];
+                }
+            }
+            if (all_nullable && !sets->nullable[rule->lhs]) {
+                sets->nullable[rule->lhs] = true;
+                changed = true;
+            }
+        }
+    }
+}
+
+/* FIRST of rhs[from..]; returns whether that suffix is nullable */
+static bool first_of_suffix(const Grammar* grammar, const FirstSets* sets,
+                            const Rule* rule, int from, Word* out) {
+    for (int k = from; k < rule->length; k++) {
+        int symbol = rule->rhs[k];
+        if (symbol < grammar->terminal_count) {
+            set_add(out, symbol);
+            return false;
+        }
+        int n = symbol - grammar->terminal_count;
+        set_union(out, sets->first[n]);
+        if (!sets->nullable[n]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* =================================================================
+ * LR(0) COLLECTION
+ * =================================================================
+ */
+
+typedef struct {
+    int* kernel;                /* Item ids, ascending */
+    int kernel_count;
+    int* transitions;           /* Per grammar symbol: target state or -1 */
+    Word** lookaheads;          /* Per kernel item */
+} State;
+
+typedef struct {
+    const Grammar* grammar;
+    int symbol_count;           /* Terminals + nonterminals */
+    int item_count;
+    int* item_base;             /* Rule -> id of its dot-0 item */
+    int* item_rule;
+    int* item_dot;
+    int** rules_of;             /* Nonterminal -> its rules, -1 terminated */
+    State* states;
+    int state_count;
+    int state_capacity;
+} Automaton;
+
+static int item_next_symbol(const Automaton* lr, int item) {
+    const Rule* rule = &lr->grammar->rules[lr->item_rule[item]];
+    int dot = lr->item_dot[item];
+    return dot < rule->length ? rule->rhs[dot] : -1;
+}
+
+static void init_items(Automaton* lr, const Grammar* grammar) {
+    lr->grammar = grammar;
+    lr->symbol_count = grammar->terminal_count + grammar->nonterminal_count;
+    lr->item_base = malloc((size_t)grammar->rule_count * sizeof(int));
+    lr->rules_of = malloc((size_t)grammar->nonterminal_count * sizeof(int*));
+    if (!lr->item_base || !lr->rules_of) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    lr->item_count = 0;
+    for (int r = 0; r < grammar->rule_count; r++) {
+        lr->item_base[r] = lr->item_count;
+        lr->item_count += grammar->rules[r].length + 1;
+    }
+    lr->item_rule = malloc((size_t)lr->item_count * sizeof(int));
+    lr->item_dot = malloc((size_t)lr->item_count * sizeof(int));
+    if (!lr->item_rule || !lr->item_dot) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int r = 0; r < grammar->rule_count; r++) {
+        for (int dot = 0; dot <= grammar->rules[r].length; dot++) {
+            lr->item_rule[lr->item_base[r] + dot] = r;
+            lr->item_dot[lr->item_base[r] + dot] = dot;
+        }
+    }
+
+    for (int n = 0; n < grammar->nonterminal_count; n++) {
+        lr->rules_of[n] = malloc(((size_t)grammar->rule_count + 1) * sizeof(int));
+        if (!lr->rules_of[n]) {
+            fprintf(stderr, "rift_lalrgen: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        int count = 0;
+        for (int r = 0; r < grammar->rule_count; r++) {
+            if (grammar->rules[r].lhs == n) lr->rules_of[n][count++] = r;
+        }
+        lr->rules_of[n][count] = -1;
+    }
+}
+
+/* LR(0) closure of a kernel; returns the item count written to out */
+static int closure0(const Automaton* lr, const int* kernel, int kernel_count,
+                    int* out, bool* expanded) {
+    int terminal_count = lr->grammar->terminal_count;
+    memset(expanded, 0, (size_t)lr->grammar->nonterminal_count * sizeof(bool));
+
+    int count = 0;
+    for (int i = 0; i < kernel_count; i++) {
+        out[count++] = kernel[i];
+    }
+    for (int i = 0; i < count; i++) {
+        int symbol = item_next_symbol(lr, out[i]);
+        if (symbol < terminal_count || expanded[symbol - terminal_count]) {
+            continue;
+        }
+        expanded[symbol - terminal_count] = true;
+        for (const int* r = lr->rules_of[symbol - terminal_count]; *r >= 0; r++) {
+            out[count++] = lr->item_base[*r];
+        }
+    }
+    return count;
+}
+
+static int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static int find_or_add_state(Automaton* lr, const int* kernel, int kernel_count) {
+    for (int s = 0; s < lr->state_count; s++) {
+        if (lr->states[s].kernel_count == kernel_count &&
+            memcmp(lr->states[s].kernel, kernel, (size_t)kernel_count * sizeof(int)) == 0) {
+            return s;
+        }
+    }
+
+    if (lr->state_count == LALRGEN_MAX_STATES) {
+        fprintf(stderr, "rift_lalrgen: more than %d states\n", LALRGEN_MAX_STATES);
+        exit(EXIT_FAILURE);
+    }
+    if (lr->state_count == lr->state_capacity) {
+        int capacity = lr->state_capacity ? lr->state_capacity * 2 : 64;
+        State* grown = realloc(lr->states, (size_t)capacity * sizeof(State));
+        if (!grown) {
+            fprintf(stderr, "rift_lalrgen: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        lr->states = grown;
+        lr->state_capacity = capacity;
+    }
+
+    State* state = &lr->states[lr->state_count];
+    state->kernel = malloc((size_t)kernel_count * sizeof(int));
+    state->transitions = malloc((size_t)lr->symbol_count * sizeof(int));
+    state->lookaheads = malloc((size_t)kernel_count * sizeof(Word*));
+    if (!state->kernel || !state->transitions || !state->lookaheads) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(state->kernel, kernel, (size_t)kernel_count * sizeof(int));
+    state->kernel_count = kernel_count;
+    for (int x = 0; x < lr->symbol_count; x++) {
+        state->transitions[x] = -1;
+    }
+    for (int k = 0; k < kernel_count; k++) {
+        state->lookaheads[k] = set_new();
+    }
+    return lr->state_count++;
+}
+
+static void build_lr0(Automaton* lr) {
+    int* closure = malloc((size_t)lr->item_count * sizeof(int));
+    int* kernel = malloc((size_t)lr->item_count * sizeof(int));
+    bool* expanded = malloc((size_t)lr->grammar->nonterminal_count * sizeof(bool));
+    if (!closure || !kernel || !expanded) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int start_item = lr->item_base[0];
+    find_or_add_state(lr, &start_item, 1);
+
+    for (int s = 0; s < lr->state_count; s++) {
+        int count = closure0(lr, lr->states[s].kernel, lr->states[s].kernel_count,
+                             closure, expanded);
+        for (int x = 0; x < lr->symbol_count; x++) {
+            int kernel_count = 0;
+            for (int i = 0; i < count; i++) {
+                if (item_next_symbol(lr, closure[i]) == x) {
+                    kernel[kernel_count++] = closure[i] + 1;
+                }
+            }
+            if (kernel_count > 0) {
+                qsort(kernel, (size_t)kernel_count, sizeof(int), compare_int);
+                int target = find_or_add_state(lr, kernel, kernel_count);
+                lr->states[s].transitions[x] = target;
+            }
+        }
+    }
+
+    free(closure);
+    free(kernel);
+    free(expanded);
+}
+
+/* =================================================================
+ * LALR(1) LOOKAHEADS
+ * =================================================================
+ */
+
+typedef struct {
+    Word** lookahead;           /* Per item id */
+    int* items;                 /* Items present, in discovery order */
+    bool* present;
+    int count;
+    bool* queued;
+    int* queue;
+} Closure1;
+
+static void closure1_init(Closure1* c, const Automaton* lr) {
+    size_t n = (size_t)lr->item_count;
+    c->lookahead = malloc(n * sizeof(Word*));
+    c->items = malloc(n * sizeof(int));
+    c->present = calloc(n, sizeof(bool));
+    c->queued = calloc(n, sizeof(bool));
+    c->queue = malloc(n * sizeof(int));
+    if (!c->lookahead || !c->items || !c->present || !c->queued || !c->queue) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < n; i++) {
+        c->lookahead[i] = set_new();
+    }
+    c->count = 0;
+}
+
+static void closure1_reset(Closure1* c) {
+    for (int i = 0; i < c->count; i++) {
+        int item = c->items[i];
+        memset(c->lookahead[item], 0, (size_t)set_words * sizeof(Word));
+        c->present[item] = false;
+    }
+    c->count = 0;
+}
+
+static void closure1_seed(Closure1* c, int item, const Word* lookahead) {
+    if (!c->present[item]) {
+        c->present[item] = true;
+        c->items[c->count++] = item;
+    }
+    set_union(c->lookahead[item], lookahead);
+}
+
+/* LR(1) closure of the seeded items, with lookahead sets merged per item */
+static void closure1_run(Closure1* c, const Automaton* lr, const FirstSets* first) {
+    const Grammar* grammar = lr->grammar;
+    int head = 0;
+    int tail = 0;
+    for (int i = 0; i < c->count; i++) {
+        c->queue[tail++ % lr->item_count] = c->items[i];
+        c->queued[c->items[i]] = true;
+    }
+
+    Word* spread = set_new();
+    while (head != tail) {
+        int item = c->queue[head++ % lr->item_count];
+        c->queued[item] = false;
+
+        int symbol = item_next_symbol(lr, item);
+        if (symbol < grammar->terminal_count) {
+            continue;
+        }
+
+        memset(spread, 0, (size_t)set_words * sizeof(Word));
+        const Rule* rule = &grammar->rules[lr->item_rule[item]];
+        if (first_of_suffix(grammar, first, rule, lr->item_dot[item] + 1, spread)) {
+            set_union(spread, c->lookahead[item]);
+        }
+
+        for (const int* r = lr->rules_of[symbol - grammar->terminal_count]; *r >= 0; r++) {
+            int added = lr->item_base[*r];
+            bool is_new = !c->present[added];
+            if (is_new) {
+                c->present[added] = true;
+                c->items[c->count++] = added;
+            }
+            if ((set_union(c->lookahead[added], spread) || is_new) && !c->queued[added]) {
+                c->queued[added] = true;
+                c->queue[tail++ % lr->item_count] = added;
+            }
+        }
+    }
+    free(spread);
+}
+
+static int kernel_index(const State* state, int item) {
+    for (int k = 0; k < state->kernel_count; k++) {
+        if (state->kernel[k] == item) return k;
+    }
+    return -1;
+}
+
+typedef struct {
+    int from_state, from_kernel;
+    int to_state, to_kernel;
+} Propagation;
+
+static void compute_lookaheads(Automaton* lr, const FirstSets* first) {
+    const Grammar* grammar = lr->grammar;
+    int marker = grammar->terminal_count;      /* '#' */
+    Word* seed = set_new();
+    set_add(seed, marker);
+
+    Propagation* links = NULL;
+    size_t link_count = 0;
+    size_t link_capacity = 0;
+
+    Closure1 c;
+    closure1_init(&c, lr);
+
+    /* $accept : . start, $end */
+    set_add(lr->states[0].lookaheads[0], 0);
+
+    for (int s = 0; s < lr->state_count; s++) {
+        State* state = &lr->states[s];
+        for (int k = 0; k < state->kernel_count; k++) {
+            closure1_reset(&c);
+            closure1_seed(&c, state->kernel[k], seed);
+            closure1_run(&c, lr, first);
+
+            for (int i = 0; i < c.count; i++) {
+                int item = c.items[i];
+                int symbol = item_next_symbol(lr, item);
+                if (symbol < 0) continue;
+
+                State* target = &lr->states[state->transitions[symbol]];
+                int target_kernel = kernel_index(target, item + 1);
+                Word* lookahead = c.lookahead[item];
+
+                /* Spontaneous lookaheads: everything except '#' */
+                bool propagates = set_has(lookahead, marker);
+                for (int t = 0; t < grammar->terminal_count; t++) {
+                    if (set_has(lookahead, t)) set_add(target->lookaheads[target_kernel], t);
+                }
+
+                if (propagates) {
+                    if (link_count == link_capacity) {
+                        link_capacity = link_capacity ? link_capacity * 2 : 256;
+                        Propagation* grown = realloc(links, link_capacity * sizeof(Propagation));
+                        if (!grown) {
+                            fprintf(stderr, "rift_lalrgen: out of memory\n");
+                            exit(EXIT_FAILURE);
+                        }
+                        links = grown;
+                    }
+                    links[link_count++] = (Propagation){
+                        s, k, state->transitions[symbol], target_kernel
+                    };
+                }
+            }
+        }
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < link_count; i++) {
+            const Propagation* link = &links[i];
+            changed |= set_union(lr->states[link->to_state].lookaheads[link->to_kernel],
+                                 lr->states[link->from_state].lookaheads[link->from_kernel]);
+        }
+    }
+
+    free(links);
+    free(seed);
+    for (int i = 0; i < lr->item_count; i++) free(c.lookahead[i]);
+    free(c.lookahead);
+    free(c.items);
+    free(c.present);
+    free(c.queued);
+    free(c.queue);
+}
+
+/* =================================================================
+ * ACTION AND GOTO TABLES
+ * =================================================================
+ */
+
+typedef enum {
+    CELL_EMPTY,
+    CELL_SHIFT,
+    CELL_REDUCE,
+    CELL_ERROR                  /* Explicit error from %nonassoc */
+} CellKind;
+
+typedef struct {
+    CellKind kind;
+    int target;                 /* State or rule */
+} Cell;
+
+typedef struct {
+    Cell* cells;                /* state * terminal_count + terminal */
+    int* default_rule;          /* Per state, -1 if none */
+    int* default_goto;          /* Per nonterminal */
+    int unresolved_shift_reduce;
+    int unresolved_reduce_reduce;
+} Tables;
+
+static void add_reduction(Tables* tables, const Automaton* lr, int s, int t, int r) {
+    const Grammar* grammar = lr->grammar;
+    Cell* cell = &tables->cells[(size_t)s * (size_t)grammar->terminal_count + (size_t)t];
+
+    if (cell->kind == CELL_EMPTY) {
+        cell->kind = CELL_REDUCE;
+        cell->target = r;
+    } else if (cell->kind == CELL_REDUCE) {
+        if (cell->target == r) return;
+        fprintf(stderr, "rift_lalrgen: state %d: reduce/reduce conflict on %s "
+                "(rules %d and %d)\n", s, symbol_name(grammar, t), cell->target, r);
+        tables->unresolved_reduce_reduce++;
+        if (r < cell->target) cell->target = r;
+    } else if (cell->kind == CELL_SHIFT) {
+        int token_precedence = grammar->terminal_precedence[t];
+        int rule_precedence = grammar->rules[r].precedence;
+        if (token_precedence == 0 || rule_precedence == 0) {
+            fprintf(stderr, "rift_lalrgen: state %d: shift/reduce conflict on %s "
+                    "(rule %d, line %d)\n", s, symbol_name(grammar, t), r,
+                    grammar->rules[r].line);
+            tables->unresolved_shift_reduce++;
+        } else if (rule_precedence > token_precedence ||
+                   (rule_precedence == token_precedence &&
+                    grammar->terminal_assoc[t] == ASSOC_LEFT)) {
+            cell->kind = CELL_REDUCE;
+            cell->target = r;
+        } else if (rule_precedence == token_precedence &&
+                   grammar->terminal_assoc[t] == ASSOC_NONASSOC) {
+            cell->kind = CELL_ERROR;
+        }
+    }
+}
+
+static void build_tables(const Automaton* lr, const FirstSets* first, Tables* tables) {
+    const Grammar* grammar = lr->grammar;
+    int terminal_count = grammar->terminal_count;
+    int state_count = lr->state_count;
+
+    tables->cells = calloc((size_t)state_count * (size_t)terminal_count, sizeof(Cell));
+    tables->default_rule = malloc((size_t)state_count * sizeof(int));
+    tables->default_goto = malloc((size_t)grammar->nonterminal_count * sizeof(int));
+    int* votes = calloc((size_t)(grammar->rule_count > state_count ? grammar->rule_count
+                                                                   : state_count),
+                        sizeof(int));
+    if (!tables->cells || !tables->default_rule || !tables->default_goto || !votes) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    Closure1 c;
+    closure1_init(&c, lr);
+
+    for (int s = 0; s < state_count; s++) {
+        const State* state = &lr->states[s];
+        Cell* row = &tables->cells[(size_t)s * (size_t)terminal_count];
+
+        for (int t = 0; t < terminal_count; t++) {
+            if (state->transitions[t] >= 0) {
+                row[t].kind = CELL_SHIFT;
+                row[t].target = state->transitions[t];
+            }
+        }
+
+        /* Reductions come from the closure under the final lookaheads,
+         * which also covers epsilon rules outside the kernel */
+        closure1_reset(&c);
+        for (int k = 0; k < state->kernel_count; k++) {
+            closure1_seed(&c, state->kernel[k], state->lookaheads[k]);
+        }
+        closure1_run(&c, lr, first);
+        for (int i = 0; i < c.count; i++) {
+            int item = c.items[i];
+            if (item_next_symbol(lr, item) >= 0) continue;
+            for (int t = 0; t < terminal_count; t++) {
+                if (set_has(c.lookahead[item], t)) {
+                    add_reduction(tables, lr, s, t, lr->item_rule[item]);
+                }
+            }
+        }
+
+        /* Most common reduction becomes the default; accept never does */
+        int best = -1;
+        memset(votes, 0, (size_t)grammar->rule_count * sizeof(int));
+        for (int t = 0; t < terminal_count; t++) {
+            if (row[t].kind == CELL_REDUCE && row[t].target != 0) {
+                int r = row[t].target;
+                votes[r]++;
+                if (best < 0 || votes[r] > votes[best] ||
+                    (votes[r] == votes[best] && r < best)) {
+                    best = r;
+                }
+            }
+        }
+        tables->default_rule[s] = best;
+        for (int t = 0; t < terminal_count; t++) {
+            if (row[t].kind == CELL_REDUCE && row[t].target == best) {
+                row[t].kind = CELL_EMPTY;
+            } else if (row[t].kind == CELL_ERROR && best < 0) {
+                row[t].kind = CELL_EMPTY;
+            }
+        }
+    }
+
+    /* Most common goto target per nonterminal becomes its default */
+    for (int n = 0; n < grammar->nonterminal_count; n++) {
+        int symbol = terminal_count + n;
+        int best = 0;
+        memset(votes, 0, (size_t)state_count * sizeof(int));
+        for (int s = 0; s < state_count; s++) {
+            int target = lr->states[s].transitions[symbol];
+            if (target >= 0 && ++votes[target] > votes[best]) {
+                best = target;
+            }
+        }
+        tables->default_goto[n] = best;
+    }
+
+    free(votes);
+    for (int i = 0; i < lr->item_count; i++) free(c.lookahead[i]);
+    free(c.lookahead);
+    free(c.items);
+    free(c.present);
+    free(c.queued);
+    free(c.queue);
+}
+
+/* =================================================================
+ * COMB-VECTOR PACKING
+ * =================================================================
+ */
+
+typedef struct {
+    int column;
+    int value;
+} PackEntry;
+
+typedef struct {
+    int row;
+    PackEntry* entries;
+    int count;
+} PackRow;
+
+typedef struct {
+    int* value;
+    int* check;                 /* Owning row, -1 if unused */
+    int size;                   /* Slots in use: max base + width */
+    int capacity;
+    int* base;                  /* Per row */
+} Packed;
+
+static int compare_rows(const void* a, const void* b) {
+    const PackRow* x = a;
+    const PackRow* y = b;
+    if (x->count != y->count) return y->count - x->count;
+    return x->row - y->row;
+}
+
+static void packed_reserve(Packed* packed, int size) {
+    if (size <= packed->capacity) return;
+    int capacity = packed->capacity ? packed->capacity : 256;
+    while (capacity < size) capacity *= 2;
+    int* value = realloc(packed->value, (size_t)capacity * sizeof(int));
+    if (value) packed->value = value;
+    int* check = realloc(packed->check, (size_t)capacity * sizeof(int));
+    if (!value || !check) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    packed->check = check;
+    for (int i = packed->capacity; i < capacity; i++) {
+        packed->value[i] = 0;
+        packed->check[i] = -1;
+    }
+    packed->capacity = capacity;
+}
+
+/*
+ * pack_rows - First-fit row displacement, densest rows first
+ *
+ * Every row's base keeps base + width inside the table, so a lookup
+ * never needs a bounds check.
+ */
+static void pack_rows(PackRow* rows, int row_count, int width, Packed* packed) {
+    packed->base = calloc((size_t)row_count, sizeof(int));
+    if (!packed->base) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    packed->size = width;
+    packed_reserve(packed, width);
+
+    qsort(rows, (size_t)row_count, sizeof(PackRow), compare_rows);
+    for (int i = 0; i < row_count; i++) {
+        PackRow* row = &rows[i];
+        if (row->count == 0) continue;
+
+        int base = 0;
+        for (;; base++) {
+            packed_reserve(packed, base + width);
+            bool fits = true;
+            for (int e = 0; e < row->count && fits; e++) {
+                fits = packed->check[base + row->entries[e].column] < 0;
+            }
+            if (fits) break;
+        }
+
+        packed->base[row->row] = base;
+        for (int e = 0; e < row->count; e++) {
+            packed->value[base + row->entries[e].column] = row->entries[e].value;
+            packed->check[base + row->entries[e].column] = row->row;
+        }
+        if (base + width > packed->size) packed->size = base + width;
+    }
+}
+
+static int encode_action(const Cell* cell) {
+    switch (cell->kind) {
+        case CELL_SHIFT:  return cell->target;
+        case CELL_REDUCE: return -(cell->target + 1);
+        default:          return 0;
+    }
+}
+
+static void pack_tables(const Automaton* lr, const Tables* tables,
+                        Packed* actions, Packed* gotos, int* entry_counts) {
+    const Grammar* grammar = lr->grammar;
+    int terminal_count = grammar->terminal_count;
+    int state_count = lr->state_count;
+
+    /* Action rows: one per state, columns are terminals */
+    PackRow* rows = calloc((size_t)state_count, sizeof(PackRow));
+    PackEntry* entries = malloc((size_t)state_count * (size_t)terminal_count *
+                                sizeof(PackEntry));
+    if (!rows || !entries) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    int used = 0;
+    for (int s = 0; s < state_count; s++) {
+        rows[s].row = s;
+        rows[s].entries = &entries[used];
+        for (int t = 0; t < terminal_count; t++) {
+            const Cell* cell = &tables->cells[(size_t)s * (size_t)terminal_count + (size_t)t];
+            if (cell->kind != CELL_EMPTY) {
+                entries[used++] = (PackEntry){ t, encode_action(cell) };
+                rows[s].count++;
+            }
+        }
+    }
+    entry_counts[0] = used;
+    pack_rows(rows, state_count, terminal_count, actions);
+    free(rows);
+    free(entries);
+
+    /* Goto columns: one per nonterminal, indexed by state */
+    int nonterminal_count = grammar->nonterminal_count;
+    rows = calloc((size_t)nonterminal_count, sizeof(PackRow));
+    entries = malloc((size_t)nonterminal_count * (size_t)state_count * sizeof(PackEntry));
+    if (!rows || !entries) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    used = 0;
+    for (int n = 0; n < nonterminal_count; n++) {
+        rows[n].row = n;
+        rows[n].entries = &entries[used];
+        for (int s = 0; s < state_count; s++) {
+            int target = lr->states[s].transitions[terminal_count + n];
+            if (target >= 0 && target != tables->default_goto[n]) {
+                entries[used++] = (PackEntry){ s, target };
+                rows[n].count++;
+            }
+        }
+    }
+    entry_counts[1] = used;
+    pack_rows(rows, nonterminal_count, state_count, gotos);
+    free(rows);
+    free(entries);
+}
+
+/* =================================================================
+ * EMISSION
+ * =================================================================
+ */
+
+static void upper_identifier(const char* in, char* out, size_t size) {
+    size_t n = 0;
+    for (; *in && n + 1 < size; in++) {
+        out[n++] = isalnum((unsigned char)*in) ? (char)toupper((unsigned char)*in) : '_';
+    }
+    out[n] = '\0';
+}
+
+static void emit_int_array(FILE* out, const char* type, const char* prefix,
+                           const char* name, const int* values, int count, int empty_as) {
+    fprintf(out, "const %s %s_%s[%d] = {", type, prefix, name, count);
+    for (int i = 0; i < count; i++) {
+        int value = values[i] < 0 && empty_as >= 0 ? empty_as : values[i];
+        fprintf(out, "%s%6d,", i % 10 == 0 ? "\n    " : "", value);
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+static void emit_header(FILE* out, const Grammar* grammar, const Automaton* lr,
+                        const Packed* actions, const Packed* gotos,
+                        const char* prefix, const char* include, const char* grammar_path) {
+    char upper[LALRGEN_MAX_NAME * 2];
+    char guard[LALRGEN_MAX_LINE];
+    upper_identifier(prefix, upper, sizeof(upper));
+    upper_identifier(include, guard, sizeof(guard));
+
+    fprintf(out,
+        "/*\n"
+        " * =================================================================\n"
+        " * GENERATED FILE - DO NOT EDIT\n"
+        " * Produced by rift_lalrgen from %s\n"
+        " * LALR(1) tables: %d states, %d rules, %d terminals, %d nonterminals\n"
+        " * =================================================================\n"
+        " */\n\n", grammar_path, lr->state_count, grammar->rule_count,
+        grammar->terminal_count, grammar->nonterminal_count);
+
+    fprintf(out, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(out, "#include <stdint.h>\n\n");
+    fprintf(out, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+
+    fprintf(out, "// Terminals; %s_T_END marks the end of input\n", upper);
+    fprintf(out, "typedef enum {\n");
+    for (int t = 0; t < grammar->terminal_count; t++) {
+        char name[LALRGEN_MAX_NAME];
+        upper_identifier(t == 0 ? "END" : symbol_name(grammar, t), name, sizeof(name));
+        fprintf(out, "    %s_T_%s,\n", upper, name);
+    }
+    fprintf(out, "    %s_TERMINAL_COUNT\n} %s_terminal_t;\n\n", upper, prefix);
+
+    fprintf(out, "// Reduction actions named in the grammar\n");
+    fprintf(out, "typedef enum {\n");
+    for (int a = 0; a < grammar->action_count; a++) {
+        char name[LALRGEN_MAX_NAME];
+        upper_identifier(grammar->actions[a], name, sizeof(name));
+        fprintf(out, "    %s_ACTION_%s,\n", upper, name);
+    }
+    fprintf(out, "} %s_action_t;\n\n", prefix);
+
+    fprintf(out, "typedef struct {\n"
+                 "    uint16_t lhs;                     // Nonterminal\n"
+                 "    uint8_t length;                   // Symbols popped\n"
+                 "    uint8_t action;                   // %s_action_t\n"
+                 "    uint8_t argument;                 // 1-based symbol position, 0 if none\n"
+                 "} %s_rule_t;\n\n", prefix, prefix);
+
+    fprintf(out, "#define %s_STATE_COUNT %d\n", upper, lr->state_count);
+    fprintf(out, "#define %s_RULE_COUNT %d\n", upper, grammar->rule_count);
+    fprintf(out, "#define %s_NONTERMINAL_COUNT %d\n", upper, grammar->nonterminal_count);
+    fprintf(out, "#define %s_ACTION_TABLE_SIZE %d\n", upper, actions->size);
+    fprintf(out, "#define %s_GOTO_TABLE_SIZE %d\n\n", upper, gotos->size);
+
+    fprintf(out, "// i = action_base[state] + terminal; the entry is valid if\n"
+                 "// action_check[i] == state, else -default_reduction[state] applies.\n"
+                 "// > 0: shift to that state; < 0: reduce by rule -value - 1; 0: error\n");
+    fprintf(out, "extern const uint16_t %s_action_base[%s_STATE_COUNT];\n", prefix, upper);
+    fprintf(out, "extern const uint16_t %s_action_check[%s_ACTION_TABLE_SIZE];\n",
+            prefix, upper);
+    fprintf(out, "extern const int16_t %s_action_value[%s_ACTION_TABLE_SIZE];\n",
+            prefix, upper);
+    fprintf(out, "extern const uint16_t %s_default_reduction[%s_STATE_COUNT];\n\n",
+            prefix, upper);
+
+    fprintf(out, "// i = goto_base[nonterminal] + state; valid if goto_check[i] ==\n"
+                 "// nonterminal, else goto_default[nonterminal]\n");
+    fprintf(out, "extern const uint16_t %s_goto_base[%s_NONTERMINAL_COUNT];\n", prefix, upper);
+    fprintf(out, "extern const uint16_t %s_goto_check[%s_GOTO_TABLE_SIZE];\n", prefix, upper);
+    fprintf(out, "extern const uint16_t %s_goto_value[%s_GOTO_TABLE_SIZE];\n", prefix, upper);
+    fprintf(out, "extern const uint16_t %s_goto_default[%s_NONTERMINAL_COUNT];\n\n",
+            prefix, upper);
+
+    fprintf(out, "extern const %s_rule_t %s_rules[%s_RULE_COUNT];\n", prefix, prefix, upper);
+    fprintf(out, "extern const char* const %s_terminal_names[%s_TERMINAL_COUNT];\n\n",
+            prefix, upper);
+
+    fprintf(out, "#ifdef __cplusplus\n}\n#endif\n\n#endif /* %s */\n", guard);
+}
+
+static void emit_source(FILE* out, const Grammar* grammar, const Automaton* lr,
+                        const Tables* tables, const Packed* actions, const Packed* gotos,
+                        const int* entry_counts, const char* prefix, const char* include,
+                        const char* grammar_path) {
+    char upper[LALRGEN_MAX_NAME * 2];
+    upper_identifier(prefix, upper, sizeof(upper));
+    int state_count = lr->state_count;
+
+    fprintf(out,
+        "/*\n"
+        " * =================================================================\n"
+        " * GENERATED FILE - DO NOT EDIT\n"
+        " * Produced by rift_lalrgen from %s\n"
+        " * Action table: %d entries in %d slots (dense: %d)\n"
+        " * Goto table: %d entries in %d slots (dense: %d)\n"
+        " * =================================================================\n"
+        " */\n\n", grammar_path,
+        entry_counts[0], actions->size, state_count * grammar->terminal_count,
+        entry_counts[1], gotos->size, state_count * grammar->nonterminal_count);
+    fprintf(out, "#include \"%s\"\n\n", include);
+
+    emit_int_array(out, "uint16_t", prefix, "action_base", actions->base, state_count, -1);
+    emit_int_array(out, "uint16_t", prefix, "action_check", actions->check, actions->size,
+                   LALRGEN_EMPTY_CHECK);
+    emit_int_array(out, "int16_t", prefix, "action_value", actions->value, actions->size, -1);
+
+    int* defaults = malloc((size_t)state_count * sizeof(int));
+    if (!defaults) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int s = 0; s < state_count; s++) {
+        defaults[s] = tables->default_rule[s] + 1;
+    }
+    emit_int_array(out, "uint16_t", prefix, "default_reduction", defaults, state_count, -1);
+    free(defaults);
+
+    emit_int_array(out, "uint16_t", prefix, "goto_base", gotos->base,
+                   grammar->nonterminal_count, -1);
+    emit_int_array(out, "uint16_t", prefix, "goto_check", gotos->check, gotos->size,
+                   LALRGEN_EMPTY_CHECK);
+    emit_int_array(out, "uint16_t", prefix, "goto_value", gotos->value, gotos->size, -1);
+    emit_int_array(out, "uint16_t", prefix, "goto_default", tables->default_goto,
+                   grammar->nonterminal_count, -1);
+
+    fprintf(out, "const %s_rule_t %s_rules[%s_RULE_COUNT] = {\n", prefix, prefix, upper);
+    for (int r = 0; r < grammar->rule_count; r++) {
+        const Rule* rule = &grammar->rules[r];
+        char action[LALRGEN_MAX_NAME];
+        upper_identifier(grammar->actions[rule->action], action, sizeof(action));
+        fprintf(out, "    { %2d, %d, %s_ACTION_%s, %d },", rule->lhs, rule->length,
+                upper, action, rule->argument);
+        fprintf(out, " // %d: %s :", r, symbol_name(grammar, grammar->terminal_count + rule->lhs));
+        for (int k = 0; k < rule->length; k++) {
+            fprintf(out, " %s", symbol_name(grammar, rule->rhs[k]));
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const char* const %s_terminal_names[%s_TERMINAL_COUNT] = {\n", prefix, upper);
+    for (int t = 0; t < grammar->terminal_count; t++) {
+        fprintf(out, "    \"%s\",\n", symbol_name(grammar, t));
+    }
+    fprintf(out, "};\n");
+}
+
+static void print_usage(const char* program) {
+    fprintf(stderr, "Usage: %s <grammar> <output.c> <output.h> [--prefix NAME] "
+            "[--include HEADER]\n"
+            "  --prefix   identifier prefix (default rift_lalr)\n"
+            "  --include  how output.c includes output.h (default: its path)\n",
+            program);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* grammar_path = argv[1];
+    const char* source_path = argv[2];
+    const char* header_path = argv[3];
+    const char* prefix = "rift_lalr";
+    const char* include = header_path;
+
+    for (int i = 4; i < argc; i++) {
+        if (strcmp(argv[i], "--prefix") == 0 && i + 1 < argc) {
+            prefix = argv[++i];
+        } else if (strcmp(argv[i], "--include") == 0 && i + 1 < argc) {
+            include = argv[++i];
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (!is_name(prefix) || strlen(prefix) >= LALRGEN_MAX_NAME) {
+        fprintf(stderr, "rift_lalrgen: bad prefix %s\n", prefix);
+        return EXIT_FAILURE;
+    }
+
+    Grammar* grammar = calloc(1, sizeof(Grammar));
+    if (!grammar) {
+        fprintf(stderr, "rift_lalrgen: out of memory\n");
+        return EXIT_FAILURE;
+    }
+    if (!load_grammar(grammar_path, grammar) || !finalize_grammar(grammar, grammar_path)) {
+        return EXIT_FAILURE;
+    }
+
+    FirstSets first;
+    compute_first(grammar, &first);
+
+    Automaton lr;
+    memset(&lr, 0, sizeof(lr));
+    init_items(&lr, grammar);
+    build_lr0(&lr);
+    compute_lookaheads(&lr, &first);
+
+    Tables tables;
+    memset(&tables, 0, sizeof(tables));
+    build_tables(&lr, &first, &tables);
+    if (tables.unresolved_shift_reduce || tables.unresolved_reduce_reduce) {
+        fprintf(stderr, "rift_lalrgen: %s: %d shift/reduce, %d reduce/reduce conflicts\n",
+                grammar_path, tables.unresolved_shift_reduce, tables.unresolved_reduce_reduce);
+        return EXIT_FAILURE;
+    }
+
+    Packed actions;
+    Packed gotos;
+    memset(&actions, 0, sizeof(actions));
+    memset(&gotos, 0, sizeof(gotos));
+    int entry_counts[2];
+    pack_tables(&lr, &tables, &actions, &gotos, entry_counts);
+    if (actions.size >= LALRGEN_EMPTY_CHECK || gotos.size >= LALRGEN_EMPTY_CHECK) {
+        fprintf(stderr, "rift_lalrgen: packed tables exceed 16-bit indices\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE* header = fopen(header_path, "w");
+    if (!header) {
+        fprintf(stderr, "rift_lalrgen: cannot write %s\n", header_path);
+        return EXIT_FAILURE;
+    }
+    emit_header(header, grammar, &lr, &actions, &gotos, prefix, include, grammar_path);
+    bool write_ok = !ferror(header);
+    fclose(header);
+
+    FILE* source = fopen(source_path, "w");
+    if (!source) {
+        fprintf(stderr, "rift_lalrgen: cannot write %s\n", source_path);
+        return EXIT_FAILURE;
+    }
+    emit_source(source, grammar, &lr, &tables, &actions, &gotos, entry_counts,
+                prefix, include, grammar_path);
+    write_ok = write_ok && !ferror(source);
+    fclose(source);
+
+    if (!write_ok) {
+        fprintf(stderr, "rift_lalrgen: write error\n");
+        return EXIT_FAILURE;
+    }
+
+    /* The process exits here; the OS reclaims the tables */
+    return EXIT_SUCCESS;
+}